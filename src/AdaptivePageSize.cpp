@@ -0,0 +1,60 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "AdaptivePageSize.hpp"
+
+#include <algorithm>
+
+AdaptivePageSize::AdaptivePageSize(const std::size_t initialSize,
+                                   const std::size_t minSize,
+                                   const std::size_t maxSize,
+                                   const std::chrono::microseconds targetLatency)
+    : minSize_{std::max<std::size_t>(minSize, 1)}, maxSize_{std::max(maxSize, minSize_)},
+      targetLatency_{targetLatency}, size_{std::clamp(initialSize, minSize_, maxSize_)}
+{
+}
+
+AdaptivePageSize::Adjustment AdaptivePageSize::recordPage(
+    const std::size_t requestedSize,
+    const std::size_t numResults,
+    const std::chrono::steady_clock::duration latency)
+{
+    if (targetLatency_.count() == 0 || requestedSize == 0 || numResults == 0)
+    {
+        return Adjustment::kNone;
+    }
+
+    const auto latencyUs = std::max<std::chrono::microseconds::rep>(
+        std::chrono::duration_cast<std::chrono::microseconds>(latency).count(), 1);
+    const bool isFullPage = numResults >= requestedSize;
+    const bool isOverTarget = latencyUs > targetLatency_.count();
+    if (!isFullPage && !isOverTarget)
+    {
+        return Adjustment::kNone;
+    }
+
+    // Assume latency is proportional to the number of results, which
+    // overestimates the ideal size where per-call overhead dominates,
+    // but the step limit below keeps the size converging.
+    const double idealSize = static_cast<double>(numResults) *
+                             static_cast<double>(targetLatency_.count()) /
+                             static_cast<double>(latencyUs);
+
+    const double stepMin = static_cast<double>(requestedSize) / 2;
+    const double stepMax = static_cast<double>(requestedSize) * 2;
+    const auto stepSize = static_cast<std::size_t>(std::clamp(idealSize, stepMin, stepMax));
+    const std::size_t newSize = std::clamp(stepSize, minSize_, maxSize_);
+
+    // Concurrent queries may race to update the size. Any of their
+    // observations is equally valid, so the last one wins.
+    const std::size_t oldSize = size_.exchange(newSize, std::memory_order_relaxed);
+    if (newSize > oldSize)
+    {
+        return Adjustment::kGrown;
+    }
+    if (newSize < oldSize)
+    {
+        return Adjustment::kShrunk;
+    }
+    return Adjustment::kNone;
+}
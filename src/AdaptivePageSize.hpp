@@ -0,0 +1,69 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+/**
+ * Page size for paged manager queries, tuned from the observed latency
+ * of each page towards a target latency per page.
+ *
+ * Managers with a high per-call overhead benefit from large pages,
+ * reducing round trips, whilst fast (e.g. in-process) managers benefit
+ * from small pages, reducing the memory held per page.
+ *
+ * The size changes by at most a factor of two per page, so that a
+ * single outlier cannot swing it to an extreme. Safe to use from any
+ * thread.
+ */
+class AdaptivePageSize
+{
+public:
+    enum class Adjustment
+    {
+        kNone,
+        kGrown,
+        kShrunk
+    };
+
+    /**
+     * @param initialSize Page size to start from.
+     * @param minSize Smallest page size that may be chosen.
+     * @param maxSize Largest page size that may be chosen.
+     * @param targetLatency Desired time to retrieve a page. Zero
+     * disables tuning, such that initialSize is always used.
+     */
+    AdaptivePageSize(std::size_t initialSize,
+                     std::size_t minSize,
+                     std::size_t maxSize,
+                     std::chrono::microseconds targetLatency);
+
+    /**
+     * Current page size.
+     */
+    [[nodiscard]] std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+    /**
+     * Tune the page size from a retrieved page.
+     *
+     * Short pages (e.g. the final page) are only used to shrink the
+     * size, since their latency says little about that of a full page.
+     * Empty pages are ignored.
+     *
+     * @param requestedSize Page size the page was requested with.
+     * @param numResults Number of results in the page.
+     * @param latency Time taken to retrieve the page.
+     */
+    Adjustment recordPage(std::size_t requestedSize,
+                          std::size_t numResults,
+                          std::chrono::steady_clock::duration latency);
+
+private:
+    const std::size_t minSize_;
+    const std::size_t maxSize_;
+    const std::chrono::microseconds targetLatency_;
+    std::atomic<std::size_t> size_;
+};
@@ -0,0 +1,133 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "AssetIdFilter.hpp"
+
+#include <functional>
+
+namespace
+{
+// Blocks in the Bloom filter of seen strings, i.e. 512KiB.
+constexpr std::size_t kNumSeenBlocks = std::size_t{1} << 13;
+// Strings inserted per block before the filter is cleared. With one bit
+// per word of a block, this keeps the false positive rate below 1%.
+constexpr std::size_t kSeenPerBlock = 40;
+
+/**
+ * Finaliser of the SplitMix64 generator, to distribute the bits of a
+ * weak hash (e.g. std::hash, which may be the identity for integers).
+ */
+constexpr std::uint64_t mix(std::uint64_t value)
+{
+    value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27U)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31U);
+}
+
+std::size_t roundUpToPowerOfTwo(const std::size_t value)
+{
+    std::size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1U;
+    }
+    return result;
+}
+}  // namespace
+
+BlockedBloomFilter::BlockedBloomFilter(const std::size_t numBlocks)
+    : numBlocks_{roundUpToPowerOfTwo(numBlocks)},
+      // Value-initialised, i.e. zeroed.
+      blocks_{std::make_unique<Block[]>(numBlocks_)}  // NOLINT(*-avoid-c-arrays)
+{
+}
+
+bool BlockedBloomFilter::mayContain(const std::uint64_t hash) const
+{
+    const Block& block = blockFor(hash);
+    const BlockMask mask = maskFor(hash);
+    // Check all words, rather than exiting early, so that the loop can
+    // be vectorised.
+    std::uint64_t missing = 0;
+    for (std::size_t idx = 0; idx < kWordsPerBlock; ++idx)
+    {
+        missing |= mask[idx] & ~block.words[idx].load(std::memory_order_relaxed);
+    }
+    return missing == 0;
+}
+
+void BlockedBloomFilter::insert(const std::uint64_t hash)
+{
+    Block& block = blockFor(hash);
+    const BlockMask mask = maskFor(hash);
+    for (std::size_t idx = 0; idx < kWordsPerBlock; ++idx)
+    {
+        // Avoid dirtying the cache line if the bit is already set.
+        if ((block.words[idx].load(std::memory_order_relaxed) & mask[idx]) == 0)
+        {
+            block.words[idx].fetch_or(mask[idx], std::memory_order_relaxed);
+        }
+    }
+}
+
+void BlockedBloomFilter::clear()
+{
+    for (std::size_t blockIdx = 0; blockIdx < numBlocks_; ++blockIdx)
+    {
+        for (auto& word : blocks_[blockIdx].words)
+        {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+BlockedBloomFilter::Block& BlockedBloomFilter::blockFor(const std::uint64_t hash)
+{
+    return blocks_[hash & (numBlocks_ - 1)];
+}
+
+const BlockedBloomFilter::Block& BlockedBloomFilter::blockFor(const std::uint64_t hash) const
+{
+    return blocks_[hash & (numBlocks_ - 1)];
+}
+
+BlockedBloomFilter::BlockMask BlockedBloomFilter::maskFor(const std::uint64_t hash)
+{
+    // One bit per word, selected by successive 6-bit slices of a hash
+    // independent of that used to select the block.
+    const std::uint64_t bitHash = mix(hash);
+    BlockMask mask{};
+    for (std::size_t idx = 0; idx < kWordsPerBlock; ++idx)
+    {
+        mask[idx] = std::uint64_t{1} << ((bitHash >> (idx * 6U)) & 63U);
+    }
+    return mask;
+}
+
+AssetIdFilter::AssetIdFilter(CacheMemoryBudget* budget) : seen_{kNumSeenBlocks}, memo_{budget} {}
+
+bool AssetIdFilter::hasPrefix(const std::string_view str, const std::string_view prefix)
+{
+    // Compared with memcmp, which is vectorised by the standard library
+    // on all supported platforms.
+    return str.size() >= prefix.size() && str.compare(0, prefix.size(), prefix) == 0;
+}
+
+std::uint64_t AssetIdFilter::hashOf(const std::string& str, const Generation generation)
+{
+    // Salted with the generation, so that strings seen with a previous
+    // manager configuration are treated as unseen.
+    return mix(std::hash<std::string>{}(str) ^ mix(generation));
+}
+
+void AssetIdFilter::markSeen(const std::uint64_t hash)
+{
+    // Once saturated, the filter would report nearly every string as
+    // seen, so start afresh. Strings already memoised remain so.
+    if (numSeen_.fetch_add(1, std::memory_order_relaxed) >= kNumSeenBlocks * kSeenPerBlock)
+    {
+        numSeen_.store(0, std::memory_order_relaxed);
+        seen_.clear();
+    }
+    seen_.insert(hash);
+}
@@ -0,0 +1,197 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "CacheMemoryBudget.hpp"
+#include "ReferenceCache.hpp"
+#include "Statistics.hpp"
+
+/**
+ * Counts of entity reference checks, by how they were answered.
+ */
+struct AssetIdCheckStats
+{
+    /// Checks answered by the manager's entity reference prefix.
+    Counter prefixChecks;
+    /// Checks answered by a previously memoised manager response.
+    Counter memoHits;
+    /// Checks of strings not seen before, answered by the manager
+    /// without being memoised.
+    Counter firstSightings;
+    /// Checks of strings seen before but not memoised, answered by the
+    /// manager.
+    Counter managerChecks;
+};
+
+/**
+ * Approximate set membership test, using a single cache line per
+ * query.
+ *
+ * May report false positives, but never false negatives (except
+ * transiently whilst being cleared). Safe to query and update
+ * concurrently without locking.
+ */
+class BlockedBloomFilter
+{
+public:
+    /**
+     * @param numBlocks Number of 64-byte blocks. Rounded up to a power
+     * of two.
+     */
+    explicit BlockedBloomFilter(std::size_t numBlocks);
+
+    /// Whether a hash has (probably) been inserted.
+    [[nodiscard]] bool mayContain(std::uint64_t hash) const;
+
+    void insert(std::uint64_t hash);
+
+    void clear();
+
+    /// Bytes used by the filter.
+    [[nodiscard]] std::size_t memoryUsage() const { return numBlocks_ * sizeof(Block); }
+
+private:
+    static constexpr std::size_t kWordsPerBlock = 8;
+
+    struct alignas(64) Block
+    {
+        std::array<std::atomic<std::uint64_t>, kWordsPerBlock> words;
+    };
+
+    /// Bit mask for each word of a block.
+    using BlockMask = std::array<std::uint64_t, kWordsPerBlock>;
+
+    [[nodiscard]] Block& blockFor(std::uint64_t hash);
+    [[nodiscard]] const Block& blockFor(std::uint64_t hash) const;
+    [[nodiscard]] static BlockMask maskFor(std::uint64_t hash);
+
+    std::size_t numBlocks_;
+    std::unique_ptr<Block[]> blocks_;  // NOLINT(*-avoid-c-arrays)
+};
+
+/**
+ * Answers whether strings are entity references, calling the manager
+ * only when the answer cannot be determined more cheaply.
+ *
+ * Katana queries many strings that are not entity references (file
+ * paths, expressions, attribute values), so checks are layered:
+ *
+ * 1. If the manager advertises a prefix common to all its entity
+ *    references, the answer is given by a prefix comparison alone.
+ * 2. Otherwise, previously seen strings are looked up in a memo of
+ *    manager responses.
+ * 3. Otherwise, the manager is asked.
+ *
+ * A Bloom filter of recently seen strings guards the memo: strings are
+ * only memoised once seen a second time, so one-off strings neither
+ * occupy memory nor evict more useful cache entries. Since the filter
+ * may give false positives, it is never used to answer a check
+ * directly.
+ */
+class AssetIdFilter
+{
+public:
+    using Generation = std::uint64_t;
+
+    /**
+     * @param budget Memory budget for memoised responses, if any.
+     */
+    explicit AssetIdFilter(CacheMemoryBudget* budget = nullptr);
+
+    /**
+     * Whether a string is an entity reference.
+     *
+     * @param str String to check.
+     * @param generation Generation of the manager configuration (see
+     * ManagerState).
+     * @param prefix Prefix of all the manager's entity references, if
+     * advertised.
+     * @param isEntityReferenceString Function asking the manager.
+     */
+    template <class Fn>
+    bool isEntityReferenceString(const std::string& str,
+                                 const Generation generation,
+                                 const std::optional<std::string>& prefix,
+                                 Fn&& isEntityReferenceString)
+    {
+        if (prefix)
+        {
+            stats_.prefixChecks.increment();
+            return hasPrefix(str, *prefix);
+        }
+
+        const std::uint64_t hash = hashOf(str, generation);
+        if (!seen_.mayContain(hash))
+        {
+            stats_.firstSightings.increment();
+            markSeen(hash);
+            return std::forward<Fn>(isEntityReferenceString)(str);
+        }
+
+        if (const auto isReference = memo_.visit(
+                str, generation, [](const MemoisedCheck& check) { return check.isReference; }))
+        {
+            stats_.memoHits.increment();
+            return *isReference;
+        }
+
+        stats_.managerChecks.increment();
+        const bool isReference = std::forward<Fn>(isEntityReferenceString)(str);
+        memo_.put(str, generation, MemoisedCheck{isReference}, Memo::kNeverExpires);
+        return isReference;
+    }
+
+    [[nodiscard]] const AssetIdCheckStats& stats() const { return stats_; }
+
+    /// Number of memoised manager responses.
+    [[nodiscard]] std::size_t memoSize() const { return memo_.size(); }
+
+    /// Bytes used by memoised manager responses.
+    [[nodiscard]] std::size_t memoMemoryUsage() const { return memo_.memoryUsage(); }
+
+    /// Number of memoised manager responses evicted.
+    [[nodiscard]] std::uint64_t memoEvictions() const { return memo_.evictions(); }
+
+    /// Bytes used by the Bloom filter of seen strings, which is of
+    /// fixed size, so not accounted against the memory budget.
+    [[nodiscard]] std::size_t filterMemoryUsage() const { return seen_.memoryUsage(); }
+
+    /**
+     * Whether a string starts with a prefix.
+     *
+     * Exposed for testing.
+     */
+    [[nodiscard]] static bool hasPrefix(std::string_view str, std::string_view prefix);
+
+private:
+    struct MemoisedCheck
+    {
+        bool isReference;
+
+        [[nodiscard]] static std::size_t memoryUsage() { return 0; }
+    };
+
+    using Memo = ReferenceCache<MemoisedCheck>;
+
+    static std::uint64_t hashOf(const std::string& str, Generation generation);
+
+    /// Insert into the Bloom filter, clearing it first if saturated.
+    void markSeen(std::uint64_t hash);
+
+    BlockedBloomFilter seen_;
+    /// Insertions into seen_ since it was last cleared.
+    std::atomic<std::size_t> numSeen_{0};
+    Memo memo_;
+    AssetIdCheckStats stats_;
+};
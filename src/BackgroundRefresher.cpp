@@ -0,0 +1,131 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "BackgroundRefresher.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+BackgroundRefresher::BackgroundRefresher(RefreshFn refresh,
+                                         const std::size_t maxBatchSize,
+                                         const std::chrono::milliseconds batchDelay,
+                                         const std::size_t maxThreads)
+    : refresh_{std::move(refresh)}, maxBatchSize_{std::max<std::size_t>(maxBatchSize, 1)},
+      batchDelay_{batchDelay}, maxThreads_{std::max<std::size_t>(maxThreads, 1)}
+{
+}
+
+BackgroundRefresher::~BackgroundRefresher()
+{
+    stop();
+}
+
+void BackgroundRefresher::request(const std::string& ref)
+{
+    {
+        const std::lock_guard lock{mutex_};
+        if (isStopping_ || !pending_.insert(ref).second)
+        {
+            return;
+        }
+        queue_.push_back(ref);
+        startThreadsForQueue();
+    }
+    wake_.notify_one();
+}
+
+void BackgroundRefresher::request(const std::vector<std::string>& refs)
+{
+    {
+        const std::lock_guard lock{mutex_};
+        if (isStopping_)
+        {
+            return;
+        }
+        for (const std::string& ref : refs)
+        {
+            if (pending_.insert(ref).second)
+            {
+                queue_.push_back(ref);
+            }
+        }
+        startThreadsForQueue();
+    }
+    wake_.notify_all();
+}
+
+void BackgroundRefresher::cancelPending()
+{
+    const std::lock_guard lock{mutex_};
+    for (const std::string& ref : queue_)
+    {
+        pending_.erase(ref);
+    }
+    queue_.clear();
+}
+
+void BackgroundRefresher::stop()
+{
+    {
+        const std::lock_guard lock{mutex_};
+        isStopping_ = true;
+        queue_.clear();
+    }
+    wake_.notify_all();
+    for (std::thread& thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void BackgroundRefresher::startThreadsForQueue()
+{
+    // One thread per queued batch, up to the maximum.
+    const std::size_t numBatches = (queue_.size() + maxBatchSize_ - 1) / maxBatchSize_;
+    while (threads_.size() < std::min(numBatches, maxThreads_))
+    {
+        threads_.emplace_back(&BackgroundRefresher::run, this);
+    }
+}
+
+void BackgroundRefresher::run()
+{
+    std::unique_lock lock{mutex_};
+    while (true)
+    {
+        wake_.wait(lock, [this] { return isStopping_ || !queue_.empty(); });
+
+        // Allow further requests to accumulate, so that they can be
+        // refreshed in a single batch.
+        wake_.wait_for(
+            lock, batchDelay_, [this] { return isStopping_ || queue_.size() >= maxBatchSize_; });
+
+        if (isStopping_)
+        {
+            return;
+        }
+        if (queue_.empty())
+        {
+            // Cancelled whilst waiting.
+            continue;
+        }
+
+        const auto batchEnd =
+            std::next(queue_.begin(),
+                      static_cast<std::ptrdiff_t>(std::min(queue_.size(), maxBatchSize_)));
+        const std::vector<std::string> batch{std::make_move_iterator(queue_.begin()),
+                                             std::make_move_iterator(batchEnd)};
+        queue_.erase(queue_.begin(), batchEnd);
+
+        lock.unlock();
+        refresh_(batch);
+        lock.lock();
+
+        for (const std::string& ref : batch)
+        {
+            pending_.erase(ref);
+        }
+    }
+}
@@ -0,0 +1,99 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Refreshes cached data for entity references on background threads.
+ *
+ * Requests are de-duplicated and coalesced, such that the refresh
+ * function is called with batches of references, allowing a single
+ * manager round trip per batch.
+ *
+ * Worker threads are started as requests arrive, up to a maximum, so
+ * that no thread is created if refreshing is never required.
+ */
+class BackgroundRefresher
+{
+public:
+    /**
+     * Function to refresh a batch of references. Called on the worker
+     * thread. Must not throw.
+     */
+    using RefreshFn = std::function<void(const std::vector<std::string>&)>;
+
+    /**
+     * @param refresh Function to refresh a batch of references.
+     * @param maxBatchSize Maximum number of references per batch.
+     * @param batchDelay Time to wait for further requests to accumulate
+     * before refreshing a batch.
+     * @param maxThreads Maximum number of worker threads, i.e. batches
+     * refreshed concurrently.
+     */
+    BackgroundRefresher(RefreshFn refresh,
+                        std::size_t maxBatchSize,
+                        std::chrono::milliseconds batchDelay,
+                        std::size_t maxThreads = 1);
+
+    ~BackgroundRefresher();
+
+    BackgroundRefresher(const BackgroundRefresher&) = delete;
+    BackgroundRefresher& operator=(const BackgroundRefresher&) = delete;
+    BackgroundRefresher(BackgroundRefresher&&) = delete;
+    BackgroundRefresher& operator=(BackgroundRefresher&&) = delete;
+
+    /**
+     * Queue a reference for refresh, unless it is already queued or
+     * being refreshed.
+     */
+    void request(const std::string& ref);
+
+    /**
+     * Queue several references for refresh, skipping any already queued
+     * or being refreshed.
+     */
+    void request(const std::vector<std::string>& refs);
+
+    /**
+     * Discard queued requests. Batches already being refreshed are
+     * unaffected.
+     */
+    void cancelPending();
+
+    /**
+     * Discard queued requests and wait for worker threads to finish.
+     * No further requests are accepted.
+     */
+    void stop();
+
+private:
+    /// Must be called with mutex_ held.
+    void startThreadsForQueue();
+
+    void run();
+
+    const RefreshFn refresh_;
+    const std::size_t maxBatchSize_;
+    const std::chrono::milliseconds batchDelay_;
+    const std::size_t maxThreads_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    /// References awaiting refresh, in request order.
+    std::deque<std::string> queue_;
+    /// References queued or being refreshed.
+    std::unordered_set<std::string> pending_;
+    bool isStopping_{false};
+    std::vector<std::thread> threads_;
+};
@@ -0,0 +1,73 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "CacheMemoryBudget.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+// Entries sampled from each member per eviction. Larger samples
+// approximate LRU more closely, at the cost of slower eviction.
+constexpr std::size_t kNumSamples = 5;
+// Upper bound on eviction attempts per reclaim, so that a thread is
+// not held indefinitely whilst others continue to insert.
+constexpr std::size_t kMaxEvictionAttempts = 4096;
+}  // namespace
+
+CacheMemoryBudget::CacheMemoryBudget(const std::size_t limit) : limit_{limit} {}
+
+void CacheMemoryBudget::setLimit(const std::size_t limit)
+{
+    limit_.store(limit, std::memory_order_relaxed);
+    reclaim();
+}
+
+void CacheMemoryBudget::add(Member* member)
+{
+    const std::lock_guard lock{mutex_};
+    members_.push_back(member);
+}
+
+void CacheMemoryBudget::remove(Member* member)
+{
+    const std::lock_guard lock{mutex_};
+    members_.erase(std::remove(members_.begin(), members_.end(), member), members_.end());
+}
+
+void CacheMemoryBudget::reclaim()
+{
+    if (!isOverLimit())
+    {
+        return;
+    }
+    const std::unique_lock lock{mutex_, std::try_to_lock};
+    if (!lock.owns_lock())
+    {
+        return;
+    }
+
+    for (std::size_t attempt = 0; attempt < kMaxEvictionAttempts && isOverLimit(); ++attempt)
+    {
+        Member* victimMember = nullptr;
+        std::optional<EvictionCandidate> victim;
+        for (Member* member : members_)
+        {
+            auto candidate = member->sampleEvictionCandidate(kNumSamples);
+            if (candidate && (!victim || candidate->lastAccess < victim->lastAccess))
+            {
+                victim = std::move(candidate);
+                victimMember = member;
+            }
+        }
+        if (!victim)
+        {
+            return;
+        }
+        if (victimMember->evict(*victim))
+        {
+            evictions_.increment();
+        }
+    }
+}
@@ -0,0 +1,132 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Statistics.hpp"
+
+/**
+ * Number of bytes allocated on the heap by a string, excluding the
+ * string object itself.
+ */
+inline std::size_t heapBytes(const std::string& str)
+{
+    // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+    const auto* const objectBegin = reinterpret_cast<const char*>(&str);
+    const bool isSmallString = str.data() >= objectBegin && str.data() < objectBegin + sizeof(str);
+    return isSmallString ? 0 : str.capacity() + 1;
+}
+
+/**
+ * Memory budget shared by several caches.
+ *
+ * Caches report the bytes used by each entry as it is added and
+ * removed. Once the total exceeds the budget, entries are evicted from
+ * whichever cache holds the least recently used of a small sample of
+ * entries from each cache, until the total is back within budget. This
+ * approximates LRU eviction across all caches without maintaining a
+ * global recency list, which would otherwise need updating (and
+ * locking) on every lookup.
+ */
+class CacheMemoryBudget
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Entry proposed for eviction by a cache.
+     */
+    struct EvictionCandidate
+    {
+        std::string key;
+        /// Time of the last lookup of the entry, or the minimum time
+        /// point if the entry has expired.
+        Clock::time_point lastAccess;
+    };
+
+    /**
+     * Interface of a cache subject to the budget.
+     */
+    class Member
+    {
+    public:
+        virtual ~Member() = default;
+
+        /**
+         * Sample up to `numSamples` entries, returning the least
+         * recently used, if any.
+         *
+         * Should not block on contended locks.
+         */
+        virtual std::optional<EvictionCandidate> sampleEvictionCandidate(
+            std::size_t numSamples) = 0;
+
+        /**
+         * Evict an entry, unless it has been accessed since it was
+         * sampled.
+         *
+         * @return Whether the entry was evicted.
+         */
+        virtual bool evict(const EvictionCandidate& candidate) = 0;
+    };
+
+    /**
+     * @param limit Budget in bytes. 0 for unlimited.
+     */
+    explicit CacheMemoryBudget(std::size_t limit);
+
+    /**
+     * Set the budget, evicting entries if necessary.
+     *
+     * @param limit Budget in bytes. 0 for unlimited.
+     */
+    void setLimit(std::size_t limit);
+
+    [[nodiscard]] std::size_t limit() const { return limit_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] std::size_t usage() const { return usage_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] std::uint64_t evictions() const { return evictions_.value(); }
+
+    void add(Member* member);
+
+    void remove(Member* member);
+
+    /**
+     * Record bytes allocated or freed by a member.
+     */
+    void charge(std::size_t bytes) { usage_.fetch_add(bytes, std::memory_order_relaxed); }
+
+    void release(std::size_t bytes) { usage_.fetch_sub(bytes, std::memory_order_relaxed); }
+
+    /**
+     * Evict entries until usage is within budget.
+     *
+     * Members must not hold any of their own locks when calling this.
+     * If another thread is already evicting, returns immediately.
+     */
+    void reclaim();
+
+private:
+    [[nodiscard]] bool isOverLimit() const
+    {
+        const std::size_t limit = limit_.load(std::memory_order_relaxed);
+        return limit != 0 && usage_.load(std::memory_order_relaxed) > limit;
+    }
+
+    std::atomic<std::size_t> limit_;
+    std::atomic<std::size_t> usage_{0};
+    Counter evictions_;
+
+    std::mutex mutex_;
+    std::vector<Member*> members_;
+};
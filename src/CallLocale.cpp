@@ -0,0 +1,126 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "CallLocale.hpp"
+
+#include <cstdlib>
+#include <string_view>
+
+#include <Python.h>
+
+#include <katana_openassetio/traits/locale/BackgroundTrait.hpp>
+#include <katana_openassetio/traits/locale/BatchTrait.hpp>
+#include <katana_openassetio/traits/locale/InteractiveTrait.hpp>
+#include <katana_openassetio/traits/locale/LookupTrait.hpp>
+#include <katana_openassetio/traits/locale/PublishTrait.hpp>
+
+namespace
+{
+constexpr const char* kSessionModeEnvVar = "KATANAOPENASSETIO_SESSION_MODE";
+
+/**
+ * Session mode Katana was launched in, from its KATANA_UI_MODE
+ * configuration value, which is only set in UI mode, i.e. not for
+ * `--batch`, `--script` or `--shell`.
+ *
+ * Returns nullopt if not running in Katana, e.g. in standalone tools.
+ */
+std::optional<SessionMode> sessionModeFromKatana()
+{
+    if (!Py_IsInitialized())
+    {
+        return std::nullopt;
+    }
+    const PyGILState_STATE gilState = PyGILState_Ensure();
+
+    std::optional<SessionMode> sessionMode;
+    PyObject* pyKatana = PyImport_ImportModule("Katana");
+    PyObject* pyConfiguration =
+        pyKatana ? PyObject_GetAttrString(pyKatana, "Configuration") : nullptr;
+    PyObject* pyUiMode =
+        pyConfiguration ? PyObject_CallMethod(pyConfiguration, "get", "s", "KATANA_UI_MODE")
+                        : nullptr;
+    if (pyUiMode)
+    {
+        const char* uiMode = PyUnicode_Check(pyUiMode) ? PyUnicode_AsUTF8(pyUiMode) : nullptr;
+        const bool isUiMode = uiMode && *uiMode != '\0' && std::string_view{uiMode} != "0";
+        sessionMode = isUiMode ? SessionMode::kInteractive : SessionMode::kBatch;
+    }
+    // E.g. if not running in Katana, so the module is unavailable.
+    PyErr_Clear();
+    Py_XDECREF(pyUiMode);
+    Py_XDECREF(pyConfiguration);
+    Py_XDECREF(pyKatana);
+
+    PyGILState_Release(gilState);
+    return sessionMode;
+}
+
+bool hasDisplay()
+{
+#ifdef _WIN32
+    return true;
+#else
+    return std::getenv("DISPLAY") != nullptr || std::getenv("WAYLAND_DISPLAY") != nullptr;
+#endif
+}
+}  // namespace
+
+std::optional<SessionMode> parseSessionMode(const std::string_view name)
+{
+    if (name == "interactive")
+    {
+        return SessionMode::kInteractive;
+    }
+    if (name == "batch")
+    {
+        return SessionMode::kBatch;
+    }
+    return std::nullopt;
+}
+
+SessionMode sessionModeFromEnvironment()
+{
+    if (const char* envVarValue = std::getenv(kSessionModeEnvVar))
+    {
+        if (const auto sessionMode = parseSessionMode(envVarValue))
+        {
+            return *sessionMode;
+        }
+    }
+    if (const auto sessionMode = sessionModeFromKatana())
+    {
+        return *sessionMode;
+    }
+    return hasDisplay() ? SessionMode::kInteractive : SessionMode::kBatch;
+}
+
+openassetio::trait::TraitsDataPtr makeLocale(const Subsystem subsystem,
+                                             const SessionMode sessionMode)
+{
+    namespace locale = katana_openassetio::traits::locale;
+
+    auto traitsData = openassetio::trait::TraitsData::make();
+    switch (sessionMode)
+    {
+    case SessionMode::kInteractive:
+        locale::InteractiveTrait::imbueTo(traitsData);
+        break;
+    case SessionMode::kBatch:
+        locale::BatchTrait::imbueTo(traitsData);
+        break;
+    }
+    switch (subsystem)
+    {
+    case Subsystem::kLookup:
+        locale::LookupTrait::imbueTo(traitsData);
+        break;
+    case Subsystem::kPublish:
+        locale::PublishTrait::imbueTo(traitsData);
+        break;
+    case Subsystem::kBackground:
+        locale::BackgroundTrait::imbueTo(traitsData);
+        break;
+    }
+    return traitsData;
+}
@@ -0,0 +1,56 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <openassetio/trait/TraitsData.hpp>
+
+/**
+ * Part of the plugin making a call to the manager, described to the
+ * manager via the locale of the call's Context.
+ */
+enum class Subsystem : std::size_t
+{
+    /// Queries of existing entities, e.g. resolving paths.
+    kLookup,
+    /// Creation of new entities or versions.
+    kPublish,
+    /// Prefetching and refreshing of cached data.
+    kBackground
+};
+
+constexpr std::size_t kNumSubsystems = 3;
+
+/**
+ * Whether the Katana session has a user waiting on results.
+ */
+enum class SessionMode
+{
+    kInteractive,
+    kBatch
+};
+
+/**
+ * Parse a session mode from its name, i.e. "interactive" or "batch".
+ */
+std::optional<SessionMode> parseSessionMode(std::string_view name);
+
+/**
+ * Session mode given by the KATANAOPENASSETIO_SESSION_MODE environment
+ * variable. If unset or invalid, the session is interactive if Katana
+ * was launched in UI mode, and batch otherwise. Outside of Katana, the
+ * session is assumed to be batch if no display is available, and
+ * interactive otherwise.
+ */
+SessionMode sessionModeFromEnvironment();
+
+/**
+ * Locale describing calls from a subsystem in a session, imbued with
+ * traits from traits.yml.
+ */
+openassetio::trait::TraitsDataPtr makeLocale(Subsystem subsystem, SessionMode sessionMode);
@@ -0,0 +1,89 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "CallPatternPredictor.hpp"
+
+#include <mutex>
+
+namespace
+{
+/// Number of calls to a method after which its counts are halved.
+constexpr std::uint64_t kDecayInterval = 1024;
+}  // namespace
+
+CallPatternPredictor::CallPatternPredictor(const double threshold, const std::size_t minCalls)
+    : threshold_{threshold}, minCalls_{minCalls}
+{
+}
+
+void CallPatternPredictor::recordCall(const std::string_view method,
+                                      const openassetio::trait::TraitSet& traitSet)
+{
+    const std::unique_lock lock{mutex_};
+    auto methodIt = methodStats_.find(method);
+    if (methodIt == methodStats_.end())
+    {
+        methodIt = methodStats_.emplace(std::string{method}, MethodStats{}).first;
+    }
+    MethodStats& stats = methodIt->second;
+
+    if (++stats.calls >= kDecayInterval)
+    {
+        stats.calls /= 2;
+        for (auto& [successor, count] : stats.successorCounts)
+        {
+            count /= 2;
+        }
+    }
+    if (stats.traitSet != traitSet)
+    {
+        stats.traitSet = traitSet;
+    }
+}
+
+void CallPatternPredictor::recordSuccessor(const std::string_view previous,
+                                           const std::string_view next)
+{
+    const std::unique_lock lock{mutex_};
+    const auto methodIt = methodStats_.find(previous);
+    if (methodIt == methodStats_.end())
+    {
+        return;
+    }
+    auto& successorCounts = methodIt->second.successorCounts;
+    auto successorIt = successorCounts.find(next);
+    if (successorIt == successorCounts.end())
+    {
+        successorIt = successorCounts.emplace(std::string{next}, 0).first;
+    }
+    ++successorIt->second;
+}
+
+openassetio::trait::TraitSet CallPatternPredictor::predictTraits(
+    const std::string_view method) const
+{
+    openassetio::trait::TraitSet traitSet;
+
+    const std::shared_lock lock{mutex_};
+    const auto methodIt = methodStats_.find(method);
+    if (methodIt == methodStats_.end() || methodIt->second.calls < minCalls_)
+    {
+        return traitSet;
+    }
+    const MethodStats& stats = methodIt->second;
+
+    for (const auto& [successor, count] : stats.successorCounts)
+    {
+        if (static_cast<double>(count) < threshold_ * static_cast<double>(stats.calls))
+        {
+            continue;
+        }
+        if (const auto successorIt = methodStats_.find(successor);
+            successorIt != methodStats_.end())
+        {
+            traitSet.insert(successorIt->second.traitSet.begin(),
+                            successorIt->second.traitSet.end());
+        }
+    }
+    return traitSet;
+}
@@ -0,0 +1,69 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+#include <openassetio/trait/collection.hpp>
+
+/**
+ * Learns which API methods tend to follow each other for the same
+ * entity reference, and the traits each method needs, so that the
+ * traits needed by likely follow-up calls can be fetched speculatively
+ * in the same manager round trip.
+ *
+ * Counts are periodically halved, so that predictions adapt if call
+ * patterns change. Safe to use from any thread.
+ */
+class CallPatternPredictor
+{
+public:
+    /**
+     * @param threshold Fraction of calls to a method that must be
+     * followed by another method for that method's traits to be
+     * predicted.
+     * @param minCalls Number of calls to a method that must be observed
+     * before making predictions for it.
+     */
+    CallPatternPredictor(double threshold, std::size_t minCalls);
+
+    /**
+     * Record a call to a method that needs the given traits.
+     */
+    void recordCall(std::string_view method, const openassetio::trait::TraitSet& traitSet);
+
+    /**
+     * Record that a call to `next` followed a call to `previous` for
+     * the same entity reference.
+     */
+    void recordSuccessor(std::string_view previous, std::string_view next);
+
+    /**
+     * Traits likely to be needed by calls following a call to the given
+     * method, i.e. the union of the traits needed by its likely
+     * successors.
+     */
+    [[nodiscard]] openassetio::trait::TraitSet predictTraits(std::string_view method) const;
+
+private:
+    struct MethodStats
+    {
+        std::uint64_t calls{0};
+        /// Traits needed, as of the most recent call.
+        openassetio::trait::TraitSet traitSet;
+        std::map<std::string, std::uint64_t, std::less<>> successorCounts;
+    };
+
+    const double threshold_;
+    const std::size_t minCalls_;
+
+    mutable std::shared_mutex mutex_;
+    std::map<std::string, MethodStats, std::less<>> methodStats_;
+};
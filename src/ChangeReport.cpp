@@ -0,0 +1,66 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ChangeReport.hpp"
+
+#include <utility>
+
+void ChangeReport::begin(std::unordered_map<std::string, Result> previousResults)
+{
+    const std::lock_guard lock{mutex_};
+    isBegun_ = true;
+    pending_ = std::move(previousResults);
+    numChecked_ = 0;
+    changes_.clear();
+}
+
+bool ChangeReport::record(const std::string& ref, const Result& result)
+{
+    const std::lock_guard lock{mutex_};
+    return recordLocked(ref, &result);
+}
+
+bool ChangeReport::recordUnresolvable(const std::string& ref)
+{
+    const std::lock_guard lock{mutex_};
+    return recordLocked(ref, nullptr);
+}
+
+bool ChangeReport::isComplete() const
+{
+    const std::lock_guard lock{mutex_};
+    return isBegun_ && pending_.empty();
+}
+
+std::size_t ChangeReport::numChecked() const
+{
+    const std::lock_guard lock{mutex_};
+    return numChecked_;
+}
+
+std::vector<ReferenceChange> ChangeReport::changes() const
+{
+    const std::lock_guard lock{mutex_};
+    return changes_;
+}
+
+bool ChangeReport::recordLocked(const std::string& ref, const Result* result)
+{
+    const auto pendingIt = pending_.find(ref);
+    if (pendingIt == pending_.end())
+    {
+        return false;
+    }
+    Result& previous = pendingIt->second;
+    ++numChecked_;
+    if (result == nullptr || result->path != previous.path || result->version != previous.version)
+    {
+        changes_.push_back({ref,
+                            std::move(previous.path),
+                            result != nullptr ? result->path : std::string{},
+                            std::move(previous.version),
+                            result != nullptr ? result->version : std::string{}});
+    }
+    pending_.erase(pendingIt);
+    return pending_.empty();
+}
@@ -0,0 +1,88 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A reference that resolves differently to when it was last cached.
+ */
+struct ReferenceChange
+{
+    std::string entityReference;
+    std::string previousPath;
+    /// Empty if the reference is no longer resolvable.
+    std::string path;
+    std::string previousVersion;
+    std::string version;
+};
+
+/**
+ * Report of which references resolve differently to before a reset.
+ *
+ * A report is begun with the previous results of each reference, then
+ * completed as the current result of each is recorded, potentially
+ * from several threads concurrently. Only references whose path or
+ * stable version differ are retained in the report.
+ */
+class ChangeReport
+{
+public:
+    /**
+     * Result of resolving a reference.
+     */
+    struct Result
+    {
+        std::string path;
+        /// Stable version tag, if any.
+        std::string version;
+    };
+
+    /**
+     * Begin a new report, discarding any in progress.
+     *
+     * @param previousResults Results of each reference to check, as
+     * previously cached.
+     */
+    void begin(std::unordered_map<std::string, Result> previousResults);
+
+    /**
+     * Record the current result of a reference. References not awaiting
+     * a result, e.g. those recorded already or belonging to a previous
+     * report, are ignored.
+     *
+     * @return Whether this completed the report.
+     */
+    bool record(const std::string& ref, const Result& result);
+
+    /**
+     * Record that a reference can no longer be resolved.
+     *
+     * @return Whether this completed the report.
+     */
+    bool recordUnresolvable(const std::string& ref);
+
+    /// Whether a report has been begun and every reference recorded.
+    [[nodiscard]] bool isComplete() const;
+
+    /// Number of references recorded in the current report.
+    [[nodiscard]] std::size_t numChecked() const;
+
+    /// References found to have changed so far.
+    [[nodiscard]] std::vector<ReferenceChange> changes() const;
+
+private:
+    bool recordLocked(const std::string& ref, const Result* result);
+
+    mutable std::mutex mutex_;
+    bool isBegun_ = false;
+    /// Previous results of references awaiting their current result.
+    std::unordered_map<std::string, Result> pending_;
+    std::size_t numChecked_ = 0;
+    std::vector<ReferenceChange> changes_;
+};
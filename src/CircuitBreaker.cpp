@@ -0,0 +1,77 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "CircuitBreaker.hpp"
+
+#include <algorithm>
+
+CircuitBreaker::CircuitBreaker(const std::size_t failureThreshold,
+                               const std::chrono::milliseconds probeInterval)
+    : failureThreshold_{std::max<std::size_t>(failureThreshold, 1)}, probeInterval_{probeInterval}
+{
+}
+
+CircuitBreaker::Admission CircuitBreaker::admit()
+{
+    if (!isOpen_.load(std::memory_order_acquire))
+    {
+        return Admission::kAllowed;
+    }
+
+    const std::lock_guard lock{mutex_};
+    if (!isOpen_.load(std::memory_order_relaxed))
+    {
+        return Admission::kAllowed;
+    }
+    if (isProbing_ || Clock::now() < nextProbeAt_)
+    {
+        return Admission::kRejected;
+    }
+    isProbing_ = true;
+    return Admission::kProbe;
+}
+
+bool CircuitBreaker::recordSuccess()
+{
+    if (!isOpen_.load(std::memory_order_acquire) &&
+        consecutiveFailures_.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    const std::lock_guard lock{mutex_};
+    consecutiveFailures_.store(0, std::memory_order_relaxed);
+    isProbing_ = false;
+    return isOpen_.exchange(false, std::memory_order_release);
+}
+
+bool CircuitBreaker::recordFailure()
+{
+    const std::lock_guard lock{mutex_};
+    const Clock::time_point now = Clock::now();
+
+    if (isOpen_.load(std::memory_order_relaxed))
+    {
+        // Probe (or a call admitted before opening) failed, so wait
+        // for the next probe interval.
+        isProbing_ = false;
+        nextProbeAt_ = now + probeInterval_;
+        return false;
+    }
+
+    if (consecutiveFailures_.fetch_add(1, std::memory_order_relaxed) + 1 < failureThreshold_)
+    {
+        return false;
+    }
+    nextProbeAt_ = now + probeInterval_;
+    isOpen_.store(true, std::memory_order_release);
+    return true;
+}
+
+void CircuitBreaker::reset()
+{
+    const std::lock_guard lock{mutex_};
+    consecutiveFailures_.store(0, std::memory_order_relaxed);
+    isProbing_ = false;
+    isOpen_.store(false, std::memory_order_release);
+}
@@ -0,0 +1,79 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+/**
+ * Stops calls to a service that repeatedly fails to respond in time.
+ *
+ * After a number of consecutive failures the breaker "opens", and
+ * calls are rejected without being attempted. Once per probe interval,
+ * a single call is let through as a probe. If it succeeds, the breaker
+ * "closes" and calls resume.
+ *
+ * Checking a closed breaker does not lock.
+ */
+class CircuitBreaker
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Admission
+    {
+        /// Breaker is closed, call as normal.
+        kAllowed,
+        /// Breaker is open, but the call may be attempted as a probe.
+        kProbe,
+        /// Breaker is open, call must not be attempted.
+        kRejected
+    };
+
+    /**
+     * @param failureThreshold Number of consecutive failures that opens
+     * the breaker.
+     * @param probeInterval Time between probes whilst open.
+     */
+    CircuitBreaker(std::size_t failureThreshold, std::chrono::milliseconds probeInterval);
+
+    [[nodiscard]] Admission admit();
+
+    /**
+     * Record that an admitted call completed in time.
+     *
+     * @return Whether this closed the breaker.
+     */
+    bool recordSuccess();
+
+    /**
+     * Record that an admitted call failed to complete in time.
+     *
+     * @return Whether this opened the breaker.
+     */
+    bool recordFailure();
+
+    /**
+     * Close the breaker and forget previous failures, e.g. when the
+     * service is replaced.
+     */
+    void reset();
+
+    [[nodiscard]] std::chrono::milliseconds probeInterval() const { return probeInterval_; }
+
+private:
+    const std::size_t failureThreshold_;
+    const std::chrono::milliseconds probeInterval_;
+
+    // Allow the common case of a closed breaker with no recent failures
+    // to be checked without locking.
+    std::atomic<bool> isOpen_{false};
+    std::atomic<std::size_t> consecutiveFailures_{0};
+
+    std::mutex mutex_;
+    Clock::time_point nextProbeAt_;
+    bool isProbing_{false};
+};
@@ -0,0 +1,67 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "DeadlineExecutor.hpp"
+
+#include <algorithm>
+
+DeadlineExecutor::DeadlineExecutor(const std::size_t maxThreads)
+    : maxThreads_{std::max<std::size_t>(maxThreads, 1)}
+{
+}
+
+DeadlineExecutor::~DeadlineExecutor()
+{
+    const std::lock_guard lock{state_->mutex};
+    state_->isStopping = true;
+    // Abandon queued tasks. Any callers still waiting will see a broken
+    // promise.
+    state_->tasks.clear();
+    state_->wake.notify_all();
+    // Tasks in progress may never return, so don't wait for them.
+    for (std::thread& thread : threads_)
+    {
+        thread.detach();
+    }
+}
+
+void DeadlineExecutor::enqueue(std::function<void()> task)
+{
+    {
+        const std::lock_guard lock{state_->mutex};
+        state_->tasks.push_back(std::move(task));
+
+        // Only grow the pool if every worker is busy, e.g. blocked on an
+        // unresponsive manager.
+        if (state_->numIdleThreads == 0 && threads_.size() < maxThreads_)
+        {
+            threads_.emplace_back(&DeadlineExecutor::run, state_);
+            return;
+        }
+    }
+    state_->wake.notify_one();
+}
+
+void DeadlineExecutor::run(const std::shared_ptr<SharedState>& state)
+{
+    std::unique_lock lock{state->mutex};
+    while (true)
+    {
+        ++state->numIdleThreads;
+        state->wake.wait(lock, [&] { return state->isStopping || !state->tasks.empty(); });
+        --state->numIdleThreads;
+
+        if (state->isStopping)
+        {
+            return;
+        }
+
+        std::function<void()> task = std::move(state->tasks.front());
+        state->tasks.pop_front();
+
+        lock.unlock();
+        // Exceptions are captured by the packaged task.
+        task();
+        lock.lock();
+    }
+}
@@ -0,0 +1,100 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Error raised when a call is abandoned because it did not complete
+ * within its deadline, or was not attempted because previous calls
+ * have not.
+ */
+class DeadlineExceededError : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * Pool of worker threads that run tasks on behalf of callers that wait
+ * for the result with a deadline.
+ *
+ * A caller that gives up waiting simply discards the returned future,
+ * leaving the task to finish in the background. Tasks must therefore
+ * own (i.e. capture by value) everything they use.
+ *
+ * Worker threads are started on demand, up to a maximum. Since tasks
+ * may never complete (e.g. a hung network request), workers are
+ * detached rather than joined on destruction.
+ *
+ * Queued tasks are discarded on destruction, releasing everything they
+ * captured. A task already running keeps what it captured until it
+ * returns, which may be after the executor's owner is destroyed, or
+ * never. E.g. a task calling a hung Python manager keeps the manager
+ * alive, and may still be running as the interpreter is finalised at
+ * exit.
+ */
+class DeadlineExecutor
+{
+public:
+    /**
+     * @param maxThreads Maximum number of worker threads.
+     */
+    explicit DeadlineExecutor(std::size_t maxThreads);
+
+    ~DeadlineExecutor();
+
+    DeadlineExecutor(const DeadlineExecutor&) = delete;
+    DeadlineExecutor& operator=(const DeadlineExecutor&) = delete;
+    DeadlineExecutor(DeadlineExecutor&&) = delete;
+    DeadlineExecutor& operator=(DeadlineExecutor&&) = delete;
+
+    /**
+     * Queue a task to run on a worker thread.
+     *
+     * @return Future holding the task's result or exception.
+     */
+    template <class Fn>
+    [[nodiscard]] std::future<std::invoke_result_t<Fn>> submit(Fn task)
+    {
+        auto packagedTask =
+            std::make_shared<std::packaged_task<std::invoke_result_t<Fn>()>>(std::move(task));
+        auto future = packagedTask->get_future();
+        enqueue([packagedTask = std::move(packagedTask)] { (*packagedTask)(); });
+        return future;
+    }
+
+private:
+    /**
+     * State shared with worker threads, which may outlive the executor.
+     */
+    struct SharedState
+    {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::deque<std::function<void()>> tasks;
+        std::size_t numIdleThreads{0};
+        bool isStopping{false};
+    };
+
+    void enqueue(std::function<void()> task);
+
+    static void run(const std::shared_ptr<SharedState>& state);
+
+    const std::size_t maxThreads_;
+    const std::shared_ptr<SharedState> state_{std::make_shared<SharedState>()};
+    /// Guarded by state_->mutex.
+    std::vector<std::thread> threads_;
+};
@@ -0,0 +1,281 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "DirectoryScanCache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <sys/statfs.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef __linux__
+// Changes to a directory's entries that affect its listing, plus the
+// directory itself going away.
+constexpr std::uint32_t kWatchMask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                     IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+// Filesystem types (`statfs` magic numbers) for which inotify does not
+// report changes made by other hosts.
+constexpr std::array<std::uint32_t, 9> kRemoteFilesystemTypes{
+    0x6969,      // NFS
+    0x517B,      // SMB
+    0xFF534D42,  // CIFS
+    0xFE534D42,  // SMB2
+    0x65735546,  // FUSE
+    0x00C36400,  // Ceph
+    0x0BD00BD0,  // Lustre
+    0x47504653,  // GPFS
+    0x5346414F,  // AFS
+};
+
+bool isRemoteFilesystem(const std::string& directory)
+{
+    struct statfs info{};
+    if (statfs(directory.c_str(), &info) != 0)
+    {
+        // Assume the worst.
+        return true;
+    }
+    return std::find(kRemoteFilesystemTypes.begin(),
+                     kRemoteFilesystemTypes.end(),
+                     static_cast<std::uint32_t>(info.f_type)) != kRemoteFilesystemTypes.end();
+}
+#endif
+}  // namespace
+
+DirectoryScanCache::DirectoryScanCache(const std::size_t maxDirectories)
+    : maxDirectories_{maxDirectories}
+{
+#ifdef __linux__
+    if (maxDirectories_ != 0)
+    {
+        // Failure (e.g. the per-user instance limit is reached) leaves
+        // all directories to be validated by mtime.
+        inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    }
+#endif
+}
+
+DirectoryScanCache::~DirectoryScanCache()
+{
+#ifdef __linux__
+    if (inotifyFd_ != -1)
+    {
+        close(inotifyFd_);
+    }
+#endif
+}
+
+void DirectoryScanCache::forEachFile(const std::filesystem::path& directory,
+                                     const std::function<void(std::string_view)>& fn)
+{
+    if (maxDirectories_ == 0)
+    {
+        std::unordered_set<std::string> files;
+        scan(directory, files);
+        stats_.scans.increment();
+        std::for_each(files.begin(), files.end(), fn);
+        return;
+    }
+
+    const std::string key = directory.string();
+    const std::lock_guard lock{mutex_};
+    applyEvents();
+
+    if (const auto directoryIt = directories_.find(key); directoryIt != directories_.end())
+    {
+        Directory& cached = directoryIt->second;
+        if (cached.watch != -1 || std::filesystem::last_write_time(directory) == cached.mtime)
+        {
+            stats_.hits.increment();
+            lru_.splice(lru_.begin(), lru_, cached.lruIt);
+            std::for_each(cached.files.begin(), cached.files.end(), fn);
+            return;
+        }
+        // Modified since last scanned.
+        erase(directoryIt);
+    }
+
+    if (directories_.size() >= maxDirectories_)
+    {
+        erase(directories_.find(lru_.back()));
+        stats_.evictions.increment();
+    }
+
+    Directory cached;
+    // Watch before scanning, so that no change is missed in between.
+    // Changes during the scan may then be applied twice, which is
+    // harmless.
+    cached.watch = addWatch(key);
+    try
+    {
+        // Likewise, read the mtime before scanning, so that changes
+        // during the scan cause a rescan next time.
+        cached.mtime = std::filesystem::last_write_time(directory);
+        scan(directory, cached.files);
+    }
+    catch (...)
+    {
+#ifdef __linux__
+        if (cached.watch != -1)
+        {
+            inotify_rm_watch(inotifyFd_, cached.watch);
+        }
+#endif
+        throw;
+    }
+    stats_.scans.increment();
+
+    lru_.push_front(key);
+    cached.lruIt = lru_.begin();
+    if (cached.watch != -1)
+    {
+        watches_.emplace(cached.watch, key);
+    }
+    const Directory& inserted = directories_.emplace(key, std::move(cached)).first->second;
+    std::for_each(inserted.files.begin(), inserted.files.end(), fn);
+}
+
+std::size_t DirectoryScanCache::size() const
+{
+    const std::lock_guard lock{mutex_};
+    return directories_.size();
+}
+
+std::size_t DirectoryScanCache::numWatched() const
+{
+    const std::lock_guard lock{mutex_};
+    return watches_.size();
+}
+
+void DirectoryScanCache::applyEvents()
+{
+#ifdef __linux__
+    if (inotifyFd_ == -1)
+    {
+        return;
+    }
+
+    alignas(inotify_event) std::array<char, 16 * 1024> buffer{};
+    for (;;)
+    {
+        // Non-blocking, so fails with EAGAIN once no events remain.
+        const ssize_t length = read(inotifyFd_, buffer.data(), buffer.size());
+        if (length <= 0)
+        {
+            return;
+        }
+
+        for (std::size_t offset = 0; offset < static_cast<std::size_t>(length);)
+        {
+            // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if ((event->mask & IN_Q_OVERFLOW) != 0)
+            {
+                // Events were lost, so no watched listing can be
+                // trusted.
+                for (auto directoryIt = directories_.begin(); directoryIt != directories_.end();)
+                {
+                    auto nextIt = std::next(directoryIt);
+                    if (directoryIt->second.watch != -1)
+                    {
+                        erase(directoryIt);
+                    }
+                    directoryIt = nextIt;
+                }
+                continue;
+            }
+
+            const auto watchIt = watches_.find(event->wd);
+            if (watchIt == watches_.end())
+            {
+                // Unwatched since.
+                continue;
+            }
+            const auto directoryIt = directories_.find(watchIt->second);
+
+            if ((event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED | IN_UNMOUNT)) != 0)
+            {
+                erase(directoryIt);
+                continue;
+            }
+            if ((event->mask & IN_ISDIR) != 0 || event->len == 0)
+            {
+                continue;
+            }
+
+            // Null terminated, and possibly padded with further nulls.
+            std::string name{static_cast<const char*>(event->name)};
+            if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+            {
+                directoryIt->second.files.insert(std::move(name));
+            }
+            else
+            {
+                directoryIt->second.files.erase(name);
+            }
+            stats_.events.increment();
+        }
+    }
+#endif
+}
+
+int DirectoryScanCache::addWatch([[maybe_unused]] const std::string& directory)
+{
+#ifdef __linux__
+    if (inotifyFd_ == -1 || isRemoteFilesystem(directory))
+    {
+        return -1;
+    }
+    // Fails if the watch limit (fs.inotify.max_user_watches) is
+    // reached.
+    const int watch = inotify_add_watch(inotifyFd_, directory.c_str(), kWatchMask);
+    if (watch == -1 || watches_.count(watch) != 0)
+    {
+        // Already watched via another path to the same directory, in
+        // which case the watch belongs to that entry.
+        return -1;
+    }
+    return watch;
+#else
+    return -1;
+#endif
+}
+
+void DirectoryScanCache::erase(const Directories::iterator directoryIt)
+{
+#ifdef __linux__
+    if (const int watch = directoryIt->second.watch; watch != -1)
+    {
+        watches_.erase(watch);
+        // Fails harmlessly if the kernel has already removed the watch,
+        // e.g. as the directory was deleted.
+        inotify_rm_watch(inotifyFd_, watch);
+    }
+#endif
+    lru_.erase(directoryIt->second.lruIt);
+    directories_.erase(directoryIt);
+}
+
+void DirectoryScanCache::scan(const std::filesystem::path& directory,
+                              std::unordered_set<std::string>& files)
+{
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        if (entry.is_regular_file())
+        {
+            files.insert(entry.path().filename().string());
+        }
+    }
+}
@@ -0,0 +1,123 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Statistics.hpp"
+
+/**
+ * Counts of directory listings, by how they were served.
+ */
+struct DirectoryScanStats
+{
+    /// Listings read from the filesystem.
+    Counter scans;
+    /// Listings served from the cache.
+    Counter hits;
+    /// Changes applied to cached listings from inotify events.
+    Counter events;
+    /// Cached listings evicted to stay within the directory limit.
+    Counter evictions;
+};
+
+/**
+ * Caches the regular files in directories, e.g. for finding the frames
+ * of a file sequence, whilst other processes (renders) continue to
+ * write to them.
+ *
+ * On Linux, cached directories are watched with inotify, and their
+ * listings updated as files are created, renamed or deleted, without
+ * rescanning. Pending events are applied before each lookup, so a
+ * listing reflects all changes completed before the call.
+ *
+ * Elsewhere, or where inotify does not report changes made by other
+ * hosts (network filesystems such as NFS), or no more watches can be
+ * added, a listing is instead rescanned if the directory's
+ * modification time has changed.
+ *
+ * The number of cached directories, and hence watches, is bounded,
+ * with the least recently used evicted.
+ */
+class DirectoryScanCache
+{
+public:
+    /**
+     * @param maxDirectories Maximum number of directories to cache. 0
+     * disables caching, such that every lookup scans the directory.
+     */
+    explicit DirectoryScanCache(std::size_t maxDirectories);
+
+    ~DirectoryScanCache();
+
+    DirectoryScanCache(const DirectoryScanCache&) = delete;
+    DirectoryScanCache& operator=(const DirectoryScanCache&) = delete;
+    DirectoryScanCache(DirectoryScanCache&&) = delete;
+    DirectoryScanCache& operator=(DirectoryScanCache&&) = delete;
+
+    /**
+     * Call a function with the name of each regular file in a
+     * directory, in no particular order.
+     *
+     * The function is called whilst holding a lock, so must not call
+     * back into the cache.
+     *
+     * @throws std::filesystem::filesystem_error If the directory cannot
+     * be read.
+     */
+    void forEachFile(const std::filesystem::path& directory,
+                     const std::function<void(std::string_view)>& fn);
+
+    /// Number of directories cached.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Number of cached directories watched for changes.
+    [[nodiscard]] std::size_t numWatched() const;
+
+    [[nodiscard]] const DirectoryScanStats& stats() const { return stats_; }
+
+private:
+    struct Directory
+    {
+        std::unordered_set<std::string> files;
+        /// inotify watch descriptor, or -1 if validated by mtime.
+        int watch = -1;
+        std::filesystem::file_time_type mtime;
+        std::list<std::string>::iterator lruIt;
+    };
+    using Directories = std::unordered_map<std::string, Directory>;
+
+    /// Apply pending inotify events. Must be called with mutex_ held.
+    void applyEvents();
+
+    /// Watch a directory, returning the watch descriptor, or -1 if it
+    /// should be validated by mtime instead.
+    int addWatch(const std::string& directory);
+
+    /// Must be called with mutex_ held.
+    void erase(Directories::iterator directoryIt);
+
+    static void scan(const std::filesystem::path& directory,
+                     std::unordered_set<std::string>& files);
+
+    const std::size_t maxDirectories_;
+    /// inotify instance, or -1 if unsupported.
+    int inotifyFd_ = -1;
+
+    mutable std::mutex mutex_;
+    Directories directories_;
+    /// Watched directory for each watch descriptor.
+    std::unordered_map<int, std::string> watches_;
+    /// Most recently used first.
+    std::list<std::string> lru_;
+    DirectoryScanStats stats_;
+};
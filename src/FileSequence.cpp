@@ -0,0 +1,132 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "FileSequence.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <system_error>
+
+namespace
+{
+/**
+ * Parse an integer at the start of `str`, consuming it.
+ */
+int consumeInt(std::string_view& str, const std::string_view item)
+{
+    int value = 0;
+    const auto [end, errc] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (errc != std::errc{})
+    {
+        throw std::invalid_argument{"Invalid frame list item: " + std::string{item}};
+    }
+    str.remove_prefix(static_cast<std::size_t>(end - str.data()));
+    return value;
+}
+
+std::string_view trim(std::string_view str)
+{
+    const std::size_t begin = str.find_first_not_of(' ');
+    if (begin == std::string_view::npos)
+    {
+        return {};
+    }
+    return str.substr(begin, str.find_last_not_of(' ') - begin + 1);
+}
+}  // namespace
+
+std::optional<FileSequenceTemplate> FileSequenceTemplate::parse(const std::string_view path)
+{
+    const std::size_t begin = path.find('#');
+    if (begin == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+    std::size_t end = path.find_first_not_of('#', begin);
+    if (end == std::string_view::npos)
+    {
+        end = path.size();
+    }
+    if (path.find('#', end) != std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+    return FileSequenceTemplate{path.substr(0, begin), end - begin, path.substr(end)};
+}
+
+FileSequenceTemplate::FileSequenceTemplate(const std::string_view prefix,
+                                           const std::size_t padding,
+                                           const std::string_view suffix)
+    : prefix_{prefix}, padding_{padding}, suffix_{suffix}
+{
+}
+
+std::string FileSequenceTemplate::path(const int frame) const
+{
+    std::array<char, 16> digits{};
+    const auto [digitsEnd, errc] =
+        std::to_chars(digits.data(), digits.data() + digits.size(), frame);
+    (void)errc;  // Buffer is large enough for any int.
+    const std::string_view frameStr{digits.data(),
+                                    static_cast<std::size_t>(digitsEnd - digits.data())};
+    const std::size_t numZeros = frameStr.size() < padding_ ? padding_ - frameStr.size() : 0;
+
+    std::string path;
+    path.reserve(prefix_.size() + numZeros + frameStr.size() + suffix_.size());
+    path += prefix_;
+    path.append(numZeros, '0');
+    path += frameStr;
+    path += suffix_;
+    return path;
+}
+
+std::vector<int> parseFrameList(const std::string_view frames, const std::size_t maxFrames)
+{
+    std::vector<int> result;
+
+    std::size_t itemBegin = 0;
+    while (itemBegin <= frames.size())
+    {
+        std::size_t itemEnd = frames.find(',', itemBegin);
+        if (itemEnd == std::string_view::npos)
+        {
+            itemEnd = frames.size();
+        }
+        const std::string_view item = trim(frames.substr(itemBegin, itemEnd - itemBegin));
+        itemBegin = itemEnd + 1;
+
+        std::string_view remaining = item;
+        const int first = consumeInt(remaining, item);
+        int last = first;
+        int step = 1;
+        if (!remaining.empty() && remaining.front() == '-')
+        {
+            remaining.remove_prefix(1);
+            last = consumeInt(remaining, item);
+            if (!remaining.empty() && remaining.front() == 'x')
+            {
+                remaining.remove_prefix(1);
+                step = consumeInt(remaining, item);
+            }
+        }
+        if (!remaining.empty() || last < first || step < 1)
+        {
+            throw std::invalid_argument{"Invalid frame list item: " + std::string{item}};
+        }
+
+        const auto numFrames =
+            static_cast<std::size_t>((static_cast<std::int64_t>(last) - first) / step + 1);
+        if (numFrames > maxFrames - result.size())
+        {
+            throw std::invalid_argument{"Frame list exceeds " + std::to_string(maxFrames) +
+                                        " frames"};
+        }
+        for (std::int64_t frame = first; frame <= last; frame += step)
+        {
+            result.push_back(static_cast<int>(frame));
+        }
+    }
+    return result;
+}
@@ -0,0 +1,52 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * File sequence path with a single run of '#' frame number
+ * placeholders, e.g. "/path/to/image.####.exr", parsed once so that
+ * paths for many frames can be generated cheaply.
+ *
+ * Frame numbers are zero-padded to the width of the placeholder.
+ */
+class FileSequenceTemplate
+{
+public:
+    /**
+     * Parse a file sequence path.
+     *
+     * @return Template, or nullopt if the path does not contain exactly
+     * one run of '#' characters.
+     */
+    [[nodiscard]] static std::optional<FileSequenceTemplate> parse(std::string_view path);
+
+    /**
+     * Path to the file for a given frame.
+     */
+    [[nodiscard]] std::string path(int frame) const;
+
+private:
+    FileSequenceTemplate(std::string_view prefix, std::size_t padding, std::string_view suffix);
+
+    std::string prefix_;
+    std::size_t padding_;
+    std::string suffix_;
+};
+
+/**
+ * Parse a list of frames, e.g. "1001-1100", "1,5,10-20" or "1-99x2".
+ *
+ * Comma-separated items are either single frames or inclusive ranges,
+ * with an optional step. Frames are returned in the order given.
+ *
+ * @throws std::invalid_argument If the list is malformed or expands to
+ * more than `maxFrames` frames.
+ */
+std::vector<int> parseFrameList(std::string_view frames, std::size_t maxFrames);
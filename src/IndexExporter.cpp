@@ -0,0 +1,209 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "IndexExporter.hpp"
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/hostApi/EntityReferencePager.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include <openassetio_mediacreation/specifications/lifecycle/EntityVersionsRelationshipSpecification.hpp>
+
+#include "ResolutionIndex.hpp"
+
+namespace
+{
+using openassetio::errors::BatchElementError;
+using openassetio::trait::TraitSet;
+using openassetio::trait::TraitsDataPtr;
+
+/**
+ * Entity awaiting export.
+ */
+struct PendingEntity
+{
+    std::string entityReference;
+    /// Position of the entity this is a version of, in the pending
+    /// list, if discovered as a version.
+    std::optional<std::size_t> versionOf;
+};
+}  // namespace
+
+IndexExportResult exportResolutionIndex(const openassetio::hostApi::ManagerPtr& manager,
+                                        const openassetio::ContextPtr& context,
+                                        const std::vector<std::string>& entityReferences,
+                                        const std::string& path,
+                                        const std::size_t batchSize)
+{
+    using openassetio::access::EntityTraitsAccess;
+    using openassetio::access::RelationsAccess;
+    using openassetio::access::ResolveAccess;
+    using openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
+    using openassetio::hostApi::EntityReferencePagerPtr;
+    using openassetio::hostApi::Manager;
+    using openassetio_mediacreation::specifications::lifecycle::
+        EntityVersionsRelationshipSpecification;
+
+    const bool hasVersions = manager->hasCapability(Manager::Capability::kRelationshipQueries);
+    const TraitsDataPtr versionsRelationship =
+        EntityVersionsRelationshipSpecification::create().traitsData();
+
+    // Grows as versions are discovered, so that they are exported in
+    // subsequent batches.
+    std::vector<PendingEntity> pending;
+    std::unordered_set<std::string> seen;
+    for (const std::string& entityReference : entityReferences)
+    {
+        if (seen.insert(entityReference).second &&
+            manager->isEntityReferenceString(entityReference))
+        {
+            pending.push_back({entityReference, std::nullopt});
+        }
+    }
+
+    // Versions of each pending entity, shared by each of the versions.
+    std::vector<std::vector<std::string>> versions(pending.size());
+    std::vector<IndexedEntity> entities;
+    IndexExportResult result;
+
+    for (std::size_t batchStart = 0; batchStart < pending.size(); batchStart += batchSize)
+    {
+        const std::size_t batchEnd = std::min(pending.size(), batchStart + batchSize);
+        const std::size_t numInBatch = batchEnd - batchStart;
+        versions.resize(pending.size());
+
+        openassetio::EntityReferences batch;
+        batch.reserve(numInBatch);
+        for (std::size_t idx = batchStart; idx < batchEnd; ++idx)
+        {
+            batch.push_back(manager->createEntityReference(pending[idx].entityReference));
+        }
+
+        std::vector<std::optional<TraitSet>> traitSets(numInBatch);
+        manager->entityTraits(
+            batch,
+            EntityTraitsAccess::kRead,
+            context,
+            [&](const std::size_t idx, TraitSet traitSet) { traitSets[idx] = std::move(traitSet); },
+            [](const std::size_t, const BatchElementError&) {});
+
+        // Resolve entities with the same traits together, keyed by the
+        // sorted trait IDs.
+        std::map<std::vector<std::string>, std::vector<std::size_t>> traitSetGroups;
+        for (std::size_t idx = 0; idx < numInBatch; ++idx)
+        {
+            if (traitSets[idx])
+            {
+                std::vector<std::string> key{traitSets[idx]->begin(), traitSets[idx]->end()};
+                std::sort(key.begin(), key.end());
+                traitSetGroups[std::move(key)].push_back(idx);
+            }
+        }
+
+        std::vector<TraitsDataPtr> traitsDatas(numInBatch);
+        for (const auto& [traitIds, group] : traitSetGroups)
+        {
+            openassetio::EntityReferences groupRefs;
+            groupRefs.reserve(group.size());
+            for (const std::size_t idx : group)
+            {
+                groupRefs.push_back(batch[idx]);
+            }
+            manager->resolve(
+                groupRefs,
+                TraitSet{traitIds.begin(), traitIds.end()},
+                ResolveAccess::kRead,
+                context,
+                [&](const std::size_t idx, TraitsDataPtr traitsData)
+                { traitsDatas[group[idx]] = std::move(traitsData); },
+                [](const std::size_t, const BatchElementError&) {});
+        }
+
+        if (hasVersions)
+        {
+            // Only entities given explicitly are queried, as versions of
+            // a version are the same set.
+            openassetio::EntityReferences versionQueryRefs;
+            std::vector<std::size_t> versionQueryIdxs;
+            for (std::size_t idx = 0; idx < numInBatch; ++idx)
+            {
+                if (traitsDatas[idx] && !pending[batchStart + idx].versionOf)
+                {
+                    versionQueryRefs.push_back(batch[idx]);
+                    versionQueryIdxs.push_back(batchStart + idx);
+                }
+            }
+            // Not all entities are versioned, so errors are expected.
+            manager->getWithRelationship(
+                versionQueryRefs,
+                versionsRelationship,
+                batchSize,
+                RelationsAccess::kRead,
+                context,
+                [&](const std::size_t idx, const EntityReferencePagerPtr& pager)
+                {
+                    std::vector<std::string>& entityVersions = versions[versionQueryIdxs[idx]];
+                    openassetio::EntityReferences page;
+                    while (!(page = pager->get()).empty())
+                    {
+                        for (const openassetio::EntityReference& version : page)
+                        {
+                            entityVersions.push_back(version.toString());
+                        }
+                        pager->next();
+                    }
+                },
+                [](const std::size_t, const BatchElementError&) {});
+        }
+
+        for (std::size_t idx = 0; idx < numInBatch; ++idx)
+        {
+            const PendingEntity& entity = pending[batchStart + idx];
+            if (!traitsDatas[idx])
+            {
+                ++result.numFailed;
+                continue;
+            }
+            // Resolution only includes traits with properties, whereas
+            // entityTraits should report all of them.
+            traitsDatas[idx]->addTraits(*traitSets[idx]);
+
+            const std::size_t versionsIdx = entity.versionOf.value_or(batchStart + idx);
+            entities.push_back({entity.entityReference, traitsDatas[idx], versions[versionsIdx]});
+
+            for (const std::string& version : versions[versionsIdx])
+            {
+                if (seen.insert(version).second)
+                {
+                    pending.push_back({version, versionsIdx});
+                }
+            }
+        }
+    }
+
+    std::string prefix;
+    const auto info = manager->info();
+    // NOLINTNEXTLINE(*-suspicious-stringview-data-usage)
+    if (const auto prefixIt = info.find(kInfoKey_EntityReferencesMatchPrefix.data());
+        prefixIt != info.end())
+    {
+        if (const auto* prefixStr = std::get_if<openassetio::Str>(&prefixIt->second))
+        {
+            prefix = *prefixStr;
+        }
+    }
+
+    result.numEntities = entities.size();
+    writeResolutionIndex(path, std::move(entities), prefix);
+    return result;
+}
@@ -0,0 +1,46 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+
+/**
+ * Outcome of exportResolutionIndex.
+ */
+struct IndexExportResult
+{
+    /// Entities written to the index, including discovered versions.
+    std::size_t numEntities = 0;
+    /// Entities omitted from the index as they could not be resolved.
+    std::size_t numFailed = 0;
+};
+
+/**
+ * Write a resolution index (see ResolutionIndex) of the given entities,
+ * as read from a live manager, for serving by the index manager plugin
+ * in processes that must not contact the manager, e.g. on a render
+ * farm.
+ *
+ * Each entity's traits are queried, then resolved, grouped by trait
+ * set, along with references to each of its versions, if the manager
+ * supports relationship queries. Versions are themselves indexed, so
+ * that queries for a specific version can be served. Queries are made
+ * in batches of the given size.
+ *
+ * Entities that cannot be resolved are omitted, so fail to resolve
+ * when served from the index, as they would have from the manager.
+ *
+ * @throws std::exception On failure of a manager query as a whole, or
+ * to write the index.
+ */
+IndexExportResult exportResolutionIndex(const openassetio::hostApi::ManagerPtr& manager,
+                                        const openassetio::ContextPtr& context,
+                                        const std::vector<std::string>& entityReferences,
+                                        const std::string& path,
+                                        std::size_t batchSize);
@@ -0,0 +1,518 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+//
+// Read-only OpenAssetIO manager plugin, serving queries from a
+// resolution index file, see ResolutionIndex.
+//
+// Intended for render farms, where processes resolve the same
+// references as the submitting session, but should not load the
+// submitting session's manager, nor add to its service's load. The
+// index is written by the `exportResolutionIndex` plugin command, then
+// served by configuring OpenAssetIO with e.g.
+//
+//   [manager]
+//   identifier = "com.foundry.katanaopenassetio.index"
+//
+//   [manager.settings]
+//   index_path = "/path/to/shot.koaindex"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/pluginSystem/CppPluginSystemManagerPlugin.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include <openassetio_mediacreation/specifications/lifecycle/EntityVersionsRelationshipSpecification.hpp>
+#include <openassetio_mediacreation/traits/lifecycle/VersionTrait.hpp>
+#include <openassetio_mediacreation/traits/managementPolicy/ManagedTrait.hpp>
+
+#include "ResolutionIndex.hpp"
+
+#ifdef _WIN32
+#define KATANAOPENASSETIO_INDEX_EXPORT __declspec(dllexport)
+#else
+#define KATANAOPENASSETIO_INDEX_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace
+{
+using openassetio::ContextConstPtr;
+using openassetio::EntityReference;
+using openassetio::EntityReferences;
+using openassetio::errors::BatchElementError;
+using openassetio::managerApi::HostSessionPtr;
+using openassetio::trait::TraitSet;
+using openassetio::trait::TraitsDataPtr;
+using openassetio::trait::TraitsDatas;
+
+constexpr std::string_view kIdentifier = "com.foundry.katanaopenassetio.index";
+constexpr std::string_view kIndexPathSetting = "index_path";
+
+using ResolutionIndexPtr = std::shared_ptr<const ResolutionIndex>;
+
+/**
+ * Pager over related references held in the index.
+ *
+ * Holds the index, so that the references remain mapped should the
+ * manager switch to a new index whilst paging.
+ */
+class IndexEntityReferencePager final
+    : public openassetio::managerApi::EntityReferencePagerInterface
+{
+public:
+    IndexEntityReferencePager(ResolutionIndexPtr index,
+                              std::vector<std::string_view> entityReferences,
+                              const std::size_t pageSize)
+        : index_{std::move(index)},
+          entityReferences_{std::move(entityReferences)},
+          pageSize_{std::max<std::size_t>(pageSize, 1)}
+    {
+    }
+
+    bool hasNext(const HostSessionPtr&) override
+    {
+        return position_ + pageSize_ < entityReferences_.size();
+    }
+
+    EntityReferences get(const HostSessionPtr&) override
+    {
+        EntityReferences page;
+        const std::size_t end = std::min(position_ + pageSize_, entityReferences_.size());
+        for (std::size_t idx = position_; idx < end; ++idx)
+        {
+            page.emplace_back(std::string{entityReferences_[idx]});
+        }
+        return page;
+    }
+
+    void next(const HostSessionPtr&) override
+    {
+        position_ = std::min(position_ + pageSize_, entityReferences_.size());
+    }
+
+private:
+    ResolutionIndexPtr index_;
+    std::vector<std::string_view> entityReferences_;
+    std::size_t pageSize_;
+    std::size_t position_ = 0;
+};
+
+/**
+ * Manager serving entity traits, resolution and versions from a
+ * ResolutionIndex. Publishing is not supported.
+ *
+ * Queries for entities not in the index fail as unresolvable, as they
+ * would have from the source manager.
+ */
+class IndexManagerInterface final : public openassetio::managerApi::ManagerInterface
+{
+public:
+    [[nodiscard]] openassetio::Identifier identifier() const override
+    {
+        return openassetio::Identifier{kIdentifier};
+    }
+
+    [[nodiscard]] openassetio::Str displayName() const override
+    {
+        return "KatanaOpenAssetIO Resolution Index";
+    }
+
+    [[nodiscard]] openassetio::InfoDictionary info() override
+    {
+        using openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
+
+        // May be queried before initialization.
+        ResolutionIndexPtr index;
+        {
+            const std::lock_guard lock{mutex_};
+            index = index_;
+        }
+        openassetio::InfoDictionary info;
+        if (index && !index->entityReferencePrefix().empty())
+        {
+            info.emplace(openassetio::Str{kInfoKey_EntityReferencesMatchPrefix},
+                         openassetio::Str{index->entityReferencePrefix()});
+        }
+        return info;
+    }
+
+    [[nodiscard]] openassetio::InfoDictionary settings(const HostSessionPtr&) override
+    {
+        const std::lock_guard lock{mutex_};
+        return {{openassetio::Str{kIndexPathSetting}, indexPath_}};
+    }
+
+    void initialize(openassetio::InfoDictionary managerSettings,
+                    const HostSessionPtr& hostSession) override
+    {
+        using openassetio::errors::ConfigurationException;
+
+        std::string indexPath;
+        {
+            const std::lock_guard lock{mutex_};
+            indexPath = indexPath_;
+        }
+        for (auto& [key, value] : managerSettings)
+        {
+            if (key != kIndexPathSetting)
+            {
+                throw ConfigurationException{"Unknown setting '" + key + "'"};
+            }
+            const auto* path = std::get_if<openassetio::Str>(&value);
+            if (path == nullptr)
+            {
+                throw ConfigurationException{std::string{kIndexPathSetting} +
+                                             " must be a string"};
+            }
+            indexPath = *path;
+        }
+        if (indexPath.empty())
+        {
+            throw ConfigurationException{std::string{kIndexPathSetting} + " must be set"};
+        }
+
+        openIndex(indexPath, hostSession);
+    }
+
+    /**
+     * Re-read the index, so that a re-exported index is picked up.
+     */
+    void flushCaches(const HostSessionPtr& hostSession) override
+    {
+        std::string indexPath;
+        {
+            const std::lock_guard lock{mutex_};
+            indexPath = indexPath_;
+        }
+        if (!indexPath.empty())
+        {
+            openIndex(indexPath, hostSession);
+        }
+    }
+
+    [[nodiscard]] bool hasCapability(const Capability capability) override
+    {
+        switch (capability)
+        {
+        case Capability::kEntityReferenceIdentification:
+        case Capability::kManagementPolicyQueries:
+        case Capability::kEntityTraitIntrospection:
+        case Capability::kResolution:
+        case Capability::kRelationshipQueries:
+        case Capability::kExistenceQueries:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    [[nodiscard]] TraitsDatas managementPolicy(const openassetio::trait::TraitSets& traitSets,
+                                               const openassetio::access::PolicyAccess policyAccess,
+                                               const ContextConstPtr&,
+                                               const HostSessionPtr&) override
+    {
+        using openassetio::trait::TraitsData;
+        using openassetio_mediacreation::traits::managementPolicy::ManagedTrait;
+
+        const ResolutionIndexPtr index = currentIndex();
+        TraitsDatas policies;
+        policies.reserve(traitSets.size());
+        for (const TraitSet& traitSet : traitSets)
+        {
+            auto policy = TraitsData::make();
+            policies.push_back(policy);
+            // Only entities with all the given traits can be served,
+            // and only for reading.
+            if (policyAccess != openassetio::access::PolicyAccess::kRead || traitSet.empty() ||
+                !std::all_of(traitSet.begin(),
+                             traitSet.end(),
+                             [&](const auto& traitId)
+                             { return index->allTraits().count(traitId) != 0; }))
+            {
+                continue;
+            }
+            ManagedTrait::imbueTo(policy);
+            policy->addTraits(traitSet);
+        }
+        return policies;
+    }
+
+    [[nodiscard]] bool isEntityReferenceString(const openassetio::Str& someString,
+                                               const HostSessionPtr&) override
+    {
+        const ResolutionIndexPtr index = currentIndex();
+        const std::string_view prefix = index->entityReferencePrefix();
+        if (!prefix.empty())
+        {
+            return std::string_view{someString}.substr(0, prefix.size()) == prefix;
+        }
+        // Without a known prefix, only indexed references are known to
+        // be references.
+        return index->find(someString).has_value();
+    }
+
+    void entityExists(const EntityReferences& entityReferences,
+                      const ContextConstPtr&,
+                      const HostSessionPtr&,
+                      const ExistsSuccessCallback& successCallback,
+                      const BatchElementErrorCallback&) override
+    {
+        const ResolutionIndexPtr index = currentIndex();
+        for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+        {
+            successCallback(idx, index->find(entityReferences[idx].toString()).has_value());
+        }
+    }
+
+    void entityTraits(const EntityReferences& entityReferences,
+                      const openassetio::access::EntityTraitsAccess entityTraitsAccess,
+                      const ContextConstPtr&,
+                      const HostSessionPtr&,
+                      const EntityTraitsSuccessCallback& successCallback,
+                      const BatchElementErrorCallback& errorCallback) override
+    {
+        const ResolutionIndexPtr index = currentIndex();
+        for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+        {
+            if (entityTraitsAccess != openassetio::access::EntityTraitsAccess::kRead)
+            {
+                errorCallback(idx, readOnlyError(entityReferences[idx]));
+                continue;
+            }
+            const auto entityId = index->find(entityReferences[idx].toString());
+            if (!entityId)
+            {
+                errorCallback(idx, unknownEntityError(entityReferences[idx]));
+                continue;
+            }
+            successCallback(idx, index->traitSet(*entityId));
+        }
+    }
+
+    void resolve(const EntityReferences& entityReferences,
+                 const TraitSet& traitSet,
+                 const openassetio::access::ResolveAccess resolveAccess,
+                 const ContextConstPtr&,
+                 const HostSessionPtr&,
+                 const ResolveSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override
+    {
+        const ResolutionIndexPtr index = currentIndex();
+        for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+        {
+            if (resolveAccess != openassetio::access::ResolveAccess::kRead)
+            {
+                errorCallback(idx, readOnlyError(entityReferences[idx]));
+                continue;
+            }
+            const auto entityId = index->find(entityReferences[idx].toString());
+            if (!entityId)
+            {
+                errorCallback(idx, unknownEntityError(entityReferences[idx]));
+                continue;
+            }
+            successCallback(idx, index->traitsData(*entityId, traitSet));
+        }
+    }
+
+    void getWithRelationship(const EntityReferences& entityReferences,
+                             const TraitsDataPtr& relationshipTraitsData,
+                             const TraitSet&,
+                             const std::size_t pageSize,
+                             const openassetio::access::RelationsAccess relationsAccess,
+                             const ContextConstPtr&,
+                             const HostSessionPtr&,
+                             const RelationshipQuerySuccessCallback& successCallback,
+                             const BatchElementErrorCallback& errorCallback) override
+    {
+        const ResolutionIndexPtr index = currentIndex();
+        for (std::size_t idx = 0; idx < entityReferences.size(); ++idx)
+        {
+            if (relationsAccess != openassetio::access::RelationsAccess::kRead)
+            {
+                errorCallback(idx, readOnlyError(entityReferences[idx]));
+                continue;
+            }
+            const auto entityId = index->find(entityReferences[idx].toString());
+            if (!entityId)
+            {
+                errorCallback(idx, unknownEntityError(entityReferences[idx]));
+                continue;
+            }
+            successCallback(
+                idx,
+                std::make_shared<IndexEntityReferencePager>(
+                    index, relatedReferences(*index, *entityId, relationshipTraitsData), pageSize));
+        }
+    }
+
+    void getWithRelationships(const EntityReference& entityReference,
+                              const TraitsDatas& relationshipTraitsDatas,
+                              const TraitSet& resultTraitSet,
+                              const std::size_t pageSize,
+                              const openassetio::access::RelationsAccess relationsAccess,
+                              const ContextConstPtr& context,
+                              const HostSessionPtr& hostSession,
+                              const RelationshipQuerySuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override
+    {
+        for (std::size_t idx = 0; idx < relationshipTraitsDatas.size(); ++idx)
+        {
+            getWithRelationship(
+                {entityReference},
+                relationshipTraitsDatas[idx],
+                resultTraitSet,
+                pageSize,
+                relationsAccess,
+                context,
+                hostSession,
+                [&](std::size_t, openassetio::managerApi::EntityReferencePagerInterfacePtr pager)
+                { successCallback(idx, std::move(pager)); },
+                [&](std::size_t, BatchElementError error)
+                { errorCallback(idx, std::move(error)); });
+        }
+    }
+
+private:
+    [[nodiscard]] ResolutionIndexPtr currentIndex() const
+    {
+        const std::lock_guard lock{mutex_};
+        if (!index_)
+        {
+            throw openassetio::errors::OpenAssetIOException{
+                "Resolution index manager has not been initialized"};
+        }
+        return index_;
+    }
+
+    void openIndex(const std::string& indexPath, const HostSessionPtr& hostSession)
+    {
+        using Severity = openassetio::log::LoggerInterface::Severity;
+
+        ResolutionIndexPtr index;
+        try
+        {
+            index = std::make_shared<const ResolutionIndex>(indexPath);
+        }
+        catch (const std::exception& exc)
+        {
+            throw openassetio::errors::ConfigurationException{exc.what()};
+        }
+
+        if (hostSession->logger()->isSeverityLogged(Severity::kDebug))
+        {
+            hostSession->logger()->debug("Resolution index manager: serving " +
+                                         std::to_string(index->size()) + " entities from " +
+                                         indexPath);
+        }
+
+        // Calls in flight continue with the index they started with.
+        const std::lock_guard lock{mutex_};
+        indexPath_ = indexPath;
+        index_ = std::move(index);
+    }
+
+    /**
+     * Related references of an entity, for the relationships held in
+     * the index, i.e. versions, optionally filtered by a VersionTrait
+     * tag. Other relationships have no related references.
+     */
+    [[nodiscard]] static std::vector<std::string_view> relatedReferences(
+        const ResolutionIndex& index,
+        const ResolutionIndex::EntityId entityId,
+        const TraitsDataPtr& relationshipTraitsData)
+    {
+        using openassetio_mediacreation::specifications::lifecycle::
+            EntityVersionsRelationshipSpecification;
+        using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+        if (relationshipTraitsData->traitSet() !=
+            EntityVersionsRelationshipSpecification::kTraitSet)
+        {
+            return {};
+        }
+
+        std::vector<std::string_view> versions = index.versions(entityId);
+        const std::optional<openassetio::Str> specifiedTag =
+            VersionTrait{relationshipTraitsData}.getSpecifiedTag();
+        if (!specifiedTag)
+        {
+            return versions;
+        }
+
+        // Return only the version with the given tag, which may be a
+        // meta-version, e.g. "latest", so its reference is returned
+        // rather than that of the version it currently points to.
+        const auto hasOtherTag = [&](const std::string_view version)
+        {
+            const auto versionId = index.find(version);
+            return !versionId ||
+                   VersionTrait{index.traitsData(*versionId, {VersionTrait::kId})}.getSpecifiedTag(
+                       "") != *specifiedTag;
+        };
+        versions.erase(std::remove_if(versions.begin(), versions.end(), hasOtherTag),
+                       versions.end());
+        return versions;
+    }
+
+    static BatchElementError unknownEntityError(const EntityReference& entityReference)
+    {
+        return BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                 "Entity '" + entityReference.toString() +
+                                     "' is not in the resolution index"};
+    }
+
+    static BatchElementError readOnlyError(const EntityReference& entityReference)
+    {
+        return BatchElementError{BatchElementError::ErrorCode::kEntityAccessError,
+                                 "Entity '" + entityReference.toString() +
+                                     "' is read-only in the resolution index"};
+    }
+
+    mutable std::mutex mutex_;
+    std::string indexPath_;
+    ResolutionIndexPtr index_;
+};
+
+/**
+ * Plugin system entry point to the manager.
+ */
+class IndexManagerPlugin final : public openassetio::pluginSystem::CppPluginSystemManagerPlugin
+{
+public:
+    [[nodiscard]] openassetio::Identifier identifier() const override
+    {
+        return openassetio::Identifier{kIdentifier};
+    }
+
+    openassetio::managerApi::ManagerInterfacePtr interface() override
+    {
+        return std::make_shared<IndexManagerInterface>();
+    }
+};
+}  // namespace
+
+extern "C" KATANAOPENASSETIO_INDEX_EXPORT openassetio::pluginSystem::PluginFactory
+openassetioPlugin() noexcept
+{
+    return []() noexcept -> openassetio::pluginSystem::CppPluginSystemPluginPtr
+    { return std::make_shared<IndexManagerPlugin>(); };
+}
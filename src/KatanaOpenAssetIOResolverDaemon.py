@@ -0,0 +1,57 @@
+# KatanaOpenAssetIO
+# Copyright (c) 2025 The Foundry Visionmongers Ltd
+# SPDX-License-Identifier: Apache-2.0
+"""
+Host-wide resolver daemon, serving resolve queries from other Katana
+processes on the same host over a Unix domain socket.
+
+The daemon owns a single OpenAssetIO manager (configured as usual via
+OPENASSETIO_DEFAULT_CONFIG) and the caches of the KatanaOpenAssetIO
+plugin, such that manager initialisation and asset service connections
+happen once per host rather than once per process.
+
+Run using Katana's script mode, e.g.
+
+    katana --script KatanaOpenAssetIOResolverDaemon.py /tmp/resolver.sock
+
+then set KATANAOPENASSETIO_RESOLVER_SOCKET=/tmp/resolver.sock in the
+environment of client Katana processes.
+"""
+import signal
+import sys
+import threading
+
+from Katana import AssetAPI
+
+plugin_id = "KatanaOpenAssetIO"
+
+
+def main(argv):
+    if len(argv) != 2:
+        sys.stderr.write(f"Usage: {argv[0]} <socket path>\n")
+        return 2
+
+    socket_path = argv[1]
+
+    assetapi_plugin = AssetAPI.GetAssetPlugin(plugin_id)
+    if assetapi_plugin is None:
+        sys.stderr.write(f"AssetAPI plugin '{plugin_id}' not found\n")
+        return 1
+
+    assetapi_plugin.runAssetPluginCommand(
+        "", "serveResolver", {"socketPath": socket_path}, throwOnError=True
+    )
+
+    # Serve until terminated. Requests are handled on the plugin's own
+    # threads, so this thread just waits.
+    stop = threading.Event()
+    signal.signal(signal.SIGINT, lambda *_: stop.set())
+    signal.signal(signal.SIGTERM, lambda *_: stop.set())
+    while not stop.wait(1):
+        pass
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,290 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ManagerState.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/constants.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace
+{
+// Source of process-unique snapshot IDs. Zero is reserved to mean "no
+// snapshot published".
+std::atomic<std::uint64_t> nextStateId{1};
+
+/**
+ * Record of a snapshot previously acquired by the current thread.
+ *
+ * Only weak references are held, so a thread-local cache never extends
+ * the lifetime of a manager beyond that of its owning plugin instance.
+ * In particular, Python managers must not be destroyed during thread
+ * teardown, potentially after the interpreter has been finalized.
+ */
+struct ThreadSlot
+{
+    std::uint64_t stateId;
+    std::weak_ptr<const ManagerState> state;
+    /// Contexts of each subsystem, acquired as needed.
+    std::array<std::weak_ptr<openassetio::Context>, kNumSubsystems> contexts;
+};
+
+// Typically a single entry, unless multiple plugin instances are in
+// use by the same thread.
+thread_local std::vector<ThreadSlot> threadSlots;  // NOLINT(*-avoid-non-const-global-variables)
+
+/**
+ * Token owned by the calling thread, such that weak references to it
+ * expire once the thread exits.
+ */
+const std::shared_ptr<const void>& threadToken()
+{
+    // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+    thread_local const std::shared_ptr<const void> token = std::make_shared<char>();
+    return token;
+}
+
+/**
+ * 64-bit FNV-1a hash, accumulated incrementally.
+ */
+class Fnv1aHash
+{
+public:
+    void add(const void* data, const std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t idx = 0; idx < size; ++idx)
+        {
+            hash_ ^= bytes[idx];  // NOLINT(*-pointer-arithmetic)
+            hash_ *= kPrime;
+        }
+    }
+
+    void add(const std::string_view str)
+    {
+        add(str.size());
+        add(str.data(), str.size());
+    }
+
+    template <class T, class = std::enable_if_t<std::is_arithmetic_v<T>>>
+    void add(const T value)
+    {
+        add(&value, sizeof(value));
+    }
+
+    [[nodiscard]] std::uint64_t value() const { return hash_; }
+
+private:
+    static constexpr std::uint64_t kOffsetBasis = 14695981039346656037ULL;
+    static constexpr std::uint64_t kPrime = 1099511628211ULL;
+    std::uint64_t hash_{kOffsetBasis};
+};
+
+/**
+ * Hash the manager identifier and settings.
+ *
+ * Settings are visited in key order, so that the result is independent
+ * of map iteration order.
+ */
+std::uint64_t hashManagerConfiguration(const openassetio::hostApi::ManagerPtr& manager)
+{
+    Fnv1aHash hash;
+    hash.add(manager->identifier());
+
+    const openassetio::InfoDictionary settings = manager->settings();
+    const std::map<std::string_view, const openassetio::InfoDictionaryValue*> sortedSettings = [&]
+    {
+        std::map<std::string_view, const openassetio::InfoDictionaryValue*> sorted;
+        for (const auto& [key, value] : settings)
+        {
+            sorted.emplace(key, &value);
+        }
+        return sorted;
+    }();
+
+    for (const auto& [key, value] : sortedSettings)
+    {
+        hash.add(key);
+        hash.add(value->index());
+        std::visit(
+            [&](const auto& containedValue)
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(containedValue)>,
+                                             openassetio::Str>)
+                {
+                    hash.add(std::string_view{containedValue});
+                }
+                else
+                {
+                    hash.add(containedValue);
+                }
+            },
+            *value);
+    }
+    return hash.value();
+}
+
+/**
+ * Entity reference prefix advertised in the manager's info, if any.
+ */
+std::optional<std::string> entityReferencePrefixOf(const openassetio::hostApi::ManagerPtr& manager)
+{
+    using openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
+    const openassetio::InfoDictionary info = manager->info();
+    // NOLINTNEXTLINE(*-suspicious-stringview-data-usage)
+    const auto prefixIt = info.find(kInfoKey_EntityReferencesMatchPrefix.data());
+    if (prefixIt == info.end())
+    {
+        return std::nullopt;
+    }
+    const auto* prefix = std::get_if<openassetio::Str>(&prefixIt->second);
+    if (!prefix || prefix->empty())
+    {
+        return std::nullopt;
+    }
+    return *prefix;
+}
+}  // namespace
+
+ManagerState::ManagerState(
+    openassetio::hostApi::ManagerPtr manager,
+    openassetio::hostApi::ManagerImplementationFactoryInterfacePtr implFactory,
+    const SessionMode sessionMode)
+    : manager_{std::move(manager)},
+      implFactory_{std::move(implFactory)},
+      id_{nextStateId.fetch_add(1, std::memory_order_relaxed)},
+      generation_{hashManagerConfiguration(manager_)},
+      entityReferencePrefix_{entityReferencePrefixOf(manager_)}
+{
+    for (std::size_t idx = 0; idx < kNumSubsystems; ++idx)
+    {
+        rootContexts_[idx] = manager_->createContext();
+        rootContexts_[idx]->locale = makeLocale(static_cast<Subsystem>(idx), sessionMode);
+    }
+}
+
+openassetio::ContextPtr ManagerState::contextForCurrentThread(const Subsystem subsystem) const
+{
+    const auto idx = static_cast<std::size_t>(subsystem);
+    const std::thread::id threadId = std::this_thread::get_id();
+    {
+        const std::lock_guard lock{threadContextsMutex_};
+        const auto contextsIt = threadContexts_.find(threadId);
+        if (contextsIt != threadContexts_.end() &&
+            contextsIt->second.threadToken.lock() == threadToken() &&
+            contextsIt->second.contexts[idx])
+        {
+            return contextsIt->second.contexts[idx];
+        }
+    }
+
+    // Created without the lock, since a Python manager requires the
+    // GIL, which threads waiting on the lock may hold. Locale is
+    // copied from the parent.
+    openassetio::ContextPtr context = manager_->createChildContext(rootContexts_[idx]);
+
+    // Contexts of exited threads, destroyed once the lock is released,
+    // since a Python manager's state may require the GIL.
+    std::vector<SubsystemContexts> exitedContexts;
+    {
+        const std::lock_guard lock{threadContextsMutex_};
+        for (auto contextsIt = threadContexts_.begin(); contextsIt != threadContexts_.end();)
+        {
+            if (contextsIt->second.threadToken.expired())
+            {
+                exitedContexts.push_back(std::move(contextsIt->second.contexts));
+                contextsIt = threadContexts_.erase(contextsIt);
+            }
+            else
+            {
+                ++contextsIt;
+            }
+        }
+        ThreadContexts& threadContexts = threadContexts_[threadId];
+        threadContexts.threadToken = threadToken();
+        threadContexts.contexts[idx] = context;
+    }
+    return context;
+}
+
+ManagerLease ManagerStateHolder::acquire(const Subsystem subsystem) const
+{
+    const auto idx = static_cast<std::size_t>(subsystem);
+    const std::uint64_t stateId = stateId_.load(std::memory_order_acquire);
+
+    // Fast path: this thread has already seen the current snapshot.
+    for (const ThreadSlot& slot : threadSlots)
+    {
+        if (slot.stateId != stateId)
+        {
+            continue;
+        }
+        auto state = slot.state.lock();
+        auto context = slot.contexts[idx].lock();
+        if (state && context)
+        {
+            return {std::move(state), std::move(context), subsystem};
+        }
+        break;
+    }
+
+    // Slow path: first call on this thread, for this subsystem, since
+    // the snapshot changed.
+    auto state = std::atomic_load(&state_);
+    if (!state)
+    {
+        throw std::logic_error{"OpenAssetIO manager has not been initialized"};
+    }
+    auto context = state->contextForCurrentThread(subsystem);
+
+    // Forget snapshots that have since been destroyed.
+    threadSlots.erase(std::remove_if(begin(threadSlots),
+                                     end(threadSlots),
+                                     [](const ThreadSlot& slot) { return slot.state.expired(); }),
+                      end(threadSlots));
+    const auto slotIt = std::find_if(begin(threadSlots),
+                                     end(threadSlots),
+                                     [&](const ThreadSlot& slot)
+                                     { return slot.stateId == state->id(); });
+    ThreadSlot& slot = slotIt != end(threadSlots)
+                           ? *slotIt
+                           : threadSlots.emplace_back(ThreadSlot{state->id(), state, {}});
+    slot.contexts[idx] = context;
+
+    return {std::move(state), std::move(context), subsystem};
+}
+
+ManagerStatePtr ManagerStateHolder::current() const
+{
+    return std::atomic_load(&state_);
+}
+
+std::unique_lock<std::mutex> ManagerStateHolder::lockForWriting()
+{
+    return std::unique_lock{writerMutex_};
+}
+
+void ManagerStateHolder::publish([[maybe_unused]] const std::unique_lock<std::mutex>& writerLock,
+                                 ManagerStatePtr state)
+{
+    const std::uint64_t stateId = state->id();
+    std::atomic_store(&state_, std::move(state));
+    stateId_.store(stateId, std::memory_order_release);
+}
@@ -0,0 +1,186 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/hostApi/Manager.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+
+#include "CallLocale.hpp"
+
+/**
+ * Immutable snapshot of an OpenAssetIO manager and its root context.
+ *
+ * A new snapshot is created whenever the manager is (re)created or
+ * (re)initialised. Asset API calls that are in flight when a new
+ * snapshot is published continue to use the snapshot they started
+ * with.
+ *
+ * Each subsystem of the plugin has its own root Context, whose locale
+ * describes the subsystem and session mode (see CallLocale.hpp), so
+ * that managers may tailor their behaviour to the caller. Each calling
+ * thread is given its own child Context of each root context, so that
+ * managers may keep per-thread state. A thread's contexts are released
+ * once it has exited, as other threads acquire contexts.
+ *
+ * Data derived from manager queries should be keyed by the snapshot's
+ * generation, which changes only if the manager identifier or settings
+ * change, so remains valid across re-initialisation with identical
+ * settings.
+ */
+class ManagerState
+{
+public:
+    ManagerState(openassetio::hostApi::ManagerPtr manager,
+                 openassetio::hostApi::ManagerImplementationFactoryInterfacePtr implFactory,
+                 SessionMode sessionMode);
+
+    [[nodiscard]] const openassetio::hostApi::ManagerPtr& manager() const { return manager_; }
+
+    /**
+     * Factory used to create the manager, retained so that the manager
+     * can be re-created with updated settings.
+     */
+    [[nodiscard]] const openassetio::hostApi::ManagerImplementationFactoryInterfacePtr&
+    implFactory() const
+    {
+        return implFactory_;
+    }
+
+    /**
+     * Context created directly from the manager, parent of all
+     * per-thread contexts of a subsystem.
+     */
+    [[nodiscard]] const openassetio::ContextPtr& rootContext(
+        const Subsystem subsystem = Subsystem::kLookup) const
+    {
+        return rootContexts_[static_cast<std::size_t>(subsystem)];
+    }
+
+    /**
+     * Process-unique identifier of this snapshot.
+     */
+    [[nodiscard]] std::uint64_t id() const { return id_; }
+
+    /**
+     * Hash of the manager identifier and settings.
+     */
+    [[nodiscard]] std::uint64_t generation() const { return generation_; }
+
+    /**
+     * Prefix common to all of the manager's entity references, if
+     * advertised by the manager.
+     */
+    [[nodiscard]] const std::optional<std::string>& entityReferencePrefix() const
+    {
+        return entityReferencePrefix_;
+    }
+
+    /**
+     * Get (creating if necessary) the child context of a subsystem for
+     * the calling thread.
+     *
+     * The context is created without holding any lock, since creating
+     * it may require the GIL.
+     */
+    [[nodiscard]] openassetio::ContextPtr contextForCurrentThread(Subsystem subsystem) const;
+
+private:
+    openassetio::hostApi::ManagerPtr manager_;
+    openassetio::hostApi::ManagerImplementationFactoryInterfacePtr implFactory_;
+    using SubsystemContexts = std::array<openassetio::ContextPtr, kNumSubsystems>;
+
+    SubsystemContexts rootContexts_;
+    std::uint64_t id_;
+    std::uint64_t generation_;
+    std::optional<std::string> entityReferencePrefix_;
+
+    /// Contexts of a thread, valid whilst the thread is alive.
+    struct ThreadContexts
+    {
+        /// Expires once the thread exits.
+        std::weak_ptr<const void> threadToken;
+        SubsystemContexts contexts;
+    };
+
+    mutable std::mutex threadContextsMutex_;
+    mutable std::unordered_map<std::thread::id, ThreadContexts> threadContexts_;
+};
+
+using ManagerStatePtr = std::shared_ptr<const ManagerState>;
+
+/**
+ * Manager and calling thread's context for a subsystem, held for the
+ * duration of a single Asset API call.
+ */
+struct ManagerLease
+{
+    ManagerStatePtr state;
+    openassetio::ContextPtr context;
+    /// Subsystem of the context, e.g. to get the context of another
+    /// thread making calls on behalf of the same subsystem.
+    Subsystem subsystem = Subsystem::kLookup;
+
+    [[nodiscard]] const openassetio::hostApi::ManagerPtr& manager() const
+    {
+        return state->manager();
+    }
+};
+
+/**
+ * Publishes ManagerState snapshots to concurrent readers.
+ *
+ * Readers call `acquire()`, which does not take any lock in the common
+ * case: a thread-local record of the last snapshot seen by the calling
+ * thread is validated against an atomic snapshot ID.
+ *
+ * Writers must hold the lock returned by `lockForWriting()` for the
+ * whole read-modify-publish sequence, so that concurrent `reset()` and
+ * `initialize` requests are serialised.
+ */
+class ManagerStateHolder
+{
+public:
+    [[nodiscard]] ManagerLease acquire(Subsystem subsystem = Subsystem::kLookup) const;
+
+    /**
+     * Current snapshot, for use by writers. May be null before the
+     * first `publish()`.
+     */
+    [[nodiscard]] ManagerStatePtr current() const;
+
+    /**
+     * Whether a snapshot has been published, such that `acquire()`
+     * will succeed. Does not lock.
+     */
+    [[nodiscard]] bool isPublished() const
+    {
+        return stateId_.load(std::memory_order_acquire) != 0;
+    }
+
+    [[nodiscard]] std::unique_lock<std::mutex> lockForWriting();
+
+    /**
+     * Make a new snapshot visible to readers.
+     *
+     * @param writerLock Lock acquired from `lockForWriting()`.
+     * @param state New snapshot.
+     */
+    void publish(const std::unique_lock<std::mutex>& writerLock, ManagerStatePtr state);
+
+private:
+    ManagerStatePtr state_;
+    std::atomic<std::uint64_t> stateId_{0};
+    std::mutex writerMutex_;
+};
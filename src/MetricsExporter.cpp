@@ -0,0 +1,269 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "MetricsExporter.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <stdexcept>
+#include <system_error>
+
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
+
+namespace
+{
+// Enough to round-trip bucket bounds such as 0.1 without noise.
+constexpr int kValuePrecision = 15;
+
+constexpr std::string_view kPidPlaceholder = "{pid}";
+
+std::string processId()
+{
+#ifndef _WIN32
+    return std::to_string(getpid());
+#else
+    return std::to_string(_getpid());
+#endif
+}
+
+std::string temporaryPathFor(const std::string& path)
+{
+    return path + ".tmp" + processId();
+}
+
+std::string withProcessId(std::string path)
+{
+    if (const auto placeholderPos = path.find(kPidPlaceholder); placeholderPos != std::string::npos)
+    {
+        path.replace(placeholderPos, kPidPlaceholder.size(), processId());
+    }
+    return path;
+}
+
+std::string formatValue(const double value)
+{
+    if (std::isinf(value))
+    {
+        return value > 0 ? "+Inf" : "-Inf";
+    }
+    if (std::isnan(value))
+    {
+        return "NaN";
+    }
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out << std::setprecision(kValuePrecision) << value;
+    return out.str();
+}
+}  // namespace
+
+PrometheusText::PrometheusText()
+{
+    // Katana may set a global locale with a different decimal point.
+    out_.imbue(std::locale::classic());
+}
+
+void PrometheusText::describe(const std::string_view name,
+                              const std::string_view type,
+                              const std::string_view help)
+{
+    out_ << "# HELP " << name << ' ' << help << '\n';
+    out_ << "# TYPE " << name << ' ' << type << '\n';
+}
+
+void PrometheusText::sample(const std::string_view name, const Labels& labels, const double value)
+{
+    out_ << name;
+    writeLabels(labels);
+    out_ << ' ' << formatValue(value) << '\n';
+}
+
+void PrometheusText::sample(const std::string_view name,
+                            const Labels& labels,
+                            const std::uint64_t value)
+{
+    out_ << name;
+    writeLabels(labels);
+    out_ << ' ' << value << '\n';
+}
+
+void PrometheusText::histogram(const std::string_view name,
+                               const Labels& labels,
+                               const Histogram& histogram)
+{
+    const std::string bucketName = std::string{name} + "_bucket";
+    const std::vector<std::uint64_t> bucketCounts = histogram.bucketCounts();
+    const std::vector<double>& upperBounds = histogram.upperBounds();
+
+    // Buckets are cumulative in the exposition format.
+    Labels bucketLabels = labels;
+    bucketLabels.emplace_back("le", "");
+    std::uint64_t cumulative = 0;
+    for (std::size_t idx = 0; idx < bucketCounts.size(); ++idx)
+    {
+        cumulative += bucketCounts[idx];
+        const std::string upperBound = formatValue(
+            idx < upperBounds.size() ? upperBounds[idx] : std::numeric_limits<double>::infinity());
+        bucketLabels.back().second = upperBound;
+        sample(bucketName, bucketLabels, cumulative);
+    }
+    sample(std::string{name} + "_sum", labels, histogram.sum());
+    sample(std::string{name} + "_count", labels, cumulative);
+}
+
+void PrometheusText::histograms(const std::string_view name, const HistogramFamily& family)
+{
+    family.forEach(
+        [&](const HistogramFamily::LabelValues& labelValues, const Histogram& histogram)
+        {
+            Labels labels;
+            for (std::size_t idx = 0; idx < labelValues.size(); ++idx)
+            {
+                labels.emplace_back(family.labelNames()[idx], labelValues[idx]);
+            }
+            this->histogram(name, labels, histogram);
+        });
+}
+
+void PrometheusText::quantiles(const std::string_view name,
+                               const HistogramFamily& family,
+                               const std::vector<double>& fractions)
+{
+    family.forEach(
+        [&](const HistogramFamily::LabelValues& labelValues, const Histogram& histogram)
+        {
+            if (histogram.count() == 0)
+            {
+                return;
+            }
+            Labels labels;
+            for (std::size_t idx = 0; idx < labelValues.size(); ++idx)
+            {
+                labels.emplace_back(family.labelNames()[idx], labelValues[idx]);
+            }
+            labels.emplace_back("quantile", "");
+            for (const double fraction : fractions)
+            {
+                const std::string quantile = formatValue(fraction);
+                labels.back().second = quantile;
+                sample(name, labels, histogram.quantile(fraction));
+            }
+        });
+}
+
+void PrometheusText::writeLabels(const Labels& labels)
+{
+    if (labels.empty())
+    {
+        return;
+    }
+    out_ << '{';
+    const char* separator = "";
+    for (const auto& [labelName, labelValue] : labels)
+    {
+        out_ << separator << labelName << "=\"";
+        for (const char chr : labelValue)
+        {
+            switch (chr)
+            {
+            case '\\':
+                out_ << "\\\\";
+                break;
+            case '"':
+                out_ << "\\\"";
+                break;
+            case '\n':
+                out_ << "\\n";
+                break;
+            default:
+                out_ << chr;
+            }
+        }
+        out_ << '"';
+        separator = ",";
+    }
+    out_ << '}';
+}
+
+void writeFileAtomically(const std::string& path, const std::string_view contents)
+{
+    const std::string temporaryPath = temporaryPathFor(path);
+    {
+        std::ofstream stream{temporaryPath, std::ios::binary | std::ios::trunc};
+        stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        stream.close();
+        if (!stream)
+        {
+            std::error_code errorCode;
+            std::filesystem::remove(temporaryPath, errorCode);
+            throw std::runtime_error{"Failed to write '" + path + "'"};
+        }
+    }
+    std::filesystem::rename(temporaryPath, path);
+}
+
+MetricsExporter::MetricsExporter(std::string path,
+                                 const std::chrono::milliseconds interval,
+                                 RenderFn render,
+                                 ErrorFn onError)
+    : path_{withProcessId(std::move(path))},
+      interval_{interval},
+      render_{std::move(render)},
+      onError_{std::move(onError)},
+      thread_{[this] { run(); }}
+{
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    stop();
+}
+
+void MetricsExporter::stop()
+{
+    {
+        const std::lock_guard lock{mutex_};
+        if (isStopping_)
+        {
+            return;
+        }
+        isStopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+void MetricsExporter::run()
+{
+    std::unique_lock lock{mutex_};
+    while (!isStopping_)
+    {
+        lock.unlock();
+        write();
+        lock.lock();
+        wake_.wait_for(lock, interval_, [this] { return isStopping_; });
+    }
+    lock.unlock();
+    // Capture anything since the last write.
+    write();
+}
+
+void MetricsExporter::write()
+{
+    try
+    {
+        writeFileAtomically(path_, render_());
+    }
+    catch (const std::exception& exc)
+    {
+        onError_(exc);
+    }
+}
@@ -0,0 +1,129 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Statistics.hpp"
+
+/**
+ * Builds metrics in the Prometheus text exposition format, as read by
+ * the node exporter's textfile collector.
+ *
+ * Each metric must be described before its samples are added, and all
+ * samples of a metric added together.
+ */
+class PrometheusText
+{
+public:
+    using Labels = std::vector<std::pair<std::string_view, std::string_view>>;
+
+    PrometheusText();
+
+    /**
+     * Add the HELP and TYPE lines for a metric.
+     *
+     * @param type "counter", "gauge" or "histogram".
+     */
+    void describe(std::string_view name, std::string_view type, std::string_view help);
+
+    void sample(std::string_view name, const Labels& labels, double value);
+    void sample(std::string_view name, const Labels& labels, std::uint64_t value);
+
+    /// Add the bucket, sum and count samples of a histogram.
+    void histogram(std::string_view name, const Labels& labels, const Histogram& histogram);
+
+    /// Add the samples of each histogram in a family.
+    void histograms(std::string_view name, const HistogramFamily& family);
+
+    /**
+     * Add samples estimating the given quantiles of each histogram in a
+     * family, with a "quantile" label, e.g. as a gauge.
+     */
+    void quantiles(std::string_view name,
+                   const HistogramFamily& family,
+                   const std::vector<double>& fractions);
+
+    [[nodiscard]] std::string str() const { return out_.str(); }
+
+private:
+    void writeLabels(const Labels& labels);
+
+    std::ostringstream out_;
+};
+
+/**
+ * Write a file such that readers only ever see either its previous or
+ * its new contents, by writing to a temporary file alongside it, then
+ * renaming it into place.
+ *
+ * @throws std::exception On failure to write or rename the file.
+ */
+void writeFileAtomically(const std::string& path, std::string_view contents);
+
+/**
+ * Periodically writes metrics to a file from a background thread, e.g.
+ * for the node exporter's textfile collector.
+ */
+class MetricsExporter
+{
+public:
+    /// Render the metrics. Called on the background thread.
+    using RenderFn = std::function<std::string()>;
+    /// Report a failure to render or write metrics. Must not throw.
+    using ErrorFn = std::function<void(const std::exception&)>;
+
+    /**
+     * @param path File to write, atomically, see writeFileAtomically.
+     * Any "{pid}" is replaced with the process ID, so that concurrent
+     * processes on a host can write separate files.
+     * @param interval Time between writes.
+     * @param render Function rendering the metrics.
+     * @param onError Function called on failure of any write.
+     */
+    MetricsExporter(std::string path,
+                    std::chrono::milliseconds interval,
+                    RenderFn render,
+                    ErrorFn onError);
+
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+    MetricsExporter(MetricsExporter&&) = delete;
+    MetricsExporter& operator=(MetricsExporter&&) = delete;
+
+    [[nodiscard]] const std::string& path() const { return path_; }
+
+    /**
+     * Write the final metrics and wait for the background thread to
+     * finish.
+     */
+    void stop();
+
+private:
+    void run();
+    void write();
+
+    const std::string path_;
+    const std::chrono::milliseconds interval_;
+    const RenderFn render_;
+    const ErrorFn onError_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool isStopping_{false};
+    std::thread thread_;
+};
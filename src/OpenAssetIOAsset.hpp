@@ -3,19 +3,59 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <variant>
+#include <vector>
+
+#include <Python.h>
 
 #include <FnAsset/plugin/FnAsset.h>
 
 #include <openassetio/EntityReference.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
 #include <openassetio/utils/path.hpp>
 
+#include "AdaptivePageSize.hpp"
+#include "AssetIdFilter.hpp"
+#include "BackgroundRefresher.hpp"
+#include "CacheMemoryBudget.hpp"
+#include "CallLocale.hpp"
+#include "CallPatternPredictor.hpp"
+#include "ChangeReport.hpp"
+#include "CircuitBreaker.hpp"
+#include "DeadlineExecutor.hpp"
+#include "DirectoryScanCache.hpp"
+#include "ManagerState.hpp"
+#include "MetricsExporter.hpp"
+#include "PathInterner.hpp"
 #include "PublishStrategies.hpp"
+#include "PublishTiming.hpp"
+#include "ReferenceCache.hpp"
+#include "ResolverClient.hpp"
+#include "ResolverProtocol.hpp"
+#include "ResolverServer.hpp"
+#include "RoundTripMonitor.hpp"
+#include "Statistics.hpp"
+#include "UrlPathConverter.hpp"
 
 class OpenAssetIOAsset final : public FnKat::Asset
 {
@@ -286,19 +326,667 @@ public:
                          std::string& assetId) override;
 
 private:
-    [[nodiscard]] std::optional<openassetio::EntityReference> entityRefForAssetIdAndVersion(
-        const std::string& assetId,
-        const std::string& desiredVersionTag) const;
+    /**
+     * Configuration of a resolver server's manager, see
+     * resolver_protocol::Operation::kGetManagerInfo.
+     */
+    struct ResolverServerInfo
+    {
+        /// Generation of the server's manager, see ManagerState.
+        std::uint64_t generation;
+        std::optional<std::string> entityReferencePrefix;
+    };
+
+    /**
+     * Create the manager from the default configuration, publishing it
+     * to managerState_.
+     *
+     * @param isFirstUse Whether this is on first use of a deferred
+     * manager, see acquireManager, in which case nothing is done if
+     * another thread has since created it.
+     */
+    void createManager(bool isFirstUse);
+
+    /**
+     * Acquire a lease on the current manager, creating it if deferred.
+     *
+     * Resolver clients defer creating a manager until one is needed,
+     * i.e. for publishing or if the resolver server is unavailable,
+     * since queries are otherwise answered by the server's manager.
+     */
+    [[nodiscard]] ManagerLease acquireManager(Subsystem subsystem = Subsystem::kLookup);
+
+    /**
+     * Find the reference to the given version of an asset, if any.
+     */
+    [[nodiscard]] std::variant<openassetio::errors::BatchElementError,
+                               std::optional<openassetio::EntityReference>>
+    entityRefForAssetIdAndVersion(const ManagerLease& lease,
+                                  std::string_view method,
+                                  const std::string& assetId,
+                                  const std::string& desiredVersionTag);
+
+    /**
+     * Get the Python dict a plugin command writes its results to, given
+     * by the `outDictId` argument.
+     *
+     * @return The dict, or nullptr if the object is not a dict.
+     */
+    PyObject* outDictArg(const StringMap& commandArgs);
+
+    /**
+     * Reject a call to a write API if in read-only mode, see
+     * isReadOnly_.
+     */
+    void throwIfReadOnly(std::string_view method);
+
+    /**
+     * Update the results of queries cached for a reference in read-only
+     * mode, which are kept for the lifetime of the process, see
+     * readOnlyQueryCache_.
+     *
+     * @param update Function updating the CachedQueries of the
+     * reference.
+     */
+    template <class Fn>
+    void rememberReadOnlyQuery(const ManagerLease& lease, const std::string& ref, Fn update);
+
+    /**
+     * Log and throw an error at the AssetAPI boundary.
+     *
+     * Katana queries many references that do not exist (yet), so
+     * internally such errors are passed around as values, and are only
+     * thrown (and so unwound) once, here.
+     */
+    [[noreturn]] void throwBatchElementError(std::string_view method,
+                                             const openassetio::errors::BatchElementError& error);
+
+    [[nodiscard]] static std::pair<openassetio::EntityReference, std::string>
+    assetIdToEntityRefAndManagerDrivenValue(const ManagerLease& lease, const std::string& assetId);
+
+    /**
+     * Call the manager, subject to the deadline configured for the
+     * given Asset API method, if any.
+     *
+     * If a deadline is configured, the call is made on a worker thread,
+     * and DeadlineExceededError is thrown if it doesn't complete in
+     * time. If the manager repeatedly fails to respond in time, calls
+     * fail immediately, other than periodic probes.
+     *
+     * The call is accounted for as a round trip, see recordRoundTrip,
+     * unless it is rejected without reaching the manager.
+     *
+     * @param lease Manager to call, whose context is used if the call
+     * is made on the calling thread.
+     * @param method Name of the calling Asset API method.
+     * @param managerCall Manager method called.
+     * @param numElements Number of entity references (or trait sets) in
+     * the call.
+     * @param traitSet Traits queried, if any.
+     * @param call Function making the manager call, given the context
+     * of the thread making it. Must capture its arguments by value,
+     * since it may outlive the caller.
+     */
+    template <class Fn>
+    std::invoke_result_t<Fn, const openassetio::ContextPtr&> callManager(
+        const ManagerLease& lease,
+        std::string_view method,
+        std::string_view managerCall,
+        std::size_t numElements,
+        const openassetio::trait::TraitSet& traitSet,
+        Fn call);
+
+    /**
+     * Resolve a batch of entity references via callManager, such that
+     * background resolution is subject to the same deadlines and
+     * circuit breaker as foreground calls.
+     *
+     * @return Traits data, or error, of each reference.
+     */
+    std::vector<std::variant<openassetio::errors::BatchElementError,
+                             openassetio::trait::TraitsDataPtr>>
+    resolveBatch(const ManagerLease& lease,
+                 std::string_view method,
+                 const openassetio::EntityReferences& entityReferences,
+                 const openassetio::trait::TraitSet& traitSet);
+
+    /**
+     * Call a service, subject to the deadline configured for the given
+     * Asset API method, and the service's circuit breaker. See
+     * callManager.
+     *
+     * @param service Name of the service, for messages.
+     * @param onAdmitted Function called on the calling thread just
+     * before the call is made, i.e. once admitted by the breaker.
+     */
+    template <class OnAdmitted, class Fn>
+    std::invoke_result_t<Fn> callWithDeadline(std::string_view method,
+                                              CircuitBreaker& circuitBreaker,
+                                              std::string_view service,
+                                              OnAdmitted onAdmitted,
+                                              Fn call);
+
+    /**
+     * Account for a manager round trip made on behalf of an Asset API
+     * method, warning of any calls found to be batchable, see
+     * roundTripMonitor_.
+     */
+    void recordRoundTrip(std::string_view method,
+                         std::string_view managerCall,
+                         std::size_t numElements,
+                         const openassetio::trait::TraitSet& traitSet = {});
+
+    /// Warn of calls newly found to be batchable.
+    void warnBatchable(const std::vector<BatchableCalls>& newlyBatchable);
+
+    /**
+     * Aggregate the phase durations of a successful publishing call,
+     * see publishPhaseDurations_, logging them if API calls are logged.
+     */
+    void recordPublishPhases(std::string_view method,
+                             const std::string& assetType,
+                             const PublishPhaseTimings& timings);
+
+    /**
+     * Render counters and histograms in the Prometheus text format, see
+     * metricsExporter_.
+     */
+    [[nodiscard]] std::string renderMetrics() const;
+
+    /**
+     * Resolve an entity for reading, returning any error rather than
+     * throwing.
+     *
+     * Entities that recently failed to resolve are short-circuited,
+     * returning the previous error without calling the manager.
+     */
+    [[nodiscard]] std::variant<openassetio::errors::BatchElementError,
+                               openassetio::trait::TraitsDataPtr>
+    resolveForReadOrError(const ManagerLease& lease,
+                          std::string_view method,
+                          const openassetio::EntityReference& entityReference,
+                          const openassetio::trait::TraitSet& traitSet);
+
+    /**
+     * Take traits for a query from a preceding call for the same
+     * reference that speculatively fetched them, if any, recording the
+     * call pattern either way.
+     */
+    std::optional<openassetio::trait::TraitsDataPtr> takeSpeculativeTraits(
+        const ManagerLease& lease,
+        std::string_view method,
+        const openassetio::EntityReference& entityReference,
+        const openassetio::trait::TraitSet& traitSet);
+
+    /**
+     * Add the traits likely to be needed by follow-up calls to those
+     * needed by a query.
+     */
+    openassetio::trait::TraitSet withSpeculativeTraits(
+        std::string_view method, const openassetio::trait::TraitSet& traitSet);
+
+    /**
+     * Remember resolved traits, so that follow-up calls for the same
+     * reference can use any fetched speculatively.
+     */
+    void rememberRecentCall(const ManagerLease& lease,
+                            std::string_view method,
+                            const openassetio::EntityReference& entityReference,
+                            const openassetio::trait::TraitsDataPtr& traitsData,
+                            const openassetio::trait::TraitSet& resolvedTraitSet,
+                            bool isSpeculative);
+
+    /**
+     * Record an error for a reference, if the error indicates that the
+     * entity doesn't exist (yet) or the reference is invalid.
+     */
+    void rememberNegativeResult(const ManagerLease& lease,
+                                const openassetio::EntityReference& entityReference,
+                                const openassetio::errors::BatchElementError& error,
+                                std::string message);
+
+    /**
+     * Resolve the path to an entity's content, or the error if it fails
+     * to resolve or has no location.
+     *
+     * Paths are cached. Paths of references to a specific version are
+     * cached indefinitely. Otherwise, cached paths older than the soft
+     * TTL are returned immediately, and queued for refresh in the
+     * background, and paths older than the hard TTL are resolved
+     * synchronously.
+     *
+     * If the manager fails to respond in time, the last known path is
+     * returned, if available. Otherwise DeadlineExceededError is
+     * thrown.
+     */
+    [[nodiscard]] std::variant<openassetio::errors::BatchElementError, std::string>
+    resolvePathForRead(
+        const ManagerLease& lease,
+        std::string_view method,
+        const openassetio::EntityReference& entityReference);
+
+    /**
+     * Whether a string is an entity reference, avoiding a manager call
+     * where possible, see assetIdFilter_. Any manager call is accounted
+     * to the given Asset API method, see recordRoundTrip.
+     */
+    bool isEntityReferenceString(const ManagerLease& lease,
+                                 std::string_view method,
+                                 const std::string& str);
+
+    /**
+     * Add a resolved path to the cache, with an expiry appropriate to
+     * the reference's mutability, as determined by its `VersionTrait`.
+     */
+    void cachePath(const ManagerLease& lease,
+                   const std::string& ref,
+                   std::string_view path,
+                   const openassetio::trait::TraitsDataPtr& traitsData);
+
+    /**
+     * Re-resolve the paths of a batch of stale references. Called on
+     * the path refresher's thread.
+     */
+    void refreshPaths(const std::vector<std::string>& refs);
+
+    /**
+     * Resolve the paths of a batch of references found by scanning a
+     * file. Called on the path prefetcher's threads.
+     */
+    void prefetchPaths(const std::vector<std::string>& refs);
+
+    /**
+     * Resolve the paths of a batch of references with a single manager
+     * call, on behalf of a subsystem, updating the path cache.
+     */
+    void resolvePathsIntoCache(const std::vector<std::string>& refs,
+                               Subsystem subsystem,
+                               Counter& resolvedCount,
+                               Counter& failedCount);
+
+    /**
+     * Filter asset IDs down to entity references whose paths are not
+     * cached, stripping any manager-driven value.
+     */
+    std::vector<std::string> uncachedReferences(const ManagerLease& lease,
+                                                const std::vector<std::string>& assetIds);
+
+    /**
+     * Forward a query to the resolver server, see resolverClient_,
+     * subject to the same deadlines as manager calls, see
+     * callWithDeadline.
+     *
+     * @throws std::system_error If the server is unavailable, in which
+     * case the query should be answered by a local manager instead, see
+     * warnResolverUnavailable.
+     * @throws std::runtime_error With the server's message, if the
+     * query failed.
+     */
+    resolver_protocol::Strings callResolver(std::string_view method,
+                                            resolver_protocol::Operation operation,
+                                            resolver_protocol::Strings args);
+
+    /**
+     * Warn that the resolver server is unavailable, once until it is
+     * next available.
+     */
+    void warnResolverUnavailable(const std::system_error& exc);
+
+    /**
+     * Configuration of the resolver server's manager, fetched on first
+     * use.
+     *
+     * @throws std::system_error If the server is unavailable.
+     */
+    std::shared_ptr<const ResolverServerInfo> resolverServerInfo(std::string_view method);
+
+    /**
+     * Whether a string is an entity reference of the resolver server's
+     * manager, avoiding a round trip where possible, see
+     * assetIdFilter_.
+     *
+     * @throws std::system_error If the server is unavailable.
+     */
+    bool isEntityReferenceStringViaResolver(std::string_view method, const std::string& str);
+
+    /**
+     * Resolve the path of an asset via the resolver server.
+     *
+     * If the server fails to respond in time, the last path it
+     * returned is used, if available, as per resolvePathForRead.
+     *
+     * @throws std::system_error If the server is unavailable.
+     */
+    std::string resolvePathViaResolver(const std::string& assetId);
+
+    /**
+     * Prefix common to all entity references, if advertised by the
+     * manager, or by the resolver server's manager if a client.
+     */
+    std::optional<std::string> entityReferencePrefix();
+
+    /**
+     * Handle a batch of queries from a resolver client. Called on
+     * resolverServer_'s connection threads.
+     */
+    std::vector<resolver_protocol::Result> handleResolverRequest(
+        const resolver_protocol::Request& request);
+
+    /**
+     * Prefixes of entity references to scan files for, given by the
+     * "prefixes" command argument, else the manager's prefix.
+     *
+     * @throws std::runtime_error If neither is available.
+     */
+    std::vector<std::string> referencePrefixes(const StringMap& commandArgs);
+
+    /**
+     * Scan a file for entity references, and queue any not already
+     * cached to be prefetched. Called on prefetchScanThread_.
+     */
+    void prefetchReferencesInFile(const std::string& path,
+                                  const std::vector<std::string>& prefixes);
+
+    /**
+     * Resolve an asset ID once and generate the path for each of the
+     * given frames, as per resolvePath.
+     */
+    std::vector<std::string> resolvePathRange(const std::string& assetId,
+                                              const std::vector<int>& frames);
+
+    /**
+     * Discard all cached paths, including any refreshes in flight.
+     */
+    void clearPathCache();
+
+    /**
+     * Discard cached data that may be invalidated by changes to
+     * entities, retaining the paths of references to a specific
+     * version, and queue a sample of those for revalidation.
+     *
+     * @param generation Generation of the retained paths.
+     */
+    void clearMutableCacheEntries(std::uint64_t generation);
+
+    /**
+     * Discard cached data that may be invalidated by changes to
+     * entities, retaining the paths of references to a specific
+     * version, including any refreshes in flight.
+     *
+     * @param previousResults If set, populated with the results of the
+     * discarded paths, by reference.
+     * @return Number of paths retained.
+     */
+    std::size_t discardMutableCacheEntries(
+        std::unordered_map<std::string, ChangeReport::Result>* previousResults);
+
+    /**
+     * Discard cached data of the references involved in a publish,
+     * whose content may have changed. Cached data of other references,
+     * and background work for them, is unaffected.
+     *
+     * @param refs References involved in the publish.
+     */
+    void discardPublishedCacheEntries(const std::vector<std::string>& refs);
 
-    [[nodiscard]] std::pair<openassetio::EntityReference, std::string>
-    assetIdToEntityRefAndManagerDrivenValue(const std::string& assetId) const;
+    /**
+     * Re-resolve a batch of retained paths, discarding those that have
+     * changed or no longer resolve. Called on the path revalidator's
+     * thread.
+     */
+    void revalidatePaths(const std::vector<std::string>& refs);
+
+    /**
+     * Re-resolve a batch of references whose paths were discarded on
+     * reset, recording any differences in changeReport_. Called on the
+     * change detector's threads.
+     */
+    void detectChanges(const std::vector<std::string>& refs);
+
+    const openassetio::log::LoggerInterfacePtr logger_;
+
+    /**
+     * Current manager and root context.
+     *
+     * Asset API methods may be called concurrently from any number of
+     * threads. Each call acquires a lease on the current manager
+     * without locking, and uses a context specific to the calling
+     * thread and subsystem. Only `reset()` and the "initialize"
+     * command, which replace the manager, are serialised.
+     */
+    ManagerStateHolder managerState_;
+
+    /// Whether the session is interactive, described to the manager
+    /// via the locale of each call's context.
+    const SessionMode sessionMode_{sessionModeFromEnvironment()};
+
+    /**
+     * Whether the process only reads from the manager, e.g. a render.
+     *
+     * References are then assumed not to change for the lifetime of
+     * the process, so all cached data is kept without expiry, and is
+     * not discarded when Katana flushes its caches. Write APIs are
+     * rejected.
+     */
+    const bool isReadOnly_;
+    ReadOnlyStats readOnlyStats_;
+
+    /**
+     * Memory budget shared by all caches below.
+     *
+     * Configured on construction from the environment, and may be
+     * overridden via the "initialize" command.
+     */
+    CacheMemoryBudget cacheMemoryBudget_;
+
+    /**
+     * Error previously encountered when resolving a reference.
+     */
+    struct NegativeResult
+    {
+        openassetio::errors::BatchElementError error;
+        /// Message of the exception originally thrown.
+        std::string message;
+
+        [[nodiscard]] std::size_t memoryUsage() const;
+    };
 
-    openassetio::log::LoggerInterfacePtr logger_;
-    openassetio::hostApi::ManagerPtr manager_;
-    openassetio::ContextPtr context_;
+    /**
+     * Recently encountered missing entities and invalid references.
+     *
+     * Katana frequently queries references that do not (yet) exist,
+     * e.g. publish targets. Remembering these for a short while avoids
+     * a manager round trip for each repeated query.
+     */
+    ReferenceCache<NegativeResult> negativeCache_{&cacheMemoryBudget_};
+    std::chrono::milliseconds negativeCacheTtl_;
+    NegativeCacheStats negativeCacheStats_;
+
+    /**
+     * Path previously resolved for a reference.
+     */
+    struct CachedPath
+    {
+        InternedPath path;
+        std::chrono::steady_clock::time_point resolvedAt;
+        /// Classification of the reference, determined when first
+        /// resolved. Immutable entries never expire or need refreshing.
+        Mutability mutability;
+        /// Stable version tag of a mutable reference, if any, for
+        /// reporting changes on reset.
+        std::string stableTag;
+
+        [[nodiscard]] std::size_t memoryUsage() const;
+    };
+
+    /// Storage shared by the paths in pathCache_, which it must
+    /// outlive.
+    PathInterner pathInterner_{&cacheMemoryBudget_};
+
+    /**
+     * Recently resolved paths.
+     *
+     * References to a meta-version of an entity may resolve differently
+     * over time, so their cached paths are periodically refreshed, see
+     * resolvePathForRead.
+     */
+    ReferenceCache<CachedPath> pathCache_{&cacheMemoryBudget_};
+    std::chrono::milliseconds pathCacheSoftTtl_;
+    std::chrono::milliseconds pathCacheHardTtl_;
+    /// Incremented when the path cache is cleared, so that background
+    /// refreshes started beforehand can be discarded.
+    std::atomic<std::uint64_t> pathCacheEpoch_{0};
+    PathCacheStats pathCacheStats_;
+
+    /// Reference each publish in flight was started from, by working
+    /// reference, so that its cached path can be discarded once
+    /// published, e.g. when writing to an explicit version. Entries of
+    /// publishes that fail are replaced if the working reference is
+    /// used again.
+    std::mutex publishSourcesMutex_;
+    std::unordered_map<std::string, std::string> publishSources_;
+
+    /**
+     * Registers a background resolve as in flight for its lifetime, so
+     * that references published meanwhile are not cached with results
+     * resolved before the publish.
+     */
+    class BackgroundResolveScope;
+    /// Guards the following, see BackgroundResolveScope.
+    std::mutex publishedRefsMutex_;
+    /// Number of publishes so far.
+    std::uint64_t publishSequence_{0};
+    /// Publish number of each published reference, only kept whilst
+    /// background resolves are in flight.
+    std::unordered_map<std::string, std::uint64_t> publishedRefs_;
+    std::size_t numBackgroundResolves_{0};
+
+    /// Per-method deadlines for manager calls, see callManager.
+    std::map<std::string, std::chrono::milliseconds, std::less<>> callDeadlines_;
+    CircuitBreaker circuitBreaker_;
+    /// Breaker for calls to the resolver server, see resolverClient_.
+    CircuitBreaker resolverCircuitBreaker_;
+    /// Runs manager calls that have a deadline. Calls abandoned after
+    /// their deadline passed may outlive the plugin, see
+    /// DeadlineExecutor.
+    DeadlineExecutor callExecutor_;
+    ManagerCallStats callStats_;
+    /// Groups manager calls into logical operations, to find calls
+    /// that could have been batched.
+    RoundTripMonitor roundTripMonitor_;
+    /// Duration of each Asset API call, by method.
+    HistogramFamily apiCallDurations_{{"method"}, Histogram::kDurationBounds};
+    /// Number of elements in each manager call, by manager method.
+    HistogramFamily managerBatchSizes_{{"call"}, Histogram::kBatchSizeBounds};
+    /// Duration of each publishing Asset API call, by asset type and
+    /// method.
+    HistogramFamily publishDurations_{{"asset_type", "method"}, Histogram::kDurationBounds};
+    /// Duration of each phase of publishing, by asset type and phase.
+    HistogramFamily publishPhaseDurations_{{"asset_type", "phase"}, Histogram::kDurationBounds};
+
+    /**
+     * The most recent query for each reference, within the speculation
+     * window, see takeSpeculativeTraits.
+     */
+    struct RecentCall
+    {
+        std::string method;
+        openassetio::trait::TraitsDataPtr traitsData;
+        /// Traits requested, which may be absent from traitsData if
+        /// the entity does not have them.
+        openassetio::trait::TraitSet resolvedTraitSet;
+        std::chrono::steady_clock::time_point resolvedAt;
+        /// Whether traits beyond those needed by `method` were fetched.
+        bool isSpeculative;
+
+        [[nodiscard]] std::size_t memoryUsage() const;
+    };
+    ReferenceCache<RecentCall> recentCalls_{&cacheMemoryBudget_};
+
+    /**
+     * Traits resolved for a reference in read-only mode, see
+     * resolveForReadOrError.
+     */
+    struct CachedTraits
+    {
+        openassetio::trait::TraitsDataPtr traitsData;
+        /// Traits requested, which may be absent from traitsData if
+        /// the entity does not have them.
+        openassetio::trait::TraitSet resolvedTraitSet;
+
+        [[nodiscard]] std::size_t memoryUsage() const;
+    };
+    ReferenceCache<CachedTraits> readOnlyTraitsCache_{&cacheMemoryBudget_};
+
+    /**
+     * Results of queries other than resolve for a reference in
+     * read-only mode, see rememberReadOnlyQuery.
+     */
+    struct CachedQueries
+    {
+        /// Traits of the entity, if queried by getAssetAttributes.
+        std::optional<openassetio::trait::TraitSet> entityTraits;
+        /// Tags of all versions, if listed by getAssetVersions.
+        std::optional<std::vector<std::string>> versionTags;
+        /// Reference to each version found by
+        /// entityRefForAssetIdAndVersion, by tag, or none if there is
+        /// no such version.
+        std::map<std::string, std::optional<std::string>> versionRefs;
+
+        [[nodiscard]] std::size_t memoryUsage() const;
+    };
+    ReferenceCache<CachedQueries> readOnlyQueryCache_{&cacheMemoryBudget_};
+
+    std::chrono::milliseconds speculationWindow_;
+    CallPatternPredictor callPatternPredictor_;
+    SpeculationStats speculationStats_;
+
+    /// Page size for relationship queries, see getAssetVersions.
+    AdaptivePageSize relationshipPageSize_;
+    PagingStats relationshipPagingStats_;
 
     using FileUrlPathConverterPtr = std::shared_ptr<openassetio::utils::FileUrlPathConverter>;
     FileUrlPathConverterPtr fileUrlPathConverter_{
         std::make_shared<openassetio::utils::FileUrlPathConverter>()};
-    PublishStrategies publishStrategies_{fileUrlPathConverter_};
+    UrlPathConverter urlPathConverter_{fileUrlPathConverter_, &cacheMemoryBudget_};
+    AssetIdFilter assetIdFilter_{&cacheMemoryBudget_};
+    /// Listings of directories scanned when publishing, e.g. for the
+    /// frames of an image sequence.
+    DirectoryScanCache directoryScanCache_;
+    PublishStrategies publishStrategies_{fileUrlPathConverter_, &directoryScanCache_};
+
+    PrefetchStats prefetchStats_;
+
+    // Declared last, so that worker threads are stopped before any
+    // state they use is destroyed.
+    BackgroundRefresher pathRefresher_;
+    BackgroundRefresher pathPrefetcher_;
+    /// Number of retained paths to revalidate on reset.
+    std::size_t resetRevalidationSampleSize_;
+    BackgroundRefresher pathRevalidator_;
+    /// Whether to report references that resolve differently after a
+    /// reset, see changeReport_.
+    const bool reportChangesOnReset_;
+    ChangeReport changeReport_;
+    BackgroundRefresher changeDetector_;
+    std::mutex prefetchScanMutex_;
+    std::thread prefetchScanThread_;
+
+    /// Set if resolve queries are forwarded to a resolver server in
+    /// another process. Shared with calls that may outlive their
+    /// deadline, see callResolver.
+    std::shared_ptr<ResolverClient> resolverClient_;
+    /// Fetched on first use, and forgotten on reset, see
+    /// resolverServerInfo. Accessed atomically.
+    std::shared_ptr<const ResolverServerInfo> resolverServerInfo_;
+    /// Whether the resolver server has been found to be unavailable,
+    /// so that this is only warned of once.
+    std::atomic<bool> isResolverUnavailable_{false};
+    /// Set if serving resolve queries to other processes.
+    std::mutex resolverServerMutex_;
+    std::unique_ptr<ResolverServer> resolverServer_;
+
+    /// Set if periodically writing metrics to a file. Declared last, so
+    /// that the final metrics are written whilst all state is intact.
+    std::unique_ptr<MetricsExporter> metricsExporter_;
 };
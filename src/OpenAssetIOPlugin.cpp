@@ -4,19 +4,29 @@
 #include "OpenAssetIOAsset.hpp"
 
 #include <algorithm>
+#include <charconv>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
+#include <future>
 #include <ios>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <Python.h>
 
@@ -30,7 +40,7 @@
 
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/access.hpp>
-#include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
@@ -52,11 +62,22 @@
 #include <openassetio_mediacreation/traits/threeDimensional/SourcePathTrait.hpp>
 #include <openassetio_mediacreation/traits/usage/RelationshipTrait.hpp>
 
+#include "CircuitBreaker.hpp"
+#include "DeadlineExecutor.hpp"
+#include "FileSequence.hpp"
+#include "IndexExporter.hpp"
 #include "KatanaHostInterface.hpp"
+#include "ManagerState.hpp"
 #include "PublishStrategies.hpp"
+#include "ReferenceScanner.hpp"
+#include "ResolverClient.hpp"
+#include "ResolverProtocol.hpp"
+#include "ResolverServer.hpp"
+#include "Statistics.hpp"
 #include "config.hpp"
 #include "constants.hpp"
 #include "logging.hpp"
+#include "utilities.hpp"
 
 namespace
 {
@@ -114,18 +135,434 @@ struct KatanaLoggerInterface final : openassetio::log::LoggerInterface
 
 constexpr char kAssetFieldKeySep = ',';
 constexpr auto kDisablePythonEnvVar = "KATANAOPENASSETIO_DISABLE_PYTHON";
+constexpr auto kNegativeCacheTtlEnvVar = "KATANAOPENASSETIO_NEGATIVE_CACHE_TTL_MS";
+constexpr std::chrono::milliseconds kDefaultNegativeCacheTtl{5000};
+constexpr auto kPathCacheSoftTtlEnvVar = "KATANAOPENASSETIO_PATH_CACHE_SOFT_TTL_MS";
+constexpr std::chrono::milliseconds kDefaultPathCacheSoftTtl{2000};
+constexpr auto kPathCacheHardTtlEnvVar = "KATANAOPENASSETIO_PATH_CACHE_HARD_TTL_MS";
+constexpr std::chrono::milliseconds kDefaultPathCacheHardTtl{30000};
+// Time to wait for further stale paths to be requested, so that they
+// can be refreshed together.
+constexpr std::chrono::milliseconds kPathRefreshBatchDelay{20};
+// Number of batches of references found in a scanned file that may
+// be prefetched concurrently.
+constexpr std::size_t kNumPrefetchThreads = 4;
+constexpr std::string_view kGzipMagic = "\x1f\x8b";
+constexpr auto kCallDeadlinesEnvVar = "KATANAOPENASSETIO_CALL_DEADLINES_MS";
+// Key in kCallDeadlinesEnvVar of the deadline for methods not
+// otherwise listed.
+constexpr std::string_view kDefaultCallDeadlineKey = "*";
+constexpr auto kCircuitBreakerProbeIntervalEnvVar =
+    "KATANAOPENASSETIO_CIRCUIT_BREAKER_PROBE_INTERVAL_MS";
+constexpr std::chrono::milliseconds kDefaultCircuitBreakerProbeInterval{5000};
+// Number of consecutive missed deadlines after which the manager is no
+// longer called.
+constexpr std::size_t kCircuitBreakerThreshold = 3;
+constexpr auto kOperationGapEnvVar = "KATANAOPENASSETIO_OPERATION_GAP_MS";
+constexpr std::chrono::milliseconds kDefaultOperationGap{100};
+constexpr auto kBatchableCallThresholdEnvVar = "KATANAOPENASSETIO_BATCHABLE_CALL_THRESHOLD";
+constexpr auto kRoundTripBudgetEnvVar = "KATANAOPENASSETIO_ROUND_TRIP_BUDGET";
+constexpr auto kMetricsTextfileEnvVar = "KATANAOPENASSETIO_METRICS_TEXTFILE";
+constexpr auto kMetricsIntervalEnvVar = "KATANAOPENASSETIO_METRICS_INTERVAL_MS";
+constexpr std::chrono::milliseconds kDefaultMetricsInterval{15000};
+constexpr auto kResolverSocketEnvVar = "KATANAOPENASSETIO_RESOLVER_SOCKET";
+constexpr auto kResolverTimeoutEnvVar = "KATANAOPENASSETIO_RESOLVER_TIMEOUT_MS";
+constexpr auto kResolverMaxConnectionsEnvVar = "KATANAOPENASSETIO_RESOLVER_MAX_CONNECTIONS";
+constexpr std::size_t kDefaultResolverMaxConnections = 64;
+constexpr std::chrono::milliseconds kDefaultResolverTimeout{30000};
+constexpr auto kSpeculationWindowEnvVar = "KATANAOPENASSETIO_SPECULATION_WINDOW_MS";
+constexpr std::chrono::milliseconds kDefaultSpeculationWindow{1000};
+constexpr auto kSpeculationThresholdEnvVar = "KATANAOPENASSETIO_SPECULATION_THRESHOLD_PERCENT";
+constexpr std::size_t kDefaultSpeculationThresholdPercent = 50;
+// Number of calls to a method to observe before speculating on its
+// follow-up calls.
+constexpr std::size_t kMinSpeculationCalls = 8;
+constexpr auto kPageSizeEnvVar = "KATANAOPENASSETIO_PAGE_SIZE";
+constexpr auto kPageTargetLatencyEnvVar = "KATANAOPENASSETIO_PAGE_TARGET_LATENCY_MS";
+constexpr std::chrono::milliseconds kDefaultPageTargetLatency{100};
+constexpr std::size_t kMinPageSize = 1;
+constexpr std::size_t kMaxPageSize = 16384;
+// Also accepted as a setting by the "initialize" command.
+constexpr auto kCacheBudgetEnvVar = "KATANAOPENASSETIO_CACHE_BUDGET_MB";
+constexpr std::size_t kDefaultCacheBudgetMb = 256;
+constexpr std::size_t kBytesPerMb = 1024 * 1024;
+constexpr auto kReadOnlyEnvVar = "KATANAOPENASSETIO_READ_ONLY";
+// Value of kReadOnlyEnvVar enabling read-only mode in batch sessions.
+constexpr std::string_view kReadOnlyInBatchMode = "batch";
+constexpr auto kResetRevalidationSampleEnvVar = "KATANAOPENASSETIO_RESET_REVALIDATION_SAMPLE";
+constexpr std::size_t kDefaultResetRevalidationSample = 16;
+constexpr auto kReportChangesOnResetEnvVar = "KATANAOPENASSETIO_REPORT_CHANGES_ON_RESET";
+constexpr auto kDirectoryScanLimitEnvVar = "KATANAOPENASSETIO_DIRECTORY_SCAN_CACHE_SIZE";
+// Well within the default per-user inotify watch limit.
+constexpr std::size_t kDefaultDirectoryScanLimit = 256;
+
+/**
+ * Whether read-only mode is enabled via the environment: "1" to enable,
+ * or "batch" to enable in batch sessions only.
+ */
+bool isReadOnlyFromEnvVar(const SessionMode sessionMode)
+{
+    const char* envVarValue = std::getenv(kReadOnlyEnvVar);
+    if (envVarValue == nullptr)
+    {
+        return false;
+    }
+    const std::string_view value{envVarValue};
+    if (value == kReadOnlyInBatchMode)
+    {
+        return sessionMode == SessionMode::kBatch;
+    }
+    return value == "1";
+}
+
+/**
+ * Whether an error implies that the entity does not exist or the
+ * reference is unusable, irrespective of which traits were requested.
+ *
+ * Other errors (e.g. access/auth errors) may be transient or
+ * context-dependent, so are not worth remembering.
+ */
+bool isNegativelyCacheable(const openassetio::errors::BatchElementError& error)
+{
+    using ErrorCode = openassetio::errors::BatchElementError::ErrorCode;
+    switch (error.code)
+    {
+    case ErrorCode::kEntityResolutionError:
+    case ErrorCode::kInvalidEntityReference:
+    case ErrorCode::kMalformedEntityReference:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Release the GIL, if held by the calling thread, for the lifetime of
+ * this object.
+ */
+class ScopedGilRelease
+{
+public:
+    ScopedGilRelease()
+        : threadState_{Py_IsInitialized() && PyGILState_Check() ? PyEval_SaveThread() : nullptr}
+    {
+    }
+
+    ~ScopedGilRelease()
+    {
+        if (threadState_ != nullptr)
+        {
+            PyEval_RestoreThread(threadState_);
+        }
+    }
+
+    ScopedGilRelease(const ScopedGilRelease&) = delete;
+    ScopedGilRelease& operator=(const ScopedGilRelease&) = delete;
+    ScopedGilRelease(ScopedGilRelease&&) = delete;
+    ScopedGilRelease& operator=(ScopedGilRelease&&) = delete;
+
+private:
+    PyThreadState* threadState_;
+};
+
+/**
+ * Approximate memory owned by a TraitsData instance.
+ */
+std::size_t traitsDataMemoryUsage(const openassetio::trait::TraitsDataPtr& traitsData)
+{
+    if (!traitsData)
+    {
+        return 0;
+    }
+    std::size_t bytes = sizeof(openassetio::trait::TraitsData);
+    for (const auto& traitId : traitsData->traitSet())
+    {
+        bytes += sizeof(traitId) + heapBytes(traitId);
+        for (const auto& traitPropertyKey : traitsData->traitPropertyKeys(traitId))
+        {
+            openassetio::trait::property::Value value;
+            traitsData->getTraitProperty(&value, traitId, traitPropertyKey);
+            bytes += sizeof(traitPropertyKey) + heapBytes(traitPropertyKey) + sizeof(value);
+            if (const auto* str = std::get_if<openassetio::Str>(&value))
+            {
+                bytes += heapBytes(*str);
+            }
+        }
+    }
+    return bytes;
+}
+
+/**
+ * Classify a reference from its resolved VersionTrait.
+ *
+ * A reference is immutable if it names a specific version, i.e. its
+ * specified version tag is the same as the stable tag it resolves to.
+ * References without version information are assumed mutable.
+ */
+Mutability mutabilityFromVersion(const openassetio::trait::TraitsDataPtr& traitsData)
+{
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    const VersionTrait versionTrait{traitsData};
+    const auto specifiedTag = versionTrait.getSpecifiedTag();
+    const auto stableTag = versionTrait.getStableTag();
+    return specifiedTag && stableTag && *specifiedTag == *stableTag ? Mutability::kImmutable
+                                                                    : Mutability::kMutable;
+}
+
+/**
+ * Convert a CPython `id` number, stored in a string, to a PyObject
+ * pointer.
+ */
+PyObject* pyIdStrToObj(const std::string& pyIdAsStr)
+{
+    std::intptr_t pyId = 0;
+    std::stringstream sstr{pyIdAsStr};
+    sstr >> pyId;
+    // NOLINTNEXTLINE(*-pro-type-reinterpret-cast, *-no-int-to-ptr)
+    return reinterpret_cast<PyObject*>(pyId);
+}
+
+/**
+ * Set a string value in a Python dict.
+ */
+void setPyDictString(PyObject* pyDict, const char* key, const std::string& value)
+{
+    PyObject* pyValue =
+        PyUnicode_FromStringAndSize(value.data(), static_cast<Py_ssize_t>(value.size()));
+    PyDict_SetItemString(pyDict, key, pyValue);
+    Py_DECREF(pyValue);
+}
+
+/**
+ * Set a counter value in a Python dict.
+ */
+void setPyDictCount(PyObject* pyDict, const char* key, const std::uint64_t count)
+{
+    PyObject* pyValue = PyLong_FromUnsignedLongLong(count);
+    PyDict_SetItemString(pyDict, key, pyValue);
+    Py_DECREF(pyValue);
+}
+
+void setPyDictCount(PyObject* pyDict, const char* key, const Counter& counter)
+{
+    setPyDictCount(pyDict, key, counter.value());
+}
+
+/**
+ * Set a floating point value in a Python dict.
+ */
+void setPyDictFloat(PyObject* pyDict, const char* key, const double value)
+{
+    PyObject* pyValue = PyFloat_FromDouble(value);
+    PyDict_SetItemString(pyDict, key, pyValue);
+    Py_DECREF(pyValue);
+}
+
+/**
+ * Set the count, total and estimated median and 99th percentile of a
+ * family of duration histograms, as a dict of dicts per label value in
+ * a Python dict, e.g. `{assetType: {phase: {"count": ...}}}`.
+ */
+void setPyDictDurations(PyObject* pyDict, const char* key, const HistogramFamily& family)
+{
+    PyObject* pyFamilyDict = PyDict_New();
+    family.forEach(
+        [&](const HistogramFamily::LabelValues& labelValues, const Histogram& histogram)
+        {
+            PyObject* pyParentDict = pyFamilyDict;
+            for (std::size_t idx = 0; idx + 1 < labelValues.size(); ++idx)
+            {
+                const char* childKey = labelValues[idx].c_str();
+                // Borrowed reference.
+                PyObject* pyChildDict = PyDict_GetItemString(pyParentDict, childKey);
+                if (pyChildDict == nullptr)
+                {
+                    pyChildDict = PyDict_New();
+                    PyDict_SetItemString(pyParentDict, childKey, pyChildDict);
+                    Py_DECREF(pyChildDict);
+                }
+                pyParentDict = pyChildDict;
+            }
+
+            PyObject* pyHistogramDict = PyDict_New();
+            setPyDictCount(pyHistogramDict, "count", histogram.count());
+            setPyDictFloat(pyHistogramDict, "seconds", histogram.sum());
+            setPyDictFloat(pyHistogramDict, "p50", histogram.quantile(0.5));
+            setPyDictFloat(pyHistogramDict, "p99", histogram.quantile(0.99));
+            PyDict_SetItemString(pyParentDict, labelValues.back().c_str(), pyHistogramDict);
+            Py_DECREF(pyHistogramDict);
+        });
+    PyDict_SetItemString(pyDict, key, pyFamilyDict);
+    Py_DECREF(pyFamilyDict);
+}
+
+/**
+ * Set the number of entries and bytes used by a cache, and the number
+ * of entries evicted, as a dict in a Python dict.
+ */
+template <class Value>
+void setPyDictCacheOccupancy(PyObject* pyDict, const char* key, const ReferenceCache<Value>& cache)
+{
+    PyObject* pyCacheDict = PyDict_New();
+    setPyDictCount(pyCacheDict, "entries", cache.size());
+    setPyDictCount(pyCacheDict, "bytes", cache.memoryUsage());
+    setPyDictCount(pyCacheDict, "evictions", cache.evictions());
+    PyDict_SetItemString(pyDict, key, pyCacheDict);
+    Py_DECREF(pyCacheDict);
+}
+
+/**
+ * Split an asset ID into its entity reference and any manager-driven
+ * value, see OpenAssetIOAsset::createAssetAndPath.
+ */
+std::pair<std::string, std::string> splitManagerDrivenValue(const std::string& assetId)
+{
+    auto refAndManagerDrivenValue =
+        pystring::rsplit(assetId, constants::kAssetIdManagerDrivenValueSep, 1);
+    return {std::move(refAndManagerDrivenValue.front()),
+            refAndManagerDrivenValue.size() > 1 ? std::move(refAndManagerDrivenValue.back()) : ""};
+}
 
 using Severity = openassetio::log::LoggerInterface::Severity;
 }  // namespace
 
 OpenAssetIOAsset::OpenAssetIOAsset()
+    : logger_{std::make_shared<KatanaLoggerInterface>()},
+      isReadOnly_{isReadOnlyFromEnvVar(sessionMode_)},
+      cacheMemoryBudget_{utilities::sizeFromEnvVar(kCacheBudgetEnvVar, kDefaultCacheBudgetMb) *
+                         kBytesPerMb},
+      negativeCacheTtl_{
+          utilities::millisecondsFromEnvVar(kNegativeCacheTtlEnvVar, kDefaultNegativeCacheTtl)},
+      pathCacheSoftTtl_{
+          utilities::millisecondsFromEnvVar(kPathCacheSoftTtlEnvVar, kDefaultPathCacheSoftTtl)},
+      pathCacheHardTtl_{
+          utilities::millisecondsFromEnvVar(kPathCacheHardTtlEnvVar, kDefaultPathCacheHardTtl)},
+      callDeadlines_{utilities::namedMillisecondsFromEnvVar(kCallDeadlinesEnvVar)},
+      circuitBreaker_{kCircuitBreakerThreshold,
+                      utilities::millisecondsFromEnvVar(kCircuitBreakerProbeIntervalEnvVar,
+                                                        kDefaultCircuitBreakerProbeInterval)},
+      resolverCircuitBreaker_{kCircuitBreakerThreshold, circuitBreaker_.probeInterval()},
+      callExecutor_{std::max(std::thread::hardware_concurrency(), 1U)},
+      roundTripMonitor_{
+          utilities::millisecondsFromEnvVar(kOperationGapEnvVar, kDefaultOperationGap),
+          utilities::sizeFromEnvVar(kBatchableCallThresholdEnvVar, 0),
+          utilities::sizeFromEnvVar(kRoundTripBudgetEnvVar, 0)},
+      speculationWindow_{
+          utilities::millisecondsFromEnvVar(kSpeculationWindowEnvVar, kDefaultSpeculationWindow)},
+      callPatternPredictor_{static_cast<double>(utilities::sizeFromEnvVar(
+                                kSpeculationThresholdEnvVar, kDefaultSpeculationThresholdPercent)) /
+                                100,
+                            kMinSpeculationCalls},
+      relationshipPageSize_{
+          utilities::sizeFromEnvVar(kPageSizeEnvVar, constants::kPageSize),
+          kMinPageSize,
+          kMaxPageSize,
+          utilities::millisecondsFromEnvVar(kPageTargetLatencyEnvVar, kDefaultPageTargetLatency)},
+      directoryScanCache_{
+          utilities::sizeFromEnvVar(kDirectoryScanLimitEnvVar, kDefaultDirectoryScanLimit)},
+      pathRefresher_{[this](const std::vector<std::string>& refs) { refreshPaths(refs); },
+                     constants::kPageSize,
+                     kPathRefreshBatchDelay},
+      pathPrefetcher_{[this](const std::vector<std::string>& refs) { prefetchPaths(refs); },
+                      constants::kPageSize,
+                      std::chrono::milliseconds{0},
+                      kNumPrefetchThreads},
+      resetRevalidationSampleSize_{utilities::sizeFromEnvVar(kResetRevalidationSampleEnvVar,
+                                                             kDefaultResetRevalidationSample)},
+      pathRevalidator_{[this](const std::vector<std::string>& refs) { revalidatePaths(refs); },
+                       constants::kPageSize,
+                       std::chrono::milliseconds{0}},
+      reportChangesOnReset_{utilities::sizeFromEnvVar(kReportChangesOnResetEnvVar, 0) != 0},
+      changeDetector_{[this](const std::vector<std::string>& refs) { detectChanges(refs); },
+                      constants::kPageSize,
+                      std::chrono::milliseconds{0},
+                      kNumPrefetchThreads}
 {
+    if (const char* resolverSocket = std::getenv(kResolverSocketEnvVar);
+        resolverSocket != nullptr && *resolverSocket != '\0')
+    {
+        resolverClient_ = std::make_shared<ResolverClient>(
+            resolverSocket,
+            utilities::millisecondsFromEnvVar(kResolverTimeoutEnvVar, kDefaultResolverTimeout));
+    }
     OpenAssetIOAsset::reset();
+
+    if (const char* metricsTextfile = std::getenv(kMetricsTextfileEnvVar);
+        metricsTextfile != nullptr && *metricsTextfile != '\0')
+    {
+        metricsExporter_ = std::make_unique<MetricsExporter>(
+            metricsTextfile,
+            utilities::millisecondsFromEnvVar(kMetricsIntervalEnvVar, kDefaultMetricsInterval),
+            [this] { return renderMetrics(); },
+            [this](const std::exception& exc)
+            {
+                if (logger_->isSeverityLogged(Severity::kWarning))
+                {
+                    logger_->warning(logging::concatAsStr(
+                        "OpenAssetIOAsset: failed to write metrics: ", exc.what()));
+                }
+            });
+    }
 }
 
-OpenAssetIOAsset::~OpenAssetIOAsset() = default;
+OpenAssetIOAsset::~OpenAssetIOAsset()
+{
+    // Background threads may be waiting on the GIL in order to call a
+    // Python manager, so we must not hold it whilst waiting for them to
+    // finish.
+    const ScopedGilRelease releaseGil;
+    {
+        // Stop serving first, since requests use all other state.
+        const std::lock_guard lock{resolverServerMutex_};
+        resolverServer_.reset();
+    }
+    {
+        const std::lock_guard lock{prefetchScanMutex_};
+        if (prefetchScanThread_.joinable())
+        {
+            prefetchScanThread_.join();
+        }
+    }
+    changeDetector_.stop();
+    pathRevalidator_.stop();
+    pathPrefetcher_.stop();
+    pathRefresher_.stop();
+}
 
 void OpenAssetIOAsset::reset()
+{
+    const ScopedTimer callTimer{apiCallDurations_.get({"reset"})};
+    try
+    {
+        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        {
+            logger_->debugApi("OpenAssetIOAsset::reset()");
+        }
+
+        if (resolverClient_)
+        {
+            // Queries are answered by the resolver server, whose
+            // manager may since have been reconfigured.
+            std::atomic_store(&resolverServerInfo_, std::shared_ptr<const ResolverServerInfo>{});
+            resolverCircuitBreaker_.reset();
+            if (!managerState_.isPublished())
+            {
+                // Nothing to reset until a manager is needed, see
+                // acquireManager.
+                return;
+            }
+        }
+        createManager(/*isFirstUse=*/false);
+    }
+    catch (const std::exception& exc)
+    {
+        FnLogError(exc.what());
+        throw;
+    }
+}
+
+void OpenAssetIOAsset::createManager(const bool isFirstUse)
 {
     using openassetio::hostApi::ManagerFactory;
     using openassetio::hostApi::ManagerImplementationFactoryInterfacePtr;
@@ -133,55 +570,153 @@ void OpenAssetIOAsset::reset()
     using openassetio::pluginSystem::HybridPluginSystemManagerImplementationFactory;
     namespace pyApi = openassetio::python::hostApi;
 
-    try
+    // Serialise with any concurrent reset/initialize. Readers are not
+    // blocked - they continue to use the previous manager until the new
+    // one is published.
+    const auto writerLock = managerState_.lockForWriting();
+
+    if (isFirstUse && managerState_.current())
     {
-        logger_ = std::make_shared<KatanaLoggerInterface>();
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        // Created by another thread whilst waiting for the lock.
+        return;
+    }
+
+    if (isReadOnly_ && managerState_.current())
+    {
+        // Nothing can have changed, so keep the manager and caches.
+        if (logger_->isSeverityLogged(Severity::kDebug))
         {
-            logger_->debugApi("OpenAssetIOAsset::reset()");
+            logger_->debug("OpenAssetIOAsset::reset() ignored in read-only mode");
         }
+        return;
+    }
 
-        // Create the appropriate plugin system.
-        const auto managerImplFactory = [&]() -> ManagerImplementationFactoryInterfacePtr
+    // Create the appropriate plugin system.
+    const auto managerImplFactory = [&]() -> ManagerImplementationFactoryInterfacePtr
+    {
+        if (const char* disablePythonEnvVar = std::getenv(kDisablePythonEnvVar);
+            disablePythonEnvVar && std::string_view{disablePythonEnvVar} != "0")
         {
-            if (const char* disablePythonEnvVar = std::getenv(kDisablePythonEnvVar);
-                disablePythonEnvVar && std::string_view{disablePythonEnvVar} != "0")
-            {
-                // User has chosen to disable Python manager plugins. So
-                // just use the C++ plugin system.
-                return CppPluginSystemManagerImplementationFactory::make(logger_);
-            }
-            // Support  C++ or Python or hybrid C++/Python plugins.
-            return HybridPluginSystemManagerImplementationFactory::make(
-                {// Plugin systems:
-                 // C++ plugin system
-                 CppPluginSystemManagerImplementationFactory::make(logger_),
-                 // Python plugin system
-                 pyApi::createPythonPluginSystemManagerImplementationFactory(logger_)},
-                logger_);
-        }();
+            // User has chosen to disable Python manager plugins. So
+            // just use the C++ plugin system.
+            return CppPluginSystemManagerImplementationFactory::make(logger_);
+        }
+        // Support  C++ or Python or hybrid C++/Python plugins.
+        return HybridPluginSystemManagerImplementationFactory::make(
+            {// Plugin systems:
+             // C++ plugin system
+             CppPluginSystemManagerImplementationFactory::make(logger_),
+             // Python plugin system
+             pyApi::createPythonPluginSystemManagerImplementationFactory(logger_)},
+            logger_);
+    }();
+
+    auto manager = ManagerFactory::defaultManagerForInterface(
+        std::make_shared<KatanaHostInterface>(), managerImplFactory, logger_);
+
+    if (!manager)
+    {
+        throw openassetio::errors::ConfigurationException{
+            "No default OpenAssetIO manager configured. Set OPENASSETIO_DEFAULT_CONFIG."};
+    }
+
+    const ManagerStatePtr previousState = managerState_.current();
+    auto state = std::make_shared<const ManagerState>(
+        std::move(manager), managerImplFactory, sessionMode_);
+    const std::uint64_t generation = state->generation();
+    managerState_.publish(writerLock, std::move(state));
 
-        manager_ = ManagerFactory::defaultManagerForInterface(
-            std::make_shared<KatanaHostInterface>(), managerImplFactory, logger_);
+    negativeCache_.clear();
+    if (previousState && previousState->generation() == generation)
+    {
+        // Same manager configuration, so paths resolved for
+        // specific versions remain valid.
+        clearMutableCacheEntries(generation);
+    }
+    else if (previousState)
+    {
+        clearPathCache();
+    }
+    circuitBreaker_.reset();
+}
 
-        if (!manager_)
+ManagerLease OpenAssetIOAsset::acquireManager(const Subsystem subsystem)
+{
+    if (!managerState_.isPublished())
+    {
+        // Deferred by a resolver client, see reset().
+        try
+        {
+            createManager(/*isFirstUse=*/true);
+        }
+        catch (const std::exception& exc)
         {
-            throw openassetio::errors::ConfigurationException{
-                "No default OpenAssetIO manager configured. Set OPENASSETIO_DEFAULT_CONFIG."};
+            FnLogError(exc.what());
+            throw;
         }
+    }
+    return managerState_.acquire(subsystem);
+}
+
+std::size_t OpenAssetIOAsset::NegativeResult::memoryUsage() const
+{
+    return heapBytes(error.message) + heapBytes(message);
+}
+
+std::size_t OpenAssetIOAsset::CachedPath::memoryUsage() const
+{
+    return path.memoryUsage() + heapBytes(stableTag);
+}
 
-        context_ = manager_->createContext();
+std::size_t OpenAssetIOAsset::CachedTraits::memoryUsage() const
+{
+    std::size_t bytes = traitsDataMemoryUsage(traitsData);
+    for (const auto& traitId : resolvedTraitSet)
+    {
+        bytes += sizeof(traitId) + heapBytes(traitId);
     }
-    catch (const std::exception& exc)
+    return bytes;
+}
+
+std::size_t OpenAssetIOAsset::CachedQueries::memoryUsage() const
+{
+    std::size_t bytes = 0;
+    if (entityTraits)
     {
-        FnLogError(exc.what());
-        throw;
+        for (const auto& traitId : *entityTraits)
+        {
+            bytes += sizeof(traitId) + heapBytes(traitId);
+        }
+    }
+    if (versionTags)
+    {
+        for (const std::string& tag : *versionTags)
+        {
+            bytes += sizeof(tag) + heapBytes(tag);
+        }
+    }
+    for (const auto& [tag, ref] : versionRefs)
+    {
+        bytes += sizeof(tag) + heapBytes(tag) + sizeof(ref) + (ref ? heapBytes(*ref) : 0);
+    }
+    return bytes;
+}
+
+std::size_t OpenAssetIOAsset::RecentCall::memoryUsage() const
+{
+    std::size_t bytes = heapBytes(method) + traitsDataMemoryUsage(traitsData);
+    for (const auto& traitId : resolvedTraitSet)
+    {
+        bytes += sizeof(traitId) + heapBytes(traitId);
     }
+    return bytes;
 }
 
-std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetIdAndVersion(
-    const std::string& assetId,
-    const std::string& desiredVersionTag) const
+std::variant<openassetio::errors::BatchElementError, std::optional<openassetio::EntityReference>>
+OpenAssetIOAsset::entityRefForAssetIdAndVersion(const ManagerLease& lease,
+                                                const std::string_view method,
+                                                const std::string& assetId,
+                                                const std::string& desiredVersionTag)
 {
     // The "specifiedTag" property of the "Version" trait, when used in
     // a relationship query, acts as a filter predicate. We assume that
@@ -197,14 +732,49 @@ std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetI
 
     using openassetio::EntityReference;
     using openassetio::access::RelationsAccess;
-    using openassetio::access::ResolveAccess;
+    using openassetio::errors::BatchElementError;
     using openassetio_mediacreation::specifications::lifecycle::
         EntityVersionsRelationshipSpecification;
-    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+    using BatchElementErrorPolicyTag = openassetio::hostApi::Manager::BatchElementErrorPolicyTag;
+
+    const auto& manager = lease.manager();
 
     // Validate the asset ID and get a strongly typed wrapper for
     // subsequent queries.
-    const EntityReference sourceEntityRef = manager_->createEntityReference(assetId);
+    const std::optional<EntityReference> sourceEntityRef =
+        manager->createEntityReferenceIfValid(assetId);
+    if (!sourceEntityRef)
+    {
+        return BatchElementError{BatchElementError::ErrorCode::kMalformedEntityReference,
+                                 "Invalid entity reference: " + assetId};
+    }
+
+    if (isReadOnly_)
+    {
+        auto cachedRef = readOnlyQueryCache_.visit(
+            assetId,
+            lease.state->generation(),
+            [&](const CachedQueries& cached) -> std::optional<std::optional<std::string>>
+            {
+                const auto refIt = cached.versionRefs.find(desiredVersionTag);
+                if (refIt == cached.versionRefs.end())
+                {
+                    return std::nullopt;
+                }
+                return refIt->second;
+            });
+        if (cachedRef && *cachedRef)
+        {
+            readOnlyStats_.queryHits.increment();
+            const std::optional<std::string>& versionedRef = **cachedRef;
+            if (!versionedRef)
+            {
+                return std::nullopt;
+            }
+            return std::optional{manager->createEntityReference(*versionedRef)};
+        }
+        readOnlyStats_.queryMisses.increment();
+    }
 
     // Relationship to get references to different versions of
     // the same logical entity.
@@ -216,23 +786,65 @@ std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetI
     // We only want/expect one corresponding versioned reference.
     constexpr std::size_t kNumExpectedResults = 1;
 
+    // References that point to the given version of the asset, and
+    // whether there are more.
+    using VersionedRefs = std::pair<openassetio::EntityReferences, bool>;
+
     // Get references that point to the given version of the asset.
-    const auto versionsPager = manager_->getWithRelationship(sourceEntityRef,
-                                                             relationship.traitsData(),
-                                                             kNumExpectedResults,
-                                                             RelationsAccess::kRead,
-                                                             context_,
-                                                             {});
-    if (versionsPager->hasNext())
+    auto maybeVersionedRefs = callManager(
+        lease,
+        method,
+        "getWithRelationship",
+        1,
+        relationship.traitsData()->traitSet(),
+        [manager,
+         sourceEntityRef = *sourceEntityRef,
+         relationshipTraitsData = relationship.traitsData()](const openassetio::ContextPtr& context)
+            -> std::variant<BatchElementError, VersionedRefs>
+        {
+            auto maybeVersionsPager =
+                manager->getWithRelationship(sourceEntityRef,
+                                             relationshipTraitsData,
+                                             kNumExpectedResults,
+                                             RelationsAccess::kRead,
+                                             context,
+                                             {},
+                                             BatchElementErrorPolicyTag::kVariant);
+            if (auto* pagerError = std::get_if<BatchElementError>(&maybeVersionsPager))
+            {
+                return std::move(*pagerError);
+            }
+            const auto& versionsPager =
+                std::get<openassetio::hostApi::EntityReferencePagerPtr>(maybeVersionsPager);
+            // Get first page of references, which should have a page
+            // size of 1, i.e. a single-element array.
+            return VersionedRefs{versionsPager->get(), versionsPager->hasNext()};
+        });
+    if (auto* pagerError = std::get_if<BatchElementError>(&maybeVersionedRefs))
+    {
+        return std::move(*pagerError);
+    }
+    const auto& [versionedRefs, hasMoreVersionedRefs] = std::get<VersionedRefs>(maybeVersionedRefs);
+
+    if (hasMoreVersionedRefs)
     {
         FnLogDebug("OpenAssetIOAsset: more than one result querying specific version for asset '"
                    << assetId << "' and version '" << desiredVersionTag
                    << "' - ignoring remainder");
     }
 
-    // Get first page of references, which should have a page size of 1,
-    // i.e. a single-element array.
-    const auto versionedRefs = versionsPager->get();
+    if (isReadOnly_)
+    {
+        std::optional<std::string> versionedRef;
+        if (!versionedRefs.empty())
+        {
+            versionedRef = versionedRefs.front().toString();
+        }
+        rememberReadOnlyQuery(lease,
+                              assetId,
+                              [&](CachedQueries& cached)
+                              { cached.versionRefs[desiredVersionTag] = std::move(versionedRef); });
+    }
 
     if (versionedRefs.empty())
     {
@@ -242,17 +854,29 @@ std::optional<openassetio::EntityReference> OpenAssetIOAsset::entityRefForAssetI
     }
 
     // Return the matching reference.
-    return versionedRefs.front();
+    return std::optional{versionedRefs.front()};
 }
 
 bool OpenAssetIOAsset::isAssetId(const std::string& name)
 {
-    const auto result = manager_->isEntityReferenceString(name);
-    return result;
+    const ScopedTimer callTimer{apiCallDurations_.get({"isAssetId"})};
+    if (resolverClient_)
+    {
+        try
+        {
+            return isEntityReferenceStringViaResolver("isAssetId", name);
+        }
+        catch (const std::system_error& exc)
+        {
+            warnResolverUnavailable(exc);
+        }
+    }
+    return isEntityReferenceString(acquireManager(), "isAssetId", name);
 }
 
 bool OpenAssetIOAsset::containsAssetId(const std::string& name)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"containsAssetId"})};
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -260,18 +884,13 @@ bool OpenAssetIOAsset::containsAssetId(const std::string& name)
             logger_->debugApi(
                 logging::concatAsStr("OpenAssetIOAsset::containsAssetId(name=", name, ")"));
         }
-        using openassetio::constants::kInfoKey_EntityReferencesMatchPrefix;
-        const auto info = manager_->info();
-        // NOLINTNEXTLINE(*-suspicious-stringview-data-usage)
-        const auto prefixKey = info.find(kInfoKey_EntityReferencesMatchPrefix.data());
-        if (prefixKey == info.end())
+        const std::optional<std::string> prefix = entityReferencePrefix();
+        if (!prefix)
         {
             throw std::runtime_error("OpenAssetIO does not provide entity reference prefix.");
         }
 
-        const auto prefix = std::get<std::string>(prefixKey->second);
-
-        const bool isContained = name.find(prefix) != std::string::npos;
+        const bool isContained = name.find(*prefix) != std::string::npos;
 
         if (logger_->isSeverityLogged(Severity::kDebugApi))
         {
@@ -293,6 +912,7 @@ bool OpenAssetIOAsset::containsAssetId(const std::string& name)
 
 bool OpenAssetIOAsset::checkPermissions(const std::string& assetId, const StringMap& context)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"checkPermissions"})};
     if (logger_->isSeverityLogged(Severity::kDebugApi))
     {
         logger_->debugApi(logging::concatAsStr(
@@ -319,16 +939,105 @@ bool OpenAssetIOAsset::runAssetPluginCommand(const std::string& assetId,
                                                commandArgs,
                                                ")"));
     }
-    (void)assetId;
 
     if (command == "initialize")
     {
         // Re-`initialize` the manager with updated settings. Will only
         // work for string-valued settings (otherwise with throw). Note
         // that partial updates are supported as per the API contract.
+        //
+        // Rather than re-initializing the current manager in place, we
+        // initialize a new instance with the merged settings and
+        // publish it once ready. Calls in flight on other threads can
+        // then complete undisturbed against the previous instance.
+        //
+        // If the merged settings are unchanged, e.g. by repeated
+        // initialization from launch scripts, the current manager is
+        // kept, along with its cached results. Otherwise, cached
+        // results are keyed by the generation of the manager
+        // configuration, so are also retained if a new manager ends up
+        // with the same settings.
         try
         {
-            manager_->initialize({cbegin(commandArgs), cend(commandArgs)});
+            using openassetio::hostApi::ManagerFactory;
+
+            // The cache memory budget is a setting of this plugin,
+            // rather than of the manager.
+            StringMap managerSettings = commandArgs;
+            if (const auto budgetIt = managerSettings.find(kCacheBudgetEnvVar);
+                budgetIt != managerSettings.end())
+            {
+                const std::string& budgetStr = budgetIt->second;
+                std::size_t budgetMb = 0;
+                const char* const budgetEnd = budgetStr.data() + budgetStr.size();
+                if (const auto result = std::from_chars(budgetStr.data(), budgetEnd, budgetMb);
+                    result.ec != std::errc{} || result.ptr != budgetEnd)
+                {
+                    throw std::invalid_argument{
+                        logging::concatAsStr("Invalid ", kCacheBudgetEnvVar, ": ", budgetStr)};
+                }
+                cacheMemoryBudget_.setLimit(budgetMb * kBytesPerMb);
+                managerSettings.erase(budgetIt);
+
+                if (managerSettings.empty())
+                {
+                    return true;
+                }
+            }
+
+            // Create a deferred manager before taking the lock, since
+            // doing so takes the lock itself.
+            static_cast<void>(acquireManager());
+            const auto writerLock = managerState_.lockForWriting();
+            const ManagerStatePtr currentState = managerState_.current();
+            const auto& currentManager = currentState->manager();
+
+            const openassetio::InfoDictionary currentSettings = currentManager->settings();
+            openassetio::InfoDictionary settings = currentSettings;
+            for (const auto& [key, value] : managerSettings)
+            {
+                settings[key] = value;
+            }
+            if (settings == currentSettings)
+            {
+                if (logger_->isSeverityLogged(Severity::kDebug))
+                {
+                    logger_->debug(
+                        "OpenAssetIOAsset::runAssetPluginCommand: manager settings unchanged, "
+                        "retaining manager");
+                }
+                return true;
+            }
+
+            auto manager =
+                ManagerFactory::createManagerForInterface(currentManager->identifier(),
+                                                          std::make_shared<KatanaHostInterface>(),
+                                                          currentState->implFactory(),
+                                                          logger_);
+            manager->initialize(std::move(settings));
+
+            auto newState = std::make_shared<const ManagerState>(
+                std::move(manager), currentState->implFactory(), sessionMode_);
+            const bool isSameGeneration = newState->generation() == currentState->generation();
+            managerState_.publish(writerLock, std::move(newState));
+            circuitBreaker_.reset();
+
+            if (isSameGeneration)
+            {
+                if (logger_->isSeverityLogged(Severity::kDebug))
+                {
+                    logger_->debug(
+                        "OpenAssetIOAsset::runAssetPluginCommand: manager settings unchanged, "
+                        "retaining cached results");
+                }
+            }
+            else
+            {
+                // Entries of the previous generation are unreachable,
+                // so free them now rather than waiting for expiry.
+                negativeCache_.clear();
+                clearPathCache();
+            }
         }
         catch (const std::exception& exc)
         {
@@ -343,76 +1052,504 @@ bool OpenAssetIOAsset::runAssetPluginCommand(const std::string& assetId,
 
     if (command == "setManagerAndContextInPythonDict")
     {
-        // Convert a CPython `id` number, stored in a string, to a PyObject
-        // pointer.
-        const auto pyIdStrToObj = [](const std::string& pyIdAsStr)
-        {
-            std::intptr_t pyId = 0;
-            std::stringstream sstr{pyIdAsStr};
-            sstr >> pyId;
-            // NOLINTNEXTLINE(*-pro-type-reinterpret-cast, *-no-int-to-ptr)
-            return reinterpret_cast<PyObject*>(pyId);
-        };
-
-        PyObject* pyOutDict = pyIdStrToObj(commandArgs.at("outDictId"));
-        // Check if pyOutObj is a dict
-        if (!PyDict_Check(pyOutDict))
+        PyObject* pyOutDict = outDictArg(commandArgs);
+        if (pyOutDict == nullptr)
         {
-            if (logger_->isSeverityLogged(Severity::kDebug))
-            {
-                logger_->debug(
-                    "OpenAssetIOAsset::runAssetPluginCommand -> ERROR: Invalid object type for "
-                    "output variable - must be dict");
-            }
             return false;
         }
-        PyObject* pySrcObj = openassetio::python::converter::castToPyObject(manager_);
+        // Python-side UI uses the root context, rather than the context
+        // of whichever thread happened to make this call.
+        const ManagerStatePtr state = acquireManager().state;
+        PyObject* pySrcObj = openassetio::python::converter::castToPyObject(state->manager());
         PyDict_SetItemString(pyOutDict, "manager", pySrcObj);
         Py_DECREF(pySrcObj);
-        pySrcObj = openassetio::python::converter::castToPyObject(context_);
+        pySrcObj = openassetio::python::converter::castToPyObject(state->rootContext());
         PyDict_SetItemString(pyOutDict, "context", pySrcObj);
         Py_DECREF(pySrcObj);
+        // Allows the UI to tell whether the manager has since been
+        // replaced, see "isManagerStateCurrent".
+        setPyDictCount(pyOutDict, "stateId", state->id());
         return true;
     }
-    return true;
-}
 
-void OpenAssetIOAsset::resolveAsset(const std::string& assetId, std::string& resolvedAsset)
-{
-    try
+    if (command == "isManagerStateCurrent")
     {
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        // Whether the manager retrieved by
+        // "setManagerAndContextInPythonDict" is still current, i.e.
+        // has not been replaced by "initialize" or reset.
+        const auto stateIdIt = commandArgs.find("stateId");
+        const ManagerStatePtr state = managerState_.current();
+        return stateIdIt != commandArgs.end() && state &&
+               stateIdIt->second == std::to_string(state->id());
+    }
+
+    if (command == "prefetchReferencesInFile")
+    {
+        // Scan a file (e.g. a Katana project being opened) for entity
+        // references, and resolve them in the background, so that
+        // subsequent AssetAPI calls are cache hits.
+        try
         {
-            logger_->debugApi(
-                logging::concatAsStr("OpenAssetIOAsset::resolveAsset(assetId=", assetId, ")"));
+            const std::string& path = commandArgs.at("path");
+            std::vector<std::string> prefixes = referencePrefixes(commandArgs);
+
+            // Only one scan at a time, but scans are quick relative to
+            // the prefetching that follows.
+            const std::lock_guard lock{prefetchScanMutex_};
+            if (prefetchScanThread_.joinable())
+            {
+                prefetchScanThread_.join();
+            }
+            prefetchScanThread_ =
+                std::thread{[this, path, prefixes = std::move(prefixes)]
+                            { prefetchReferencesInFile(path, prefixes); }};
         }
-        if (!manager_->isEntityReferenceString(assetId))
+        catch (const std::exception& exc)
         {
-            resolvedAsset = assetId;
-            return;
-        }
-
-        using openassetio::access::ResolveAccess;
-        using openassetio_mediacreation::traits::content::LocatableContentTrait;
+            if (logger_->isSeverityLogged(Severity::kDebug))
+            {
+                logger_->debug(logging::concatAsStr(
+                    "OpenAssetIOAsset::runAssetPluginCommand -> ERROR: ", exc.what()));
+            }
+            return false;
+        }
+    }
+
+    if (command == "serveResolver")
+    {
+        // Serve resolve queries from other processes on this host,
+        // which share this instance's manager and caches, see
+        // ResolverServer.
+        try
+        {
+            if (resolverClient_)
+            {
+                throw std::runtime_error{"Cannot serve whilst acting as a resolver client"};
+            }
+            const std::string& socketPath = commandArgs.at("socketPath");
+
+            {
+                // Connection threads may be waiting on the GIL in order
+                // to call a Python manager, so we must not hold it
+                // whilst stopping any previous server.
+                const ScopedGilRelease releaseGil;
+                const std::lock_guard lock{resolverServerMutex_};
+                resolverServer_.reset();
+                resolverServer_ = std::make_unique<ResolverServer>(
+                    socketPath,
+                    [this](const resolver_protocol::Request& request)
+                    { return handleResolverRequest(request); },
+                    utilities::sizeFromEnvVar(kResolverMaxConnectionsEnvVar,
+                                              kDefaultResolverMaxConnections));
+            }
+
+            if (logger_->isSeverityLogged(Severity::kInfo))
+            {
+                logger_->info(
+                    logging::concatAsStr("OpenAssetIOAsset: serving resolver at ", socketPath));
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            if (logger_->isSeverityLogged(Severity::kDebug))
+            {
+                logger_->debug(logging::concatAsStr(
+                    "OpenAssetIOAsset::runAssetPluginCommand -> ERROR: ", exc.what()));
+            }
+            return false;
+        }
+    }
+
+    if (command == "resolvePathRange")
+    {
+        // Resolve the paths for a range or list of frames of a file
+        // sequence, e.g. "1001-1100" or "1,5,10-20x2", with a single
+        // resolution of the asset ID.
+        try
+        {
+            PyObject* pyOutList = pyIdStrToObj(commandArgs.at("outListId"));
+            if (!PyList_Check(pyOutList))
+            {
+                throw std::runtime_error{"Invalid object type for output variable - must be list"};
+            }
+
+            const std::vector<std::string> paths = resolvePathRange(
+                assetId, parseFrameList(commandArgs.at("frames"), constants::kMaxRangeFrames));
+
+            for (const std::string& path : paths)
+            {
+                PyObject* pyPath =
+                    PyUnicode_FromStringAndSize(path.data(), static_cast<Py_ssize_t>(path.size()));
+                if (pyPath == nullptr || PyList_Append(pyOutList, pyPath) != 0)
+                {
+                    Py_XDECREF(pyPath);
+                    PyErr_Clear();
+                    throw std::runtime_error{"Failed to append path to output list"};
+                }
+                Py_DECREF(pyPath);
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            if (logger_->isSeverityLogged(Severity::kDebug))
+            {
+                logger_->debug(logging::concatAsStr(
+                    "OpenAssetIOAsset::runAssetPluginCommand -> ERROR: ", exc.what()));
+            }
+            return false;
+        }
+    }
+
+    if (command == "exportResolutionIndex")
+    {
+        // Write an index of the entity references found in a file, and
+        // any given explicitly, for the index manager plugin to serve
+        // to processes that should not query the manager, e.g. renders
+        // of the file on a farm.
+        try
+        {
+            const std::string& path = commandArgs.at("path");
+
+            std::vector<std::string> refs;
+            if (const auto sourcePathIt = commandArgs.find("sourcePath");
+                sourcePathIt != commandArgs.end())
+            {
+                const MappedFile file{sourcePathIt->second};
+                const std::string_view contents = file.contents();
+                if (contents.substr(0, kGzipMagic.size()) == kGzipMagic)
+                {
+                    throw std::runtime_error{"compressed files are not supported"};
+                }
+                refs = findEntityReferences(contents, referencePrefixes(commandArgs));
+            }
+            if (const auto refsIt = commandArgs.find("references"); refsIt != commandArgs.end())
+            {
+                for (std::string& ref : pystring::split(refsIt->second, ","))
+                {
+                    refs.push_back(std::move(ref));
+                }
+            }
+
+            const ManagerLease lease = acquireManager(Subsystem::kBackground);
+            const IndexExportResult result = exportResolutionIndex(
+                lease.manager(), lease.context, refs, path, constants::kPageSize);
+
+            if (logger_->isSeverityLogged(Severity::kInfo))
+            {
+                logger_->info(logging::concatAsStr("OpenAssetIOAsset: exported ",
+                                                   result.numEntities,
+                                                   " entities to resolution index ",
+                                                   path,
+                                                   ", omitting ",
+                                                   result.numFailed,
+                                                   " unresolvable"));
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            if (logger_->isSeverityLogged(Severity::kDebug))
+            {
+                logger_->debug(logging::concatAsStr(
+                    "OpenAssetIOAsset::runAssetPluginCommand -> ERROR: ", exc.what()));
+            }
+            return false;
+        }
+    }
+
+    if (command == "setChangeReportInPythonDict")
+    {
+        // Report references that resolve differently since the last
+        // reset, see reportChangesOnReset_.
+        PyObject* pyOutDict = outDictArg(commandArgs);
+        if (pyOutDict == nullptr)
+        {
+            return false;
+        }
+
+        PyObject* pyComplete = PyBool_FromLong(changeReport_.isComplete() ? 1 : 0);
+        PyDict_SetItemString(pyOutDict, "complete", pyComplete);
+        Py_DECREF(pyComplete);
+        setPyDictCount(pyOutDict, "checked", changeReport_.numChecked());
+
+        PyObject* pyChangesDict = PyDict_New();
+        for (const ReferenceChange& change : changeReport_.changes())
+        {
+            PyObject* pyChangeDict = PyDict_New();
+            setPyDictString(pyChangeDict, "previousPath", change.previousPath);
+            setPyDictString(pyChangeDict, "path", change.path);
+            setPyDictString(pyChangeDict, "previousVersion", change.previousVersion);
+            setPyDictString(pyChangeDict, "version", change.version);
+            PyDict_SetItemString(pyChangesDict, change.entityReference.c_str(), pyChangeDict);
+            Py_DECREF(pyChangeDict);
+        }
+        PyDict_SetItemString(pyOutDict, "changes", pyChangesDict);
+        Py_DECREF(pyChangesDict);
+        return true;
+    }
+
+    if (command == "setRoundTripReportInPythonDict")
+    {
+        // Report manager round trips by logical operation, along with
+        // calls that could have been batched, see roundTripMonitor_.
+        PyObject* pyOutDict = outDictArg(commandArgs);
+        if (pyOutDict == nullptr)
+        {
+            return false;
+        }
+
+        // Include operations that have since finished.
+        warnBatchable(roundTripMonitor_.completeIdle());
+
+        PyObject* pyOperationsDict = PyDict_New();
+        for (const OperationRoundTrips& roundTrips : roundTripMonitor_.operationRoundTrips())
+        {
+            PyObject* pyRoundTripsDict = PyDict_New();
+            setPyDictCount(pyRoundTripsDict, "operations", roundTrips.operations);
+            setPyDictCount(pyRoundTripsDict, "roundTrips", roundTrips.roundTrips);
+            setPyDictCount(pyRoundTripsDict, "maxRoundTrips", roundTrips.maxRoundTrips);
+            setPyDictCount(pyRoundTripsDict, "overBudget", roundTrips.overBudget);
+            PyDict_SetItemString(pyOperationsDict, roundTrips.method.c_str(), pyRoundTripsDict);
+            Py_DECREF(pyRoundTripsDict);
+        }
+        PyDict_SetItemString(pyOutDict, "operations", pyOperationsDict);
+        Py_DECREF(pyOperationsDict);
+
+        PyObject* pyBatchableList = PyList_New(0);
+        for (const BatchableCalls& batchable : roundTripMonitor_.batchableCalls())
+        {
+            PyObject* pyBatchableDict = PyDict_New();
+            setPyDictString(pyBatchableDict, "method", batchable.method);
+            setPyDictString(pyBatchableDict, "managerCall", batchable.managerCall);
+            PyObject* pyTraitsList = PyList_New(0);
+            for (const std::string& traitId : batchable.traitIds)
+            {
+                PyObject* pyTraitId = PyUnicode_FromStringAndSize(
+                    traitId.data(), static_cast<Py_ssize_t>(traitId.size()));
+                PyList_Append(pyTraitsList, pyTraitId);
+                Py_DECREF(pyTraitId);
+            }
+            PyDict_SetItemString(pyBatchableDict, "traits", pyTraitsList);
+            Py_DECREF(pyTraitsList);
+            setPyDictCount(pyBatchableDict, "operations", batchable.operations);
+            setPyDictCount(pyBatchableDict, "calls", batchable.calls);
+            setPyDictCount(pyBatchableDict, "maxCalls", batchable.maxCalls);
+            PyList_Append(pyBatchableList, pyBatchableDict);
+            Py_DECREF(pyBatchableDict);
+        }
+        PyDict_SetItemString(pyOutDict, "batchable", pyBatchableList);
+        Py_DECREF(pyBatchableList);
+        return true;
+    }
+
+    if (command == "setStatsInPythonDict")
+    {
+        PyObject* pyOutDict = outDictArg(commandArgs);
+        if (pyOutDict == nullptr)
+        {
+            return false;
+        }
+
+        PyObject* pyPathCacheDict = PyDict_New();
+        setPyDictCount(pyPathCacheDict, "hits", pathCacheStats_.hits);
+        setPyDictCount(pyPathCacheDict, "staleHits", pathCacheStats_.staleHits);
+        setPyDictCount(pyPathCacheDict, "misses", pathCacheStats_.misses);
+        setPyDictCount(pyPathCacheDict, "immutableInserts", pathCacheStats_.immutableInserts);
+        setPyDictCount(pyPathCacheDict, "mutableInserts", pathCacheStats_.mutableInserts);
+        setPyDictCount(pyPathCacheDict, "refreshBatches", pathCacheStats_.refreshBatches);
+        setPyDictCount(pyPathCacheDict, "refreshes", pathCacheStats_.refreshes);
+        setPyDictCount(pyPathCacheDict, "refreshFailures", pathCacheStats_.refreshFailures);
+        setPyDictCount(pyPathCacheDict, "retainedOnReset", pathCacheStats_.retainedOnReset);
+        setPyDictCount(pyPathCacheDict, "revalidations", pathCacheStats_.revalidations);
+        setPyDictCount(
+            pyPathCacheDict, "revalidationMismatches", pathCacheStats_.revalidationMismatches);
+        PyDict_SetItemString(pyOutDict, "pathCache", pyPathCacheDict);
+        Py_DECREF(pyPathCacheDict);
+
+        PyObject* pyNegativeCacheDict = PyDict_New();
+        setPyDictCount(pyNegativeCacheDict, "hits", negativeCacheStats_.hits);
+        setPyDictCount(pyNegativeCacheDict, "misses", negativeCacheStats_.misses);
+        PyDict_SetItemString(pyOutDict, "negativeCache", pyNegativeCacheDict);
+        Py_DECREF(pyNegativeCacheDict);
+
+        PyObject* pyPrefetchDict = PyDict_New();
+        setPyDictCount(pyPrefetchDict, "scans", prefetchStats_.scans);
+        setPyDictCount(pyPrefetchDict, "referencesFound", prefetchStats_.referencesFound);
+        setPyDictCount(pyPrefetchDict, "requested", prefetchStats_.requested);
+        setPyDictCount(pyPrefetchDict, "batches", prefetchStats_.batches);
+        setPyDictCount(pyPrefetchDict, "resolved", prefetchStats_.resolved);
+        setPyDictCount(pyPrefetchDict, "failures", prefetchStats_.failures);
+        PyDict_SetItemString(pyOutDict, "prefetch", pyPrefetchDict);
+        Py_DECREF(pyPrefetchDict);
+
+        PyObject* pySpeculationDict = PyDict_New();
+        setPyDictCount(
+            pySpeculationDict, "successorsObserved", speculationStats_.successorsObserved);
+        setPyDictCount(pySpeculationDict, "speculations", speculationStats_.speculations);
+        setPyDictCount(pySpeculationDict, "hits", speculationStats_.hits);
+        PyDict_SetItemString(pyOutDict, "speculation", pySpeculationDict);
+        Py_DECREF(pySpeculationDict);
+
+        PyObject* pyPagingDict = PyDict_New();
+        setPyDictCount(pyPagingDict, "pageSize", relationshipPageSize_.size());
+        setPyDictCount(pyPagingDict, "queries", relationshipPagingStats_.queries);
+        setPyDictCount(pyPagingDict, "pages", relationshipPagingStats_.pages);
+        setPyDictCount(
+            pyPagingDict, "pageSizeIncreases", relationshipPagingStats_.pageSizeIncreases);
+        setPyDictCount(
+            pyPagingDict, "pageSizeDecreases", relationshipPagingStats_.pageSizeDecreases);
+        PyDict_SetItemString(pyOutDict, "relationshipPaging", pyPagingDict);
+        Py_DECREF(pyPagingDict);
+
+        PyObject* pyCacheMemoryDict = PyDict_New();
+        setPyDictCount(pyCacheMemoryDict, "budget", cacheMemoryBudget_.limit());
+        setPyDictCount(pyCacheMemoryDict, "usage", cacheMemoryBudget_.usage());
+        setPyDictCount(pyCacheMemoryDict, "evictions", cacheMemoryBudget_.evictions());
+        setPyDictCacheOccupancy(pyCacheMemoryDict, "negativeCache", negativeCache_);
+        setPyDictCacheOccupancy(pyCacheMemoryDict, "pathCache", pathCache_);
+        PyObject* pyPathDirectoriesDict = PyDict_New();
+        setPyDictCount(pyPathDirectoriesDict, "entries", pathInterner_.size());
+        setPyDictCount(pyPathDirectoriesDict, "bytes", pathInterner_.memoryUsage());
+        PyDict_SetItemString(pyCacheMemoryDict, "pathDirectories", pyPathDirectoriesDict);
+        Py_DECREF(pyPathDirectoriesDict);
+        setPyDictCacheOccupancy(pyCacheMemoryDict, "recentCalls", recentCalls_);
+        PyObject* pyUrlMemoDict = PyDict_New();
+        setPyDictCount(pyUrlMemoDict, "entries", urlPathConverter_.memoSize());
+        setPyDictCount(pyUrlMemoDict, "bytes", urlPathConverter_.memoMemoryUsage());
+        setPyDictCount(pyUrlMemoDict, "evictions", urlPathConverter_.memoEvictions());
+        PyDict_SetItemString(pyCacheMemoryDict, "urlMemo", pyUrlMemoDict);
+        Py_DECREF(pyUrlMemoDict);
+        PyObject* pyAssetIdMemoDict = PyDict_New();
+        setPyDictCount(pyAssetIdMemoDict, "entries", assetIdFilter_.memoSize());
+        setPyDictCount(pyAssetIdMemoDict, "bytes", assetIdFilter_.memoMemoryUsage());
+        setPyDictCount(pyAssetIdMemoDict, "evictions", assetIdFilter_.memoEvictions());
+        PyDict_SetItemString(pyCacheMemoryDict, "assetIdMemo", pyAssetIdMemoDict);
+        Py_DECREF(pyAssetIdMemoDict);
+        PyObject* pyReadOnlyTraitsDict = PyDict_New();
+        setPyDictCount(pyReadOnlyTraitsDict, "entries", readOnlyTraitsCache_.size());
+        setPyDictCount(pyReadOnlyTraitsDict, "bytes", readOnlyTraitsCache_.memoryUsage());
+        setPyDictCount(pyReadOnlyTraitsDict, "evictions", readOnlyTraitsCache_.evictions());
+        PyDict_SetItemString(pyCacheMemoryDict, "readOnlyTraits", pyReadOnlyTraitsDict);
+        Py_DECREF(pyReadOnlyTraitsDict);
+        PyObject* pyReadOnlyQueriesDict = PyDict_New();
+        setPyDictCount(pyReadOnlyQueriesDict, "entries", readOnlyQueryCache_.size());
+        setPyDictCount(pyReadOnlyQueriesDict, "bytes", readOnlyQueryCache_.memoryUsage());
+        setPyDictCount(pyReadOnlyQueriesDict, "evictions", readOnlyQueryCache_.evictions());
+        PyDict_SetItemString(pyCacheMemoryDict, "readOnlyQueries", pyReadOnlyQueriesDict);
+        Py_DECREF(pyReadOnlyQueriesDict);
+        PyDict_SetItemString(pyOutDict, "cacheMemory", pyCacheMemoryDict);
+        Py_DECREF(pyCacheMemoryDict);
+
+        PyObject* pyUrlConversionsDict = PyDict_New();
+        const UrlConversionStats& urlConversionStats = urlPathConverter_.stats();
+        setPyDictCount(pyUrlConversionsDict, "fastPaths", urlConversionStats.fastPaths);
+        setPyDictCount(pyUrlConversionsDict, "memoHits", urlConversionStats.memoHits);
+        setPyDictCount(pyUrlConversionsDict, "fullConversions", urlConversionStats.fullConversions);
+        PyDict_SetItemString(pyOutDict, "urlConversions", pyUrlConversionsDict);
+        Py_DECREF(pyUrlConversionsDict);
+
+        PyObject* pyDirectoryScansDict = PyDict_New();
+        const DirectoryScanStats& directoryScanStats = directoryScanCache_.stats();
+        setPyDictCount(pyDirectoryScansDict, "cached", directoryScanCache_.size());
+        setPyDictCount(pyDirectoryScansDict, "watched", directoryScanCache_.numWatched());
+        setPyDictCount(pyDirectoryScansDict, "scans", directoryScanStats.scans);
+        setPyDictCount(pyDirectoryScansDict, "hits", directoryScanStats.hits);
+        setPyDictCount(pyDirectoryScansDict, "events", directoryScanStats.events);
+        setPyDictCount(pyDirectoryScansDict, "evictions", directoryScanStats.evictions);
+        PyDict_SetItemString(pyOutDict, "directoryScans", pyDirectoryScansDict);
+        Py_DECREF(pyDirectoryScansDict);
+
+        PyObject* pyAssetIdChecksDict = PyDict_New();
+        const AssetIdCheckStats& assetIdCheckStats = assetIdFilter_.stats();
+        setPyDictCount(pyAssetIdChecksDict, "prefixChecks", assetIdCheckStats.prefixChecks);
+        setPyDictCount(pyAssetIdChecksDict, "memoHits", assetIdCheckStats.memoHits);
+        setPyDictCount(pyAssetIdChecksDict, "firstSightings", assetIdCheckStats.firstSightings);
+        setPyDictCount(pyAssetIdChecksDict, "managerChecks", assetIdCheckStats.managerChecks);
+        setPyDictCount(pyAssetIdChecksDict, "filterBytes", assetIdFilter_.filterMemoryUsage());
+        PyDict_SetItemString(pyOutDict, "assetIdChecks", pyAssetIdChecksDict);
+        Py_DECREF(pyAssetIdChecksDict);
+
+        PyObject* pyReadOnlyDict = PyDict_New();
+        PyObject* pyIsReadOnly = PyBool_FromLong(isReadOnly_ ? 1 : 0);
+        PyDict_SetItemString(pyReadOnlyDict, "enabled", pyIsReadOnly);
+        Py_DECREF(pyIsReadOnly);
+        setPyDictCount(pyReadOnlyDict, "traitsHits", readOnlyStats_.traitsHits);
+        setPyDictCount(pyReadOnlyDict, "traitsMisses", readOnlyStats_.traitsMisses);
+        setPyDictCount(pyReadOnlyDict, "queryHits", readOnlyStats_.queryHits);
+        setPyDictCount(pyReadOnlyDict, "queryMisses", readOnlyStats_.queryMisses);
+        setPyDictCount(pyReadOnlyDict, "rejectedWrites", readOnlyStats_.rejectedWrites);
+        PyDict_SetItemString(pyOutDict, "readOnly", pyReadOnlyDict);
+        Py_DECREF(pyReadOnlyDict);
+
+        PyObject* pyManagerCallsDict = PyDict_New();
+        setPyDictCount(pyManagerCallsDict, "timeouts", callStats_.timeouts);
+        setPyDictCount(pyManagerCallsDict, "rejections", callStats_.rejections);
+        setPyDictCount(pyManagerCallsDict, "probes", callStats_.probes);
+        setPyDictCount(pyManagerCallsDict, "roundTrips", roundTripMonitor_.numRoundTrips());
+        setPyDictCount(
+            pyManagerCallsDict, "lastKnownGoodFallbacks", callStats_.lastKnownGoodFallbacks);
+        PyDict_SetItemString(pyOutDict, "managerCalls", pyManagerCallsDict);
+        Py_DECREF(pyManagerCallsDict);
+
+        setPyDictDurations(pyOutDict, "publishPhases", publishPhaseDurations_);
+        return true;
+    }
+    return true;
+}
+
+void OpenAssetIOAsset::resolveAsset(const std::string& assetId, std::string& resolvedAsset)
+{
+    const ScopedTimer callTimer{apiCallDurations_.get({"resolveAsset"})};
+    std::optional<openassetio::errors::BatchElementError> error;
+    try
+    {
+        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        {
+            logger_->debugApi(
+                logging::concatAsStr("OpenAssetIOAsset::resolveAsset(assetId=", assetId, ")"));
+        }
+        if (resolverClient_)
+        {
+            try
+            {
+                resolvedAsset = resolvePathViaResolver(assetId);
+                if (logger_->isSeverityLogged(Severity::kDebugApi))
+                {
+                    logger_->debugApi(
+                        logging::concatAsStr("OpenAssetIOAsset::resolveAsset -> ", resolvedAsset));
+                }
+                return;
+            }
+            catch (const std::system_error& exc)
+            {
+                warnResolverUnavailable(exc);
+            }
+        }
+
+        const ManagerLease lease = acquireManager();
+
+        if (!isEntityReferenceString(lease, "resolveAsset", assetId))
+        {
+            resolvedAsset = assetId;
+            return;
+        }
 
         auto [entityReference, managerDrivenValue] =
-            assetIdToEntityRefAndManagerDrivenValue(assetId);
+            assetIdToEntityRefAndManagerDrivenValue(lease, assetId);
 
         if (managerDrivenValue.empty())
         {
             // We assume that Katana wants a path when it calls
             // `resolveAsset`, which is always the case except for
             // esoteric configurations.
-
-            const auto traitData = manager_->resolve(
-                entityReference, {LocatableContentTrait::kId}, ResolveAccess::kRead, context_);
-            const auto url = LocatableContentTrait(traitData).getLocation();
-
-            if (!url)
+            auto maybePath = resolvePathForRead(lease, "resolveAsset", entityReference);
+            if (auto* pathError = std::get_if<openassetio::errors::BatchElementError>(&maybePath))
             {
-                throw std::runtime_error{assetId + " has no location"};
+                error = std::move(*pathError);
+            }
+            else
+            {
+                resolvedAsset = std::move(std::get<std::string>(maybePath));
             }
-            resolvedAsset = fileUrlPathConverter_->pathFromUrl(*url);
         }
         else
         {
@@ -422,7 +1559,7 @@ void OpenAssetIOAsset::resolveAsset(const std::string& assetId, std::string& res
             resolvedAsset = std::move(managerDrivenValue);
         }
 
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        if (!error && logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(
                 logging::concatAsStr("OpenAssetIOAsset::resolveAsset -> ", resolvedAsset));
@@ -437,10 +1574,16 @@ void OpenAssetIOAsset::resolveAsset(const std::string& assetId, std::string& res
         }
         throw;
     }
+
+    if (error)
+    {
+        throwBatchElementError("resolveAsset", *error);
+    }
 }
 
 void OpenAssetIOAsset::resolveAllAssets(const std::string& str, std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"resolveAllAssets"})};
     if (logger_->isSeverityLogged(Severity::kDebugApi))
     {
         logger_->debugApi(
@@ -452,6 +1595,7 @@ void OpenAssetIOAsset::resolveAllAssets(const std::string& str, std::string& ret
 
 void OpenAssetIOAsset::resolvePath(const std::string& str, const int frame, std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"resolvePath"})};
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -486,6 +1630,8 @@ void OpenAssetIOAsset::resolveAssetVersion(const std::string& assetId,
                                            std::string& ret,
                                            const std::string& versionStr)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"resolveAssetVersion"})};
+    std::optional<openassetio::errors::BatchElementError> error;
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -497,16 +1643,47 @@ void OpenAssetIOAsset::resolveAssetVersion(const std::string& assetId,
                                                    ")"));
         }
         using openassetio::EntityReference;
-        using openassetio::access::ResolveAccess;
         using openassetio_mediacreation::traits::lifecycle::VersionTrait;
 
-        const EntityReference entityReference = [&]
+        if (resolverClient_)
+        {
+            try
+            {
+                ret = callResolver("resolveAssetVersion",
+                                   resolver_protocol::Operation::kResolveVersion,
+                                   {assetId, versionStr})
+                          .at(0);
+                if (logger_->isSeverityLogged(Severity::kDebugApi))
+                {
+                    logger_->debugApi(
+                        logging::concatAsStr("OpenAssetIOAsset::resolveAssetVersion -> ", ret));
+                }
+                return;
+            }
+            catch (const std::system_error& exc)
+            {
+                warnResolverUnavailable(exc);
+            }
+        }
+
+        using openassetio::errors::BatchElementError;
+        using openassetio::trait::TraitsDataPtr;
+
+        const ManagerLease lease = acquireManager();
+        const auto& manager = lease.manager();
+
+        const auto maybeEntityReference = [&]() -> std::variant<BatchElementError, EntityReference>
         {
             if (versionStr.empty())
             {
                 // No alternate version, so we want to query the version
                 // tag associated with the given entity.
-                return manager_->createEntityReference(assetId);
+                if (auto entityReference = manager->createEntityReferenceIfValid(assetId))
+                {
+                    return std::move(*entityReference);
+                }
+                return BatchElementError{BatchElementError::ErrorCode::kMalformedEntityReference,
+                                         "Invalid entity reference: " + assetId};
             }
 
             // Alternate version given, so we need to query the version tag
@@ -515,28 +1692,52 @@ void OpenAssetIOAsset::resolveAssetVersion(const std::string& assetId,
             // "latest" has an entity reference of "myasset://pony?v=latest"
             // which we will `resolve` below to "v2" (assuming v2 is the
             // latest version).
-            const auto maybeEntityReference = entityRefForAssetIdAndVersion(assetId, versionStr);
-
-            if (!maybeEntityReference)
+            auto maybeVersionedRef = entityRefForAssetIdAndVersion(
+                lease, "resolveAssetVersion", assetId, versionStr);
+            if (auto* versionError = std::get_if<BatchElementError>(&maybeVersionedRef))
+            {
+                return std::move(*versionError);
+            }
+            auto& versionedRef = std::get<std::optional<EntityReference>>(maybeVersionedRef);
+            if (!versionedRef)
             {
-                throw std::runtime_error{"No version found for asset " + assetId + " and version " +
-                                         versionStr};
+                return BatchElementError{
+                    BatchElementError::ErrorCode::kEntityResolutionError,
+                    "No version found for asset " + assetId + " and version " + versionStr};
             }
-            return *maybeEntityReference;
+            return std::move(*versionedRef);
         }();
 
-        // We don't have any other information about the asset other than its EntityReference so
-        // request the VersionTrait.
-        const auto traitData =
-            manager_->resolve(entityReference, {VersionTrait::kId}, ResolveAccess::kRead, context_);
-
-        // Usage by the Importomatic node implies "stableTag" is what we
-        // want here - its parameters panel has a column for "Version" and a
-        // column for "Resolved Version" where "Resolved Version" comes from
-        // this function (and "Version" comes from getAssetFields).
-        ret = VersionTrait{traitData}.getStableTag("");
+        if (const auto* refError = std::get_if<BatchElementError>(&maybeEntityReference))
+        {
+            error = *refError;
+        }
+        else
+        {
+            // We don't have any other information about the asset other
+            // than its EntityReference so request the VersionTrait.
+            const auto maybeTraitsData =
+                resolveForReadOrError(lease,
+                                      "resolveAssetVersion",
+                                      std::get<EntityReference>(maybeEntityReference),
+                                      {VersionTrait::kId});
+
+            if (const auto* resolveError = std::get_if<BatchElementError>(&maybeTraitsData))
+            {
+                error = *resolveError;
+            }
+            else
+            {
+                // Usage by the Importomatic node implies "stableTag" is
+                // what we want here - its parameters panel has a column
+                // for "Version" and a column for "Resolved Version" where
+                // "Resolved Version" comes from this function (and
+                // "Version" comes from getAssetFields).
+                ret = VersionTrait{std::get<TraitsDataPtr>(maybeTraitsData)}.getStableTag("");
+            }
+        }
 
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        if (!error && logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(
                 logging::concatAsStr("OpenAssetIOAsset::resolveAssetVersion -> ", ret));
@@ -551,10 +1752,17 @@ void OpenAssetIOAsset::resolveAssetVersion(const std::string& assetId,
         }
         throw;
     }
+
+    if (error)
+    {
+        throwBatchElementError("resolveAssetVersion", *error);
+    }
 }
 
 void OpenAssetIOAsset::getAssetDisplayName(const std::string& assetId, std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getAssetDisplayName"})};
+    std::optional<openassetio::errors::BatchElementError> error;
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -562,17 +1770,28 @@ void OpenAssetIOAsset::getAssetDisplayName(const std::string& assetId, std::stri
             logger_->debugApi(logging::concatAsStr(
                 "OpenAssetIOAsset::getAssetDisplayName(assetId=", assetId, ")"));
         }
+        const ManagerLease lease = acquireManager();
+        const auto& manager = lease.manager();
+
         // Katana often does not check if assetId is a reference or a
         // file path before calling this function.
-        if (const auto entityReference = manager_->createEntityReferenceIfValid(assetId))
+        if (const auto entityReference = manager->createEntityReferenceIfValid(assetId))
         {
-            using openassetio::access::ResolveAccess;
+            using openassetio::errors::BatchElementError;
+            using openassetio::trait::TraitsDataPtr;
             using openassetio_mediacreation::traits::identity::DisplayNameTrait;
 
-            const auto traitData = manager_->resolve(
-                *entityReference, {DisplayNameTrait::kId}, ResolveAccess::kRead, context_);
+            auto maybeTraitsData = resolveForReadOrError(
+                lease, "getAssetDisplayName", *entityReference, {DisplayNameTrait::kId});
 
-            ret = DisplayNameTrait{traitData}.getName("");
+            if (auto* resolveError = std::get_if<BatchElementError>(&maybeTraitsData))
+            {
+                error = std::move(*resolveError);
+            }
+            else
+            {
+                ret = DisplayNameTrait{std::get<TraitsDataPtr>(maybeTraitsData)}.getName("");
+            }
         }
 
         if (ret.empty())
@@ -580,7 +1799,7 @@ void OpenAssetIOAsset::getAssetDisplayName(const std::string& assetId, std::stri
             ret = assetId;
         }
 
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        if (!error && logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(
                 logging::concatAsStr("OpenAssetIOAsset::getAssetDisplayName -> ", ret));
@@ -595,10 +1814,16 @@ void OpenAssetIOAsset::getAssetDisplayName(const std::string& assetId, std::stri
         }
         throw;
     }
+
+    if (error)
+    {
+        throwBatchElementError("getAssetDisplayName", *error);
+    }
 }
 
 void OpenAssetIOAsset::getAssetVersions(const std::string& assetId, StringVector& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getAssetVersions"})};
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -612,30 +1837,111 @@ void OpenAssetIOAsset::getAssetVersions(const std::string& assetId, StringVector
             EntityVersionsRelationshipSpecification;
         using openassetio_mediacreation::traits::lifecycle::VersionTrait;
 
+        const ManagerLease lease = acquireManager();
+        const auto& manager = lease.manager();
+
+        if (isReadOnly_)
+        {
+            auto cachedTags = readOnlyQueryCache_.visit(
+                assetId,
+                lease.state->generation(),
+                [](const CachedQueries& cached) { return cached.versionTags; });
+            if (cachedTags && *cachedTags)
+            {
+                readOnlyStats_.queryHits.increment();
+                ret = std::move(**cachedTags);
+                if (logger_->isSeverityLogged(Severity::kDebugApi))
+                {
+                    logger_->debugApi(
+                        logging::concatAsStr("OpenAssetIOAsset::getAssetVersions -> ", ret));
+                }
+                return;
+            }
+            readOnlyStats_.queryMisses.increment();
+        }
+
+        // Tune the page size from the time taken to retrieve each page,
+        // where retrieving the first page includes creating the pager.
+        const std::size_t pageSize = relationshipPageSize_.size();
+        auto pageStart = std::chrono::steady_clock::now();
+        const auto recordPage = [&](const std::size_t numResults)
+        {
+            const auto pageEnd = std::chrono::steady_clock::now();
+            relationshipPagingStats_.pages.increment();
+            switch (relationshipPageSize_.recordPage(pageSize, numResults, pageEnd - pageStart))
+            {
+            case AdaptivePageSize::Adjustment::kGrown:
+                relationshipPagingStats_.pageSizeIncreases.increment();
+                break;
+            case AdaptivePageSize::Adjustment::kShrunk:
+                relationshipPagingStats_.pageSizeDecreases.increment();
+                break;
+            case AdaptivePageSize::Adjustment::kNone:
+                break;
+            }
+            pageStart = pageEnd;
+        };
+        relationshipPagingStats_.queries.increment();
+
         // Get all related references, such that each reference points to a
-        // different version of the same asset.
-        const auto entityRefPager = manager_->getWithRelationship(
-            manager_->createEntityReference(assetId),
-            EntityVersionsRelationshipSpecification::create().traitsData(),
-            constants::kPageSize,
-            RelationsAccess::kRead,
-            context_,
-            {});
+        // different version of the same asset, along with the first page.
+        auto [entityRefPager, firstPage] = callManager(
+            lease,
+            "getAssetVersions",
+            "getWithRelationship",
+            1,
+            EntityVersionsRelationshipSpecification::kTraitSet,
+            [manager, entityReference = manager->createEntityReference(assetId), pageSize](
+                const openassetio::ContextPtr& context)
+            {
+                auto pager = manager->getWithRelationship(
+                    entityReference,
+                    EntityVersionsRelationshipSpecification::create().traitsData(),
+                    pageSize,
+                    RelationsAccess::kRead,
+                    context,
+                    {});
+                auto page = pager->get();
+                return std::pair{std::move(pager), std::move(page)};
+            });
 
         openassetio::EntityReferences entityRefs;
 
         // Collect all pages of related references into a single list.
-        openassetio::EntityReferences entityRefPage;
-        while (!(entityRefPage = entityRefPager->get()).empty())
+        // Each subsequent page is retrieved within the deadline, along
+        // with the request for it.
+        for (openassetio::EntityReferences entityRefPage = std::move(firstPage);
+             !entityRefPage.empty();)
         {
+            recordPage(entityRefPage.size());
             copy(cbegin(entityRefPage), cend(entityRefPage), back_inserter(entityRefs));
-            entityRefPager->next();
+            // The pager retains the context it was created with.
+            entityRefPage = callManager(lease,
+                                        "getAssetVersions",
+                                        "EntityReferencePager.next",
+                                        1,
+                                        {},
+                                        [pager = entityRefPager](const openassetio::ContextPtr&)
+                                        {
+                                            pager->next();
+                                            return pager->get();
+                                        });
         }
+        recordPage(0);
 
         // Batch `resolve` to get version metadata associated with each
         // entity reference.
-        const auto traitsDatas =
-            manager_->resolve(entityRefs, {VersionTrait::kId}, ResolveAccess::kRead, context_);
+        const auto traitsDatas = callManager(
+            lease,
+            "getAssetVersions",
+            "resolve",
+            entityRefs.size(),
+            {VersionTrait::kId},
+            [manager, entityRefs](const openassetio::ContextPtr& context)
+            {
+                return manager->resolve(
+                    entityRefs, {VersionTrait::kId}, ResolveAccess::kRead, context);
+            });
 
         // Extract and return the version "specified tag", i.e. version tag
         // potentially including meta-versions such as "latest".
@@ -645,6 +1951,12 @@ void OpenAssetIOAsset::getAssetVersions(const std::string& assetId, StringVector
                   [](const auto& traitsData)
                   { return VersionTrait{traitsData}.getSpecifiedTag(""); });
 
+        if (isReadOnly_)
+        {
+            rememberReadOnlyQuery(
+                lease, assetId, [&](CachedQueries& cached) { cached.versionTags = ret; });
+        }
+
         if (logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(logging::concatAsStr("OpenAssetIOAsset::getAssetVersions -> ", ret));
@@ -665,6 +1977,8 @@ void OpenAssetIOAsset::getUniqueScenegraphLocationFromAssetId(const std::string&
                                                               const bool includeVersion,
                                                               std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getUniqueScenegraphLocationFromAssetId"})};
+    std::optional<openassetio::errors::BatchElementError> error;
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -676,7 +1990,6 @@ void OpenAssetIOAsset::getUniqueScenegraphLocationFromAssetId(const std::string&
                 includeVersion,
                 ")"));
         }
-        using openassetio::access::ResolveAccess;
         using openassetio::trait::TraitSet;
         using openassetio_mediacreation::traits::lifecycle::VersionTrait;
         using openassetio_mediacreation::traits::threeDimensional::SourcePathTrait;
@@ -684,21 +1997,39 @@ void OpenAssetIOAsset::getUniqueScenegraphLocationFromAssetId(const std::string&
         const auto traits = includeVersion ? TraitSet{VersionTrait::kId, SourcePathTrait::kId}
                                            : TraitSet{SourcePathTrait::kId};
 
-        const auto traitsData = manager_->resolve(
-            manager_->createEntityReference(assetId), traits, ResolveAccess::kRead, context_);
+        using openassetio::errors::BatchElementError;
+        using openassetio::trait::TraitsDataPtr;
+
+        const ManagerLease lease = acquireManager();
 
-        ret = SourcePathTrait{traitsData}.getPath("/");
+        const auto entityReference = lease.manager()->createEntityReferenceIfValid(assetId);
+        auto maybeTraitsData =
+            entityReference
+                ? resolveForReadOrError(
+                      lease, "getUniqueScenegraphLocationFromAssetId", *entityReference, traits)
+                : BatchElementError{BatchElementError::ErrorCode::kMalformedEntityReference,
+                                    "Invalid entity reference: " + assetId};
 
-        if (includeVersion)
+        if (auto* resolveError = std::get_if<BatchElementError>(&maybeTraitsData))
+        {
+            error = std::move(*resolveError);
+        }
+        else
         {
-            if (const auto versionTag = VersionTrait{traitsData}.getStableTag())
+            const TraitsDataPtr& traitsData = std::get<TraitsDataPtr>(maybeTraitsData);
+            ret = SourcePathTrait{traitsData}.getPath("/");
+
+            if (includeVersion)
             {
-                ret += "/";
-                ret += *versionTag;
+                if (const auto versionTag = VersionTrait{traitsData}.getStableTag())
+                {
+                    ret += "/";
+                    ret += *versionTag;
+                }
             }
         }
 
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        if (!error && logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(logging::concatAsStr(
                 "OpenAssetIOAsset::getUniqueScenegraphLocationFromAssetId -> ", ret));
@@ -713,6 +2044,11 @@ void OpenAssetIOAsset::getUniqueScenegraphLocationFromAssetId(const std::string&
         }
         throw;
     }
+
+    if (error)
+    {
+        throwBatchElementError("getUniqueScenegraphLocationFromAssetId", *error);
+    }
 }
 
 // NOLINTNEXTLINE(*-easily-swappable-parameters)
@@ -720,6 +2056,7 @@ void OpenAssetIOAsset::getRelatedAssetId(const std::string& assetId,
                                          const std::string& relation,
                                          std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getRelatedAssetId"})};
     if (logger_->isSeverityLogged(Severity::kDebugApi))
     {
         logger_->debugApi(logging::concatAsStr("OpenAssetIOAsset::getRelatedAssetId(assetId=",
@@ -738,6 +2075,7 @@ void OpenAssetIOAsset::getAssetFields(const std::string& assetId,
                                       const bool includeDefaults,
                                       StringMap& returnFields)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getAssetFields"})};
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -748,26 +2086,45 @@ void OpenAssetIOAsset::getAssetFields(const std::string& assetId,
                                                    includeDefaults,
                                                    ")"));
         }
+        if (resolverClient_)
+        {
+            try
+            {
+                const auto values = callResolver("getAssetFields",
+                                                 resolver_protocol::Operation::kGetFields,
+                                                 {assetId, includeDefaults ? "1" : "0"});
+                for (std::size_t idx = 0; idx + 1 < values.size(); idx += 2)
+                {
+                    returnFields[values[idx]] = values[idx + 1];
+                }
+                if (logger_->isSeverityLogged(Severity::kDebugApi))
+                {
+                    logger_->debugApi(logging::concatAsStr("OpenAssetIOAsset::getAssetFields -> ",
+                                                           returnFields));
+                }
+                return;
+            }
+            catch (const std::system_error& exc)
+            {
+                warnResolverUnavailable(exc);
+            }
+        }
+
         (void)includeDefaults;  // TODO(DF): How should we use this?
 
-        using openassetio::access::ResolveAccess;
         using openassetio::trait::TraitsDataPtr;
         using openassetio::trait::TraitSet;
         using openassetio_mediacreation::traits::identity::DisplayNameTrait;
         using openassetio_mediacreation::traits::lifecycle::VersionTrait;
-        using BatchElementErrorPolicyTag =
-            openassetio::hostApi::Manager::BatchElementErrorPolicyTag;
+        const ManagerLease lease = acquireManager();
 
         auto [entityReference, managerDrivenValue] =
-            assetIdToEntityRefAndManagerDrivenValue(assetId);
+            assetIdToEntityRefAndManagerDrivenValue(lease, assetId);
 
         // Use a kVariant return type, so we can ignore errors - e.g.
         // the entity might not exist (yet).
-        const auto maybeTraitsData = manager_->resolve(entityReference,
-                                                       {DisplayNameTrait::kId, VersionTrait::kId},
-                                                       ResolveAccess::kRead,
-                                                       context_,
-                                                       BatchElementErrorPolicyTag::kVariant);
+        const auto maybeTraitsData = resolveForReadOrError(
+            lease, "getAssetFields", entityReference, {DisplayNameTrait::kId, VersionTrait::kId});
 
         if (TraitsDataPtr const* traitsData = std::get_if<TraitsDataPtr>(&maybeTraitsData))
         {
@@ -806,6 +2163,8 @@ void OpenAssetIOAsset::getAssetFields(const std::string& assetId,
 
 void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"buildAssetId"})};
+    std::optional<openassetio::errors::BatchElementError> error;
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -815,12 +2174,9 @@ void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
         }
 
         using openassetio::EntityReference;
-        using openassetio::EntityReferences;
-        using openassetio::access::RelationsAccess;
-        using openassetio::access::ResolveAccess;
-        using openassetio_mediacreation::specifications::lifecycle::
-            EntityVersionsRelationshipSpecification;
-        using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+        using openassetio::errors::BatchElementError;
+
+        const ManagerLease lease = acquireManager();
 
         const std::string assetId = [&]
         {
@@ -854,9 +2210,15 @@ void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
             }
             const std::string& desiredVersionTag = versionIt->second;
 
-            const std::optional<EntityReference> versionedRef =
-                entityRefForAssetIdAndVersion(assetId, desiredVersionTag);
+            auto maybeVersionedRef =
+                entityRefForAssetIdAndVersion(lease, "buildAssetId", assetId, desiredVersionTag);
 
+            if (auto* versionError = std::get_if<BatchElementError>(&maybeVersionedRef))
+            {
+                error = std::move(*versionError);
+                return std::nullopt;
+            }
+            const auto& versionedRef = std::get<std::optional<EntityReference>>(maybeVersionedRef);
             if (!versionedRef)
             {
                 return std::nullopt;
@@ -866,7 +2228,7 @@ void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
 
         ret = versionedAssetId.value_or(assetId);
 
-        if (logger_->isSeverityLogged(Severity::kDebugApi))
+        if (!error && logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(logging::concatAsStr("OpenAssetIOAsset::buildAssetId -> ", ret));
         }
@@ -880,6 +2242,11 @@ void OpenAssetIOAsset::buildAssetId(const StringMap& fields, std::string& ret)
         }
         throw;
     }
+
+    if (error)
+    {
+        throwBatchElementError("buildAssetId", *error);
+    }
 }
 
 // NOLINTNEXTLINE(*-easily-swappable-parameters)
@@ -887,6 +2254,7 @@ void OpenAssetIOAsset::getAssetAttributes(const std::string& assetId,
                                           [[maybe_unused]] const std::string& scope,
                                           StringMap& returnAttrs)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getAssetAttributes"})};
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -905,16 +2273,76 @@ void OpenAssetIOAsset::getAssetAttributes(const std::string& assetId,
         using openassetio_mediacreation::traits::identity::DisplayNameTrait;
         using openassetio_mediacreation::traits::lifecycle::VersionTrait;
 
-        const auto entityReference = manager_->createEntityReference(assetId);
+        const ManagerLease lease = acquireManager();
+        const auto& manager = lease.manager();
 
-        // Find out what the asset management system knows about this asset.
-        auto traitSet =
-            manager_->entityTraits(entityReference, EntityTraitsAccess::kRead, context_);
+        const auto entityReference = manager->createEntityReference(assetId);
 
-        using openassetio::access::ResolveAccess;
+        // Find out what the asset management system knows about this
+        // asset. In read-only mode, this never changes, so is cached.
+        const auto traitSet = [&]
+        {
+            if (isReadOnly_)
+            {
+                auto cachedTraitSet = readOnlyQueryCache_.visit(
+                    assetId,
+                    lease.state->generation(),
+                    [](const CachedQueries& cached) { return cached.entityTraits; });
+                if (cachedTraitSet && *cachedTraitSet)
+                {
+                    readOnlyStats_.queryHits.increment();
+                    return std::move(**cachedTraitSet);
+                }
+                readOnlyStats_.queryMisses.increment();
+            }
+            auto queriedTraitSet = callManager(
+                lease,
+                "getAssetAttributes",
+                "entityTraits",
+                1,
+                {},
+                [manager, entityReference](const openassetio::ContextPtr& context) {
+                    return manager->entityTraits(
+                        entityReference, EntityTraitsAccess::kRead, context);
+                });
+            if (isReadOnly_)
+            {
+                rememberReadOnlyQuery(lease,
+                                      assetId,
+                                      [&](CachedQueries& cached)
+                                      { cached.entityTraits = queriedTraitSet; });
+            }
+            return queriedTraitSet;
+        }();
 
-        const auto traitsData =
-            manager_->resolve(entityReference, traitSet, ResolveAccess::kRead, context_);
+        using openassetio::access::ResolveAccess;
+
+        // In read-only mode, resolve via the read-only traits cache,
+        // see resolveForReadOrError.
+        const auto traitsData = [&]
+        {
+            if (!isReadOnly_)
+            {
+                return callManager(
+                    lease,
+                    "getAssetAttributes",
+                    "resolve",
+                    1,
+                    traitSet,
+                    [manager, entityReference, traitSet](const openassetio::ContextPtr& context) {
+                        return manager->resolve(
+                            entityReference, traitSet, ResolveAccess::kRead, context);
+                    });
+            }
+            auto maybeTraitsData =
+                resolveForReadOrError(lease, "getAssetAttributes", entityReference, traitSet);
+            if (const auto* error =
+                    std::get_if<openassetio::errors::BatchElementError>(&maybeTraitsData))
+            {
+                throwBatchElementError("getAssetAttributes", *error);
+            }
+            return std::get<openassetio::trait::TraitsDataPtr>(std::move(maybeTraitsData));
+        }();
 
         // TODO(DH): Determine alternative way to surface traits to Katana?
 
@@ -978,6 +2406,7 @@ void OpenAssetIOAsset::setAssetAttributes(const std::string& assetId,
                                           const std::string& scope,
                                           const StringMap& attrs)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"setAssetAttributes"})};
     if (logger_->isSeverityLogged(Severity::kDebugApi))
     {
         logger_->debugApi(logging::concatAsStr("OpenAssetIOAsset::setAssetAttributes(assetId=",
@@ -988,6 +2417,7 @@ void OpenAssetIOAsset::setAssetAttributes(const std::string& assetId,
                                                attrs,
                                                ")"));
     }
+    throwIfReadOnly("setAssetAttributes");
     // TODO(DH): Implement setAssetAttributes()
     (void)assetId;
     (void)scope;
@@ -999,6 +2429,7 @@ void OpenAssetIOAsset::getAssetIdForScope(const std::string& assetId,
                                           const std::string& scope,
                                           std::string& ret)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"getAssetIdForScope"})};
     if (logger_->isSeverityLogged(Severity::kDebugApi))
     {
         logger_->debugApi(logging::concatAsStr(
@@ -1018,6 +2449,9 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
                                           const bool createDirectory,
                                           std::string& assetId)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"createAssetAndPath"})};
+    const ScopedTimer publishTimer{publishDurations_.get({assetType, "createAssetAndPath"})};
+    PublishPhaseTimings phaseTimings;
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -1036,6 +2470,7 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
                                                    createDirectory,
                                                    ")"));
         }
+        throwIfReadOnly("createAssetAndPath");
         // `assetFields` comes from `getAssetFields`, with no mutations.
         //
         // `args` often starts off as a dict populated by the delegated
@@ -1085,29 +2520,48 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
         using openassetio_mediacreation::traits::relationship::SingularTrait;
         using openassetio_mediacreation::traits::usage::RelationshipTrait;
 
+        const ManagerLease lease = acquireManager(Subsystem::kPublish);
+        const auto& manager = lease.manager();
+        const auto& context = lease.context;
+
         const PublishStrategy& strategy = publishStrategies_.strategyForAssetType(assetType);
 
-        const auto entityPolicy = manager_->managementPolicy(
-            strategy.assetTraitSet(), openassetio::access::PolicyAccess::kWrite, context_);
+        const auto entityPolicy = [&]
+        {
+            const PublishPhaseScope phase{&phaseTimings, PublishPhase::kManagementPolicy};
+            recordRoundTrip("createAssetAndPath", "managementPolicy", 1, strategy.assetTraitSet());
+            return manager->managementPolicy(
+                strategy.assetTraitSet(), openassetio::access::PolicyAccess::kWrite, context);
+        }();
 
         if (!ManagedTrait::isImbuedTo(entityPolicy))
         {
             // TODO(DH): Attempt fallback to persist basic entity?
-            FnLogWarn("OpenAssetIO Manager '" + manager_->displayName() +
+            FnLogWarn("OpenAssetIO Manager '" + manager->displayName() +
                       "' does not support trait specifiction.");
             throw std::runtime_error("Specification not supported.");
         }
 
         // Indicate to the Manager we wish to publish something via preflight
-        const auto entityReference = manager_->createEntityReference(assetIdIt->second);
+        const auto entityReference = manager->createEntityReference(assetIdIt->second);
 
         const openassetio::EntityReference workingRef = [&]
         {
-            openassetio::EntityReference parentWorkingRef =
-                manager_->preflight(entityReference,
-                                    strategy.prePublishTraitData(assetFields, args),
-                                    openassetio::access::PublishingAccess::kWrite,
-                                    context_);
+            const TraitsDataPtr prePublishTraitsData = [&]
+            {
+                const PublishPhaseScope phase{&phaseTimings, PublishPhase::kTraitConstruction};
+                return strategy.prePublishTraitData(assetFields, args);
+            }();
+
+            openassetio::EntityReference parentWorkingRef = [&]
+            {
+                const PublishPhaseScope phase{&phaseTimings, PublishPhase::kPreflight};
+                recordRoundTrip("createAssetAndPath", "preflight", 1);
+                return manager->preflight(entityReference,
+                                          prePublishTraitsData,
+                                          openassetio::access::PublishingAccess::kWrite,
+                                          context);
+            }();
 
             // If the "versionUp" arg isn't set or is not "False", then
             // just use the `preflight()` reference.
@@ -1136,8 +2590,11 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
             // continue to use the entity returned from the above
             // `preflight()` call as the working reference.
 
-            const TraitsDataPtr versionTraitsData = manager_->resolve(
-                entityReference, {VersionTrait::kId}, ResolveAccess::kRead, context_);
+            const PublishPhaseScope versionProbePhase{&phaseTimings, PublishPhase::kVersionProbe};
+
+            recordRoundTrip("createAssetAndPath", "resolve", 1, {VersionTrait::kId});
+            const TraitsDataPtr versionTraitsData = manager->resolve(
+                entityReference, {VersionTrait::kId}, ResolveAccess::kRead, context);
 
             const auto maybeStableTag = VersionTrait{versionTraitsData}.getStableTag();
             // If we can't get the explicit version that we want to
@@ -1158,14 +2615,18 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
             // See if we can get a writeable reference to the
             // explicit version. Use kVariant tag so we can ignore
             // any errors.
+            recordRoundTrip("createAssetAndPath",
+                            "getWithRelationship",
+                            1,
+                            specificVersionRelationship->traitSet());
             const auto maybeEntityRefPager =
-                manager_->getWithRelationship(parentWorkingRef,
-                                              specificVersionRelationship,
-                                              1,
-                                              RelationsAccess::kWrite,
-                                              context_,
-                                              {},
-                                              BatchElementErrorPolicyTag::kVariant);
+                manager->getWithRelationship(parentWorkingRef,
+                                             specificVersionRelationship,
+                                             1,
+                                             RelationsAccess::kWrite,
+                                             context,
+                                             {},
+                                             BatchElementErrorPolicyTag::kVariant);
 
             const auto* entityRefPager = std::get_if<EntityReferencePagerPtr>(&maybeEntityRefPager);
             // If the relationship query isn't supported, then ignore
@@ -1188,6 +2649,10 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
         }();
 
         assetId = workingRef.toString();
+        {
+            const std::lock_guard lock{publishSourcesMutex_};
+            publishSources_.insert_or_assign(assetId, entityReference.toString());
+        }
 
         // In almost all cases, Katana will immediately pass `assetId`
         // to `resolveAsset()` and expect a file path to be returned.
@@ -1204,22 +2669,29 @@ void OpenAssetIOAsset::createAssetAndPath(FnKat::AssetTransaction* txn,
         // it should just leave the offending trait unset in the result.
         // So use the kVariant tag just in case, so we can ignore any
         // errors.
-        const auto maybeTraitsData = manager_->resolve(workingRef,
-                                                       {LocatableContentTrait::kId},
-                                                       ResolveAccess::kManagerDriven,
-                                                       context_,
-                                                       BatchElementErrorPolicyTag::kVariant);
+        const auto maybeTraitsData = [&]
+        {
+            const PublishPhaseScope phase{&phaseTimings, PublishPhase::kManagerDrivenResolve};
+            recordRoundTrip("createAssetAndPath", "resolve", 1, {LocatableContentTrait::kId});
+            return manager->resolve(workingRef,
+                                    {LocatableContentTrait::kId},
+                                    ResolveAccess::kManagerDriven,
+                                    context,
+                                    BatchElementErrorPolicyTag::kVariant);
+        }();
 
         if (const auto* traitsData = std::get_if<TraitsDataPtr>(&maybeTraitsData))
         {
             if (const auto url = LocatableContentTrait(*traitsData).getLocation())
             {
-                const std::string managerDrivenValue = fileUrlPathConverter_->pathFromUrl(*url);
+                const std::string managerDrivenValue = urlPathConverter_.pathFromUrl(*url);
                 assetId = pystring::join(constants::kAssetIdManagerDrivenValueSep,
                                          {assetId, managerDrivenValue});
             }
         }
 
+        recordPublishPhases("createAssetAndPath", assetType, phaseTimings);
+
         if (logger_->isSeverityLogged(Severity::kDebugApi))
         {
             logger_->debugApi(
@@ -1244,6 +2716,9 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
                                        const StringMap& args,
                                        std::string& assetId)
 {
+    const ScopedTimer callTimer{apiCallDurations_.get({"postCreateAsset"})};
+    const ScopedTimer publishTimer{publishDurations_.get({assetType, "postCreateAsset"})};
+    PublishPhaseTimings phaseTimings;
     try
     {
         if (logger_->isSeverityLogged(Severity::kDebugApi))
@@ -1261,6 +2736,7 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
                                      args,
                                      ")"));
         }
+        throwIfReadOnly("postCreateAsset");
         // getAssetFields re-populates this with our working entity reference.
         const auto assetIdIt = assetFields.find(constants::kEntityReference);
         if (assetIdIt == assetFields.cend())
@@ -1268,10 +2744,14 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
             throw std::runtime_error("Working EntityReference not specified in post-publish");
         }
 
+        const ManagerLease lease = acquireManager(Subsystem::kPublish);
+        const auto& manager = lease.manager();
+        const auto& context = lease.context;
+
         const PublishStrategy& strategy = publishStrategies_.strategyForAssetType(assetType);
 
         const auto workingEntityReference =
-            manager_->createEntityReferenceIfValid(assetIdIt->second);
+            manager->createEntityReferenceIfValid(assetIdIt->second);
         if (!workingEntityReference)
         {
             throw std::runtime_error(
@@ -1279,12 +2759,41 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
                 assetIdIt->second);
         }
 
-        assetId = manager_
-                      ->register_(workingEntityReference.value(),
-                                  strategy.postPublishTraitData(assetFields, args),
-                                  openassetio::access::PublishingAccess::kWrite,
-                                  context_)
-                      .toString();
+        // Includes any scan for the frames of an image sequence, which
+        // is timed separately.
+        const openassetio::trait::TraitsDataPtr postPublishTraitsData = [&]
+        {
+            const PublishPhaseScope phase{&phaseTimings, PublishPhase::kTraitConstruction};
+            return strategy.postPublishTraitData(assetFields, args);
+        }();
+
+        {
+            const PublishPhaseScope phase{&phaseTimings, PublishPhase::kRegister};
+            recordRoundTrip("postCreateAsset", "register", 1);
+            assetId = manager
+                          ->register_(workingEntityReference.value(),
+                                      postPublishTraitsData,
+                                      openassetio::access::PublishingAccess::kWrite,
+                                      context)
+                          .toString();
+        }
+
+        // The reference Katana probed before publishing may differ
+        // from both the working and the registered reference, so
+        // forget them all.
+        std::vector<std::string> publishedRefs{assetIdIt->second, assetId};
+        {
+            const std::lock_guard lock{publishSourcesMutex_};
+            if (auto sourceIt = publishSources_.find(assetIdIt->second);
+                sourceIt != publishSources_.end())
+            {
+                publishedRefs.push_back(std::move(sourceIt->second));
+                publishSources_.erase(sourceIt);
+            }
+        }
+        discardPublishedCacheEntries(publishedRefs);
+
+        recordPublishPhases("postCreateAsset", assetType, phaseTimings);
 
         if (logger_->isSeverityLogged(Severity::kDebugApi))
         {
@@ -1304,14 +2813,1571 @@ void OpenAssetIOAsset::postCreateAsset(FnKat::AssetTransaction* txn,
 }
 
 std::pair<openassetio::EntityReference, std::string>
-OpenAssetIOAsset::assetIdToEntityRefAndManagerDrivenValue(const std::string& assetId) const
+OpenAssetIOAsset::assetIdToEntityRefAndManagerDrivenValue(const ManagerLease& lease,
+                                                          const std::string& assetId)
 {
-    auto assetIdAndManagerDrivenValue =
-        pystring::rsplit(assetId, constants::kAssetIdManagerDrivenValueSep, 1);
+    auto [ref, managerDrivenValue] = splitManagerDrivenValue(assetId);
+    return {lease.manager()->createEntityReference(std::move(ref)), std::move(managerDrivenValue)};
+}
+
+template <class Fn>
+std::invoke_result_t<Fn, const openassetio::ContextPtr&> OpenAssetIOAsset::callManager(
+    const ManagerLease& lease,
+    const std::string_view method,
+    const std::string_view managerCall,
+    const std::size_t numElements,
+    const openassetio::trait::TraitSet& traitSet,
+    Fn call)
+{
+    return callWithDeadline(
+        method,
+        circuitBreaker_,
+        "manager",
+        [&] { recordRoundTrip(method, managerCall, numElements, traitSet); },
+        [call = std::move(call), lease, callingThreadId = std::this_thread::get_id()]
+        {
+            // A worker thread uses its own context, rather than sharing
+            // that of the calling thread.
+            return call(std::this_thread::get_id() == callingThreadId
+                            ? lease.context
+                            : lease.state->contextForCurrentThread(lease.subsystem));
+        });
+}
+
+std::vector<std::variant<openassetio::errors::BatchElementError, openassetio::trait::TraitsDataPtr>>
+OpenAssetIOAsset::resolveBatch(const ManagerLease& lease,
+                               const std::string_view method,
+                               const openassetio::EntityReferences& entityReferences,
+                               const openassetio::trait::TraitSet& traitSet)
+{
+    using openassetio::access::ResolveAccess;
+    using BatchElementErrorPolicyTag = openassetio::hostApi::Manager::BatchElementErrorPolicyTag;
+
+    return callManager(lease,
+                       method,
+                       "resolve",
+                       entityReferences.size(),
+                       traitSet,
+                       [manager = lease.manager(), entityReferences, traitSet](
+                           const openassetio::ContextPtr& context)
+                       {
+                           return manager->resolve(entityReferences,
+                                                   traitSet,
+                                                   ResolveAccess::kRead,
+                                                   context,
+                                                   BatchElementErrorPolicyTag::kVariant);
+                       });
+}
+
+template <class OnAdmitted, class Fn>
+std::invoke_result_t<Fn> OpenAssetIOAsset::callWithDeadline(const std::string_view method,
+                                                            CircuitBreaker& circuitBreaker,
+                                                            const std::string_view service,
+                                                            OnAdmitted onAdmitted,
+                                                            Fn call)
+{
+    const auto deadlineIt = [&]
+    {
+        const auto methodIt = callDeadlines_.find(method);
+        return methodIt != callDeadlines_.end() ? methodIt
+                                                : callDeadlines_.find(kDefaultCallDeadlineKey);
+    }();
+
+    if (deadlineIt == callDeadlines_.end() || deadlineIt->second.count() == 0)
+    {
+        onAdmitted();
+        return call();
+    }
+    const std::chrono::milliseconds deadline = deadlineIt->second;
+
+    switch (circuitBreaker.admit())
+    {
+    case CircuitBreaker::Admission::kAllowed:
+        break;
+    case CircuitBreaker::Admission::kProbe:
+        callStats_.probes.increment();
+        break;
+    case CircuitBreaker::Admission::kRejected:
+        callStats_.rejections.increment();
+        throw DeadlineExceededError{
+            logging::concatAsStr("OpenAssetIOAsset::",
+                                 method,
+                                 ": not calling ",
+                                 service,
+                                 ", as it has repeatedly failed to respond in time")};
+    }
+
+    onAdmitted();
+    auto result = callExecutor_.submit(std::move(call));
+
+    const bool isReady = [&]
+    {
+        // The worker may need the GIL to call a Python manager.
+        const ScopedGilRelease releaseGil;
+        return result.wait_for(deadline) == std::future_status::ready;
+    }();
+
+    if (!isReady)
+    {
+        callStats_.timeouts.increment();
+        if (circuitBreaker.recordFailure() && logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(
+                "OpenAssetIOAsset: ",
+                service,
+                " repeatedly failed to respond in time. Suspending calls, retrying every ",
+                circuitBreaker.probeInterval().count(),
+                "ms"));
+        }
+        throw DeadlineExceededError{logging::concatAsStr("OpenAssetIOAsset::",
+                                                         method,
+                                                         ": ",
+                                                         service,
+                                                         " failed to respond within ",
+                                                         deadline.count(),
+                                                         "ms")};
+    }
+
+    if (circuitBreaker.recordSuccess() && logger_->isSeverityLogged(Severity::kInfo))
+    {
+        logger_->info(logging::concatAsStr(
+            "OpenAssetIOAsset: ", service, " is responding again. Resuming calls"));
+    }
+    return result.get();
+}
+
+void OpenAssetIOAsset::recordRoundTrip(const std::string_view method,
+                                       const std::string_view managerCall,
+                                       const std::size_t numElements,
+                                       const openassetio::trait::TraitSet& traitSet)
+{
+    managerBatchSizes_.get({managerCall}).observe(static_cast<double>(numElements));
+    warnBatchable(roundTripMonitor_.record(method, managerCall, numElements, traitSet));
+}
+
+void OpenAssetIOAsset::warnBatchable(const std::vector<BatchableCalls>& newlyBatchable)
+{
+    if (newlyBatchable.empty() || !logger_->isSeverityLogged(Severity::kWarning))
+    {
+        return;
+    }
+    for (const BatchableCalls& batchable : newlyBatchable)
+    {
+        logger_->warning(logging::concatAsStr("OpenAssetIOAsset: ",
+                                              batchable.method,
+                                              " made ",
+                                              batchable.maxCalls,
+                                              " single-element '",
+                                              batchable.managerCall,
+                                              "' calls for traits ",
+                                              batchable.traitIds,
+                                              " within one operation, which could be batched"));
+    }
+}
+
+void OpenAssetIOAsset::recordPublishPhases(const std::string_view method,
+                                           const std::string& assetType,
+                                           const PublishPhaseTimings& timings)
+{
+    const bool isLogged = logger_->isSeverityLogged(Severity::kDebugApi);
+    std::string phaseDurations;
+    for (std::size_t phaseIdx = 0; phaseIdx < kNumPublishPhases; ++phaseIdx)
+    {
+        const auto phase = static_cast<PublishPhase>(phaseIdx);
+        if (!timings.wasTimed(phase))
+        {
+            continue;
+        }
+        const std::chrono::duration<double> duration = timings.duration(phase);
+        publishPhaseDurations_.get({assetType, publishPhaseName(phase)}).observe(duration.count());
+        if (isLogged)
+        {
+            phaseDurations += logging::concatAsStr(
+                phaseDurations.empty() ? "" : ", ",
+                publishPhaseName(phase),
+                "=",
+                std::chrono::duration<double, std::milli>{duration}.count(),
+                "ms");
+        }
+    }
+    if (isLogged)
+    {
+        logger_->debugApi(logging::concatAsStr(
+            "OpenAssetIOAsset::", method, " phases (assetType=", assetType, "): ", phaseDurations));
+    }
+}
+
+std::string OpenAssetIOAsset::renderMetrics() const
+{
+    using Labels = PrometheusText::Labels;
+    static const std::vector<double> kQuantiles{0.5, 0.99};
+
+    PrometheusText text;
+    const auto counter = [&](const std::string_view name,
+                             const std::string_view help,
+                             const std::uint64_t value)
+    {
+        text.describe(name, "counter", help);
+        text.sample(name, {}, value);
+    };
+    const auto gauge = [&](const std::string_view name,
+                           const std::string_view help,
+                           const std::uint64_t value)
+    {
+        text.describe(name, "gauge", help);
+        text.sample(name, {}, value);
+    };
+    const auto countersBy =
+        [&](const std::string_view name,
+            const std::string_view help,
+            const std::string_view labelName,
+            std::initializer_list<std::pair<std::string_view, std::uint64_t>> countsByLabel)
+    {
+        text.describe(name, "counter", help);
+        for (const auto& [label, count] : countsByLabel)
+        {
+            text.sample(name, Labels{{labelName, label}}, count);
+        }
+    };
+    const auto hitsAndMisses = [&](const std::string_view name,
+                                   const std::string_view help,
+                                   std::initializer_list<std::pair<std::string_view, std::uint64_t>>
+                                       countsByResult)
+    { countersBy(name, help, "result", countsByResult); };
+
+    text.describe("katanaopenassetio_api_call_duration_seconds",
+                  "histogram",
+                  "Duration of Asset API calls, by method.");
+    text.histograms("katanaopenassetio_api_call_duration_seconds", apiCallDurations_);
+    text.describe("katanaopenassetio_api_call_duration_quantile_seconds",
+                  "gauge",
+                  "Estimated quantiles of the duration of Asset API calls, by method.");
+    text.quantiles(
+        "katanaopenassetio_api_call_duration_quantile_seconds", apiCallDurations_, kQuantiles);
+
+    counter("katanaopenassetio_manager_round_trips_total",
+            "Calls made to the manager.",
+            roundTripMonitor_.numRoundTrips());
+    text.describe("katanaopenassetio_manager_batch_size",
+                  "histogram",
+                  "Number of elements in each call made to the manager, by manager method.");
+    text.histograms("katanaopenassetio_manager_batch_size", managerBatchSizes_);
+    counter("katanaopenassetio_manager_call_timeouts_total",
+            "Manager calls abandoned after their deadline passed.",
+            callStats_.timeouts.value());
+    counter("katanaopenassetio_manager_call_rejections_total",
+            "Manager calls not attempted, as the manager is unresponsive.",
+            callStats_.rejections.value());
+
+    hitsAndMisses("katanaopenassetio_path_cache_lookups_total",
+                  "Resolved path cache lookups, by result.",
+                  {{"hit", pathCacheStats_.hits.value()},
+                   {"stale_hit", pathCacheStats_.staleHits.value()},
+                   {"miss", pathCacheStats_.misses.value()}});
+    hitsAndMisses("katanaopenassetio_negative_cache_lookups_total",
+                  "Lookups of recently encountered errors, by result.",
+                  {{"hit", negativeCacheStats_.hits.value()},
+                   {"miss", negativeCacheStats_.misses.value()}});
+    hitsAndMisses("katanaopenassetio_read_only_traits_lookups_total",
+                  "Cached trait lookups in read-only mode, by result.",
+                  {{"hit", readOnlyStats_.traitsHits.value()},
+                   {"miss", readOnlyStats_.traitsMisses.value()}});
+    hitsAndMisses("katanaopenassetio_read_only_query_lookups_total",
+                  "Cached entity trait and version queries in read-only mode, by result.",
+                  {{"hit", readOnlyStats_.queryHits.value()},
+                   {"miss", readOnlyStats_.queryMisses.value()}});
+    const AssetIdCheckStats& assetIdCheckStats = assetIdFilter_.stats();
+    hitsAndMisses("katanaopenassetio_asset_id_checks_total",
+                  "Checks of whether a string is an asset ID, by how they were answered.",
+                  {{"prefix", assetIdCheckStats.prefixChecks.value()},
+                   {"memo_hit", assetIdCheckStats.memoHits.value()},
+                   {"first_sighting", assetIdCheckStats.firstSightings.value()},
+                   {"manager", assetIdCheckStats.managerChecks.value()}});
+    const UrlConversionStats& urlConversionStats = urlPathConverter_.stats();
+    hitsAndMisses("katanaopenassetio_url_conversions_total",
+                  "URL to path conversions, by how they were answered.",
+                  {{"fast_path", urlConversionStats.fastPaths.value()},
+                   {"memo_hit", urlConversionStats.memoHits.value()},
+                   {"full", urlConversionStats.fullConversions.value()}});
+
+    gauge("katanaopenassetio_cache_memory_bytes",
+          "Memory used by caches.",
+          std::uint64_t{cacheMemoryBudget_.usage()});
+    gauge("katanaopenassetio_cache_memory_budget_bytes",
+          "Memory budget of caches. 0 if unlimited.",
+          std::uint64_t{cacheMemoryBudget_.limit()});
+    countersBy("katanaopenassetio_cache_evictions_total",
+               "Cache entries evicted to stay within the memory budget, by cache.",
+               "cache",
+               {{"negative", negativeCache_.evictions()},
+                {"path", pathCache_.evictions()},
+                {"recent_calls", recentCalls_.evictions()},
+                {"url_memo", urlPathConverter_.memoEvictions()},
+                {"asset_id_memo", assetIdFilter_.memoEvictions()},
+                {"read_only_traits", readOnlyTraitsCache_.evictions()},
+                {"read_only_queries", readOnlyQueryCache_.evictions()}});
+    counter("katanaopenassetio_directory_scan_evictions_total",
+            "Cached directory listings evicted.",
+            directoryScanCache_.stats().evictions.value());
+
+    text.describe("katanaopenassetio_publish_duration_seconds",
+                  "histogram",
+                  "Duration of publishing Asset API calls, by asset type and method.");
+    text.histograms("katanaopenassetio_publish_duration_seconds", publishDurations_);
+    text.describe("katanaopenassetio_publish_duration_quantile_seconds",
+                  "gauge",
+                  "Estimated quantiles of the duration of publishing Asset API calls.");
+    text.quantiles(
+        "katanaopenassetio_publish_duration_quantile_seconds", publishDurations_, kQuantiles);
+    text.describe("katanaopenassetio_publish_phase_duration_seconds",
+                  "histogram",
+                  "Duration of each phase of publishing, by asset type and phase.");
+    text.histograms("katanaopenassetio_publish_phase_duration_seconds", publishPhaseDurations_);
+    text.describe("katanaopenassetio_publish_phase_duration_quantile_seconds",
+                  "gauge",
+                  "Estimated quantiles of the duration of each phase of publishing.");
+    text.quantiles("katanaopenassetio_publish_phase_duration_quantile_seconds",
+                   publishPhaseDurations_,
+                   kQuantiles);
+
+    return text.str();
+}
+
+std::variant<openassetio::errors::BatchElementError, openassetio::trait::TraitsDataPtr>
+OpenAssetIOAsset::resolveForReadOrError(const ManagerLease& lease,
+                                        const std::string_view method,
+                                        const openassetio::EntityReference& entityReference,
+                                        const openassetio::trait::TraitSet& traitSet)
+{
+    using openassetio::access::ResolveAccess;
+    using openassetio::errors::BatchElementError;
+    using BatchElementErrorPolicyTag = openassetio::hostApi::Manager::BatchElementErrorPolicyTag;
+
+    if (auto negativeResult =
+            negativeCache_.get(entityReference.toString(), lease.state->generation()))
+    {
+        negativeCacheStats_.hits.increment();
+        return std::move(negativeResult->error);
+    }
+    negativeCacheStats_.misses.increment();
+
+    // In read-only mode, resolved traits never change, so are kept for
+    // the lifetime of the process. Traits resolved previously for the
+    // reference are requested again, so that the cached entry
+    // accumulates all the traits queried for the reference.
+    openassetio::trait::TraitSet previouslyResolvedTraitSet;
+    if (isReadOnly_)
+    {
+        auto cachedTraitsData = readOnlyTraitsCache_.visit(
+            entityReference.toString(),
+            lease.state->generation(),
+            [&](const CachedTraits& cached) -> openassetio::trait::TraitsDataPtr
+            {
+                for (const auto& traitId : traitSet)
+                {
+                    if (cached.resolvedTraitSet.count(traitId) == 0)
+                    {
+                        previouslyResolvedTraitSet = cached.resolvedTraitSet;
+                        return nullptr;
+                    }
+                }
+                return cached.traitsData;
+            });
+        if (cachedTraitsData && *cachedTraitsData)
+        {
+            readOnlyStats_.traitsHits.increment();
+            return std::move(*cachedTraitsData);
+        }
+        readOnlyStats_.traitsMisses.increment();
+    }
+
+    if (auto traitsData = takeSpeculativeTraits(lease, method, entityReference, traitSet))
+    {
+        return std::move(*traitsData);
+    }
+    openassetio::trait::TraitSet resolveTraitSet = withSpeculativeTraits(method, traitSet);
+    resolveTraitSet.insert(previouslyResolvedTraitSet.begin(), previouslyResolvedTraitSet.end());
+
+    auto maybeTraitsData = callManager(
+        lease,
+        method,
+        "resolve",
+        1,
+        resolveTraitSet,
+        [manager = lease.manager(), entityReference, resolveTraitSet](
+            const openassetio::ContextPtr& context)
+        {
+            return manager->resolve(entityReference,
+                                    resolveTraitSet,
+                                    ResolveAccess::kRead,
+                                    context,
+                                    BatchElementErrorPolicyTag::kVariant);
+        });
+
+    if (const auto* error = std::get_if<BatchElementError>(&maybeTraitsData))
+    {
+        rememberNegativeResult(lease, entityReference, *error, error->message);
+    }
+    else
+    {
+        const auto& traitsData = std::get<openassetio::trait::TraitsDataPtr>(maybeTraitsData);
+        rememberRecentCall(lease,
+                           method,
+                           entityReference,
+                           traitsData,
+                           resolveTraitSet,
+                           resolveTraitSet.size() != traitSet.size());
+        if (isReadOnly_)
+        {
+            readOnlyTraitsCache_.put(entityReference.toString(),
+                                     lease.state->generation(),
+                                     CachedTraits{traitsData, resolveTraitSet},
+                                     ReferenceCache<CachedTraits>::kNeverExpires);
+        }
+    }
+    return maybeTraitsData;
+}
+
+std::optional<openassetio::trait::TraitsDataPtr> OpenAssetIOAsset::takeSpeculativeTraits(
+    const ManagerLease& lease,
+    const std::string_view method,
+    const openassetio::EntityReference& entityReference,
+    const openassetio::trait::TraitSet& traitSet)
+{
+    if (speculationWindow_.count() == 0)
+    {
+        return std::nullopt;
+    }
+    callPatternPredictor_.recordCall(method, traitSet);
+
+    auto recentCall = recentCalls_.get(entityReference.toString(), lease.state->generation());
+    if (!recentCall || recentCall->method == method)
+    {
+        // Repeated calls to the same method are not follow-ups, and
+        // are left to other caches.
+        return std::nullopt;
+    }
+    callPatternPredictor_.recordSuccessor(recentCall->method, method);
+    speculationStats_.successorsObserved.increment();
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!recentCall->isSpeculative || now - recentCall->resolvedAt >= speculationWindow_)
+    {
+        return std::nullopt;
+    }
+    for (const auto& traitId : traitSet)
+    {
+        if (recentCall->resolvedTraitSet.count(traitId) == 0)
+        {
+            return std::nullopt;
+        }
+    }
+    speculationStats_.hits.increment();
+
+    // Become the most recent call, so that a chain of follow-ups can
+    // be served by the same speculative fetch.
+    recentCall->method = std::string{method};
+    recentCalls_.put(
+        entityReference.toString(), lease.state->generation(), *recentCall, speculationWindow_);
+    return std::move(recentCall->traitsData);
+}
+
+openassetio::trait::TraitSet OpenAssetIOAsset::withSpeculativeTraits(
+    const std::string_view method, const openassetio::trait::TraitSet& traitSet)
+{
+    if (speculationWindow_.count() == 0)
+    {
+        return traitSet;
+    }
+    openassetio::trait::TraitSet resolveTraitSet = callPatternPredictor_.predictTraits(method);
+    resolveTraitSet.insert(traitSet.begin(), traitSet.end());
+    if (resolveTraitSet.size() != traitSet.size())
+    {
+        speculationStats_.speculations.increment();
+    }
+    return resolveTraitSet;
+}
+
+void OpenAssetIOAsset::rememberRecentCall(const ManagerLease& lease,
+                                          const std::string_view method,
+                                          const openassetio::EntityReference& entityReference,
+                                          const openassetio::trait::TraitsDataPtr& traitsData,
+                                          const openassetio::trait::TraitSet& resolvedTraitSet,
+                                          const bool isSpeculative)
+{
+    if (speculationWindow_.count() == 0)
+    {
+        return;
+    }
+    recentCalls_.put(entityReference.toString(),
+                     lease.state->generation(),
+                     RecentCall{std::string{method},
+                                traitsData,
+                                resolvedTraitSet,
+                                std::chrono::steady_clock::now(),
+                                isSpeculative},
+                     speculationWindow_);
+}
+
+PyObject* OpenAssetIOAsset::outDictArg(const StringMap& commandArgs)
+{
+    PyObject* pyOutDict = pyIdStrToObj(commandArgs.at("outDictId"));
+    if (!PyDict_Check(pyOutDict))
+    {
+        if (logger_->isSeverityLogged(Severity::kDebug))
+        {
+            logger_->debug(
+                "OpenAssetIOAsset::runAssetPluginCommand -> ERROR: Invalid object type for "
+                "output variable - must be dict");
+        }
+        return nullptr;
+    }
+    return pyOutDict;
+}
+
+void OpenAssetIOAsset::throwIfReadOnly(const std::string_view method)
+{
+    if (!isReadOnly_)
+    {
+        return;
+    }
+    readOnlyStats_.rejectedWrites.increment();
+    throw std::runtime_error{
+        logging::concatAsStr("OpenAssetIOAsset::", method, " is not available in read-only mode")};
+}
+
+template <class Fn>
+void OpenAssetIOAsset::rememberReadOnlyQuery(const ManagerLease& lease,
+                                             const std::string& ref,
+                                             Fn update)
+{
+    // Concurrent updates of the same reference may lose one another's
+    // results, which are then simply queried again.
+    CachedQueries cached =
+        readOnlyQueryCache_.get(ref, lease.state->generation()).value_or(CachedQueries{});
+    update(cached);
+    readOnlyQueryCache_.put(ref,
+                            lease.state->generation(),
+                            std::move(cached),
+                            ReferenceCache<CachedQueries>::kNeverExpires);
+}
+
+void OpenAssetIOAsset::throwBatchElementError(const std::string_view method,
+                                              const openassetio::errors::BatchElementError& error)
+{
+    if (logger_->isSeverityLogged(Severity::kDebug))
+    {
+        logger_->debug(
+            logging::concatAsStr("OpenAssetIOAsset::", method, " -> ERROR: ", error.message));
+    }
+    throw openassetio::errors::BatchElementException{0, error, error.message};
+}
+
+void OpenAssetIOAsset::rememberNegativeResult(const ManagerLease& lease,
+                                              const openassetio::EntityReference& entityReference,
+                                              const openassetio::errors::BatchElementError& error,
+                                              std::string message)
+{
+    if ((negativeCacheTtl_.count() == 0 && !isReadOnly_) || !isNegativelyCacheable(error))
+    {
+        return;
+    }
+    negativeCache_.put(entityReference.toString(),
+                       lease.state->generation(),
+                       NegativeResult{error, std::move(message)},
+                       isReadOnly_ ? ReferenceCache<NegativeResult>::kNeverExpires
+                                   : negativeCacheTtl_);
+}
+
+std::variant<openassetio::errors::BatchElementError, std::string>
+OpenAssetIOAsset::resolvePathForRead(const ManagerLease& lease,
+                                     const std::string_view method,
+                                     const openassetio::EntityReference& entityReference)
+{
+    using openassetio::errors::BatchElementError;
+    using openassetio::trait::TraitsDataPtr;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+    using Clock = std::chrono::steady_clock;
+
+    const bool isPathCacheEnabled = isReadOnly_ || pathCacheHardTtl_.count() != 0;
+
+    if (isPathCacheEnabled)
+    {
+        bool isStale = false;
+        auto cachedPath = pathCache_.visit(
+            entityReference.toString(),
+            lease.state->generation(),
+            [&](const CachedPath& cached)
+            {
+                isStale = cached.mutability == Mutability::kMutable &&
+                          Clock::now() - cached.resolvedAt >= pathCacheSoftTtl_;
+                return cached.path.str();
+            });
+        if (cachedPath)
+        {
+            if (isStale)
+            {
+                pathCacheStats_.staleHits.increment();
+                pathRefresher_.request(entityReference.toString());
+            }
+            else
+            {
+                pathCacheStats_.hits.increment();
+            }
+            return std::move(*cachedPath);
+        }
+        pathCacheStats_.misses.increment();
+    }
+
+    std::variant<BatchElementError, TraitsDataPtr> maybeTraitData{TraitsDataPtr{}};
+    try
+    {
+        // VersionTrait is only needed to classify the reference for
+        // caching.
+        maybeTraitData = resolveForReadOrError(
+            lease,
+            method,
+            entityReference,
+            isPathCacheEnabled ? openassetio::trait::TraitSet{LocatableContentTrait::kId,
+                                                              VersionTrait::kId}
+                               : openassetio::trait::TraitSet{LocatableContentTrait::kId});
+    }
+    catch (const DeadlineExceededError& exc)
+    {
+        // Prefer a possibly out of date path to failing outright.
+        auto lastKnownGood =
+            isPathCacheEnabled ? pathCache_.getIgnoringExpiry(entityReference.toString(),
+                                                              lease.state->generation())
+                               : std::nullopt;
+        if (!lastKnownGood)
+        {
+            throw;
+        }
+        callStats_.lastKnownGoodFallbacks.increment();
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(exc.what(),
+                                                  ". Using last known path for ",
+                                                  entityReference.toString(),
+                                                  ": ",
+                                                  lastKnownGood->path.str()));
+        }
+        return lastKnownGood->path.str();
+    }
+
+    if (auto* error = std::get_if<BatchElementError>(&maybeTraitData))
+    {
+        return std::move(*error);
+    }
+    const TraitsDataPtr& traitData = std::get<TraitsDataPtr>(maybeTraitData);
+    const auto url = LocatableContentTrait(traitData).getLocation();
+
+    if (!url)
+    {
+        return BatchElementError{BatchElementError::ErrorCode::kEntityResolutionError,
+                                 entityReference.toString() + " has no location"};
+    }
+    std::string path = urlPathConverter_.pathFromUrl(*url);
+
+    if (isPathCacheEnabled)
+    {
+        cachePath(lease, entityReference.toString(), path, traitData);
+    }
+    return path;
+}
+
+bool OpenAssetIOAsset::isEntityReferenceString(const ManagerLease& lease,
+                                               const std::string_view method,
+                                               const std::string& str)
+{
+    return assetIdFilter_.isEntityReferenceString(
+        str,
+        lease.state->generation(),
+        lease.state->entityReferencePrefix(),
+        [&](const std::string& candidate)
+        {
+            recordRoundTrip(method, "isEntityReferenceString", 1);
+            return lease.manager()->isEntityReferenceString(candidate);
+        });
+}
+
+void OpenAssetIOAsset::cachePath(const ManagerLease& lease,
+                                 const std::string& ref,
+                                 const std::string_view path,
+                                 const openassetio::trait::TraitsDataPtr& traitsData)
+{
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    const auto now = std::chrono::steady_clock::now();
+    const Mutability mutability = mutabilityFromVersion(traitsData);
+    // In read-only mode, all references are treated as immutable.
+    if (mutability == Mutability::kImmutable || isReadOnly_)
+    {
+        pathCache_.put(ref,
+                       lease.state->generation(),
+                       CachedPath{pathInterner_.intern(path), now, Mutability::kImmutable, {}},
+                       ReferenceCache<CachedPath>::kNeverExpires);
+        pathCacheStats_.immutableInserts.increment();
+    }
+    else
+    {
+        pathCache_.put(ref,
+                       lease.state->generation(),
+                       CachedPath{pathInterner_.intern(path),
+                                  now,
+                                  mutability,
+                                  VersionTrait{traitsData}.getStableTag().value_or("")},
+                       pathCacheHardTtl_);
+        pathCacheStats_.mutableInserts.increment();
+    }
+}
+
+void OpenAssetIOAsset::refreshPaths(const std::vector<std::string>& refs)
+{
+    if (logger_->isSeverityLogged(Severity::kDebug))
+    {
+        logger_->debug(
+            logging::concatAsStr("OpenAssetIOAsset: refreshing ", refs.size(), " cached path(s)"));
+    }
+    pathCacheStats_.refreshBatches.increment();
+    resolvePathsIntoCache(
+        refs, Subsystem::kBackground, pathCacheStats_.refreshes, pathCacheStats_.refreshFailures);
+}
+
+void OpenAssetIOAsset::prefetchPaths(const std::vector<std::string>& refs)
+{
+    if (logger_->isSeverityLogged(Severity::kDebug))
+    {
+        logger_->debug(
+            logging::concatAsStr("OpenAssetIOAsset: prefetching ", refs.size(), " path(s)"));
+    }
+    prefetchStats_.batches.increment();
 
-    return {manager_->createEntityReference(std::move(assetIdAndManagerDrivenValue.front())),
-            assetIdAndManagerDrivenValue.size() > 1 ? std::move(assetIdAndManagerDrivenValue.back())
-                                                    : ""};
+    if (resolverClient_)
+    {
+        // Warm the resolver server's cache instead, from which
+        // subsequent queries will be served.
+        try
+        {
+            resolver_protocol::Request request{resolver_protocol::Operation::kResolvePath, {}};
+            request.items.reserve(refs.size());
+            for (const std::string& ref : refs)
+            {
+                request.items.push_back({ref});
+            }
+            std::vector<resolver_protocol::Result> results;
+            {
+                const ScopedGilRelease releaseGil;
+                results = resolverClient_->call(request);
+            }
+            for (const auto& result : results)
+            {
+                (result.status == resolver_protocol::Status::kOk ? prefetchStats_.resolved
+                                                                 : prefetchStats_.failures)
+                    .increment();
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            prefetchStats_.failures.increment(refs.size());
+            if (logger_->isSeverityLogged(Severity::kWarning))
+            {
+                logger_->warning(logging::concatAsStr(
+                    "OpenAssetIOAsset: failed to prefetch paths via resolver: ", exc.what()));
+            }
+        }
+        return;
+    }
+
+    resolvePathsIntoCache(
+        refs, Subsystem::kBackground, prefetchStats_.resolved, prefetchStats_.failures);
+}
+
+class OpenAssetIOAsset::BackgroundResolveScope
+{
+public:
+    explicit BackgroundResolveScope(OpenAssetIOAsset* asset) : asset_{asset}
+    {
+        const std::lock_guard lock{asset_->publishedRefsMutex_};
+        ++asset_->numBackgroundResolves_;
+        publishSequence_ = asset_->publishSequence_;
+    }
+
+    ~BackgroundResolveScope()
+    {
+        const std::lock_guard lock{asset_->publishedRefsMutex_};
+        if (--asset_->numBackgroundResolves_ == 0)
+        {
+            asset_->publishedRefs_.clear();
+        }
+    }
+
+    BackgroundResolveScope(const BackgroundResolveScope&) = delete;
+    BackgroundResolveScope& operator=(const BackgroundResolveScope&) = delete;
+    BackgroundResolveScope(BackgroundResolveScope&&) = delete;
+    BackgroundResolveScope& operator=(BackgroundResolveScope&&) = delete;
+
+    /// Whether the reference was published since the scope began, so
+    /// may have been resolved before the publish.
+    [[nodiscard]] bool isPublished(const std::string& ref) const
+    {
+        const std::lock_guard lock{asset_->publishedRefsMutex_};
+        const auto refIt = asset_->publishedRefs_.find(ref);
+        return refIt != asset_->publishedRefs_.end() && refIt->second > publishSequence_;
+    }
+
+private:
+    OpenAssetIOAsset* asset_;
+    std::uint64_t publishSequence_;
+};
+
+void OpenAssetIOAsset::resolvePathsIntoCache(const std::vector<std::string>& refs,
+                                             const Subsystem subsystem,
+                                             Counter& resolvedCount,
+                                             Counter& failedCount)
+{
+    using openassetio::errors::BatchElementError;
+    using openassetio::trait::TraitsDataPtr;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    try
+    {
+        const BackgroundResolveScope resolveScope{this};
+        const std::uint64_t epoch = pathCacheEpoch_.load(std::memory_order_acquire);
+        const auto isCleared = [&]
+        { return pathCacheEpoch_.load(std::memory_order_acquire) != epoch; };
+
+        const ManagerLease lease = acquireManager(subsystem);
+        const auto& manager = lease.manager();
+
+        openassetio::EntityReferences entityReferences;
+        entityReferences.reserve(refs.size());
+        for (const std::string& ref : refs)
+        {
+            entityReferences.push_back(manager->createEntityReference(ref));
+        }
+
+        const auto results = resolveBatch(lease,
+                                          "resolvePathsIntoCache",
+                                          entityReferences,
+                                          {LocatableContentTrait::kId, VersionTrait::kId});
+        for (std::size_t idx = 0; idx < results.size() && !isCleared(); ++idx)
+        {
+            if (resolveScope.isPublished(refs[idx]))
+            {
+                continue;
+            }
+            if (const auto* error = std::get_if<BatchElementError>(&results[idx]))
+            {
+                failedCount.increment();
+                // Transient errors, e.g. a brief outage, leave any
+                // last-known-good path to be served until its hard TTL
+                // expires.
+                if (!isNegativelyCacheable(*error))
+                {
+                    continue;
+                }
+                // Subsequent lookups will resolve synchronously, and so
+                // surface the error to the caller.
+                pathCache_.erase(refs[idx]);
+                rememberNegativeResult(lease, entityReferences[idx], *error, error->message);
+                continue;
+            }
+            const auto& traitsData = std::get<TraitsDataPtr>(results[idx]);
+            const auto url = LocatableContentTrait(traitsData).getLocation();
+            if (!url)
+            {
+                pathCache_.erase(refs[idx]);
+                failedCount.increment();
+                continue;
+            }
+            cachePath(lease, refs[idx], urlPathConverter_.pathFromUrl(*url), traitsData);
+            resolvedCount.increment();
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        // Any stale entries remain usable until their hard TTL expires,
+        // at which point they are resolved synchronously.
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(
+                "OpenAssetIOAsset: failed to resolve paths in the background: ", exc.what()));
+        }
+    }
+}
+
+std::vector<std::string> OpenAssetIOAsset::uncachedReferences(
+    const ManagerLease& lease, const std::vector<std::string>& assetIds)
+{
+    std::vector<std::string> refs;
+    for (std::string assetId : assetIds)
+    {
+        // Strip any manager-driven value, see
+        // assetIdToEntityRefAndManagerDrivenValue.
+        const std::size_t sepPos = assetId.rfind(constants::kAssetIdManagerDrivenValueSep);
+        if (sepPos != std::string::npos)
+        {
+            assetId.resize(sepPos);
+        }
+        // Candidates are filtered ahead of resolving their paths, so
+        // any manager calls are accounted to that.
+        if (!isEntityReferenceString(lease, "resolvePathsIntoCache", assetId) ||
+            pathCache_.contains(assetId, lease.state->generation()) ||
+            negativeCache_.contains(assetId, lease.state->generation()))
+        {
+            continue;
+        }
+        refs.push_back(std::move(assetId));
+    }
+    return refs;
+}
+
+std::vector<std::string> OpenAssetIOAsset::referencePrefixes(const StringMap& commandArgs)
+{
+    if (const auto prefixesIt = commandArgs.find("prefixes"); prefixesIt != commandArgs.end())
+    {
+        return pystring::split(prefixesIt->second, ",");
+    }
+
+    std::optional<std::string> prefix = entityReferencePrefix();
+    if (!prefix)
+    {
+        throw std::runtime_error(
+            "OpenAssetIO does not provide entity reference prefix. Specify "
+            "\"prefixes\" explicitly.");
+    }
+    return {std::move(*prefix)};
+}
+
+void OpenAssetIOAsset::prefetchReferencesInFile(const std::string& path,
+                                                const std::vector<std::string>& prefixes)
+{
+    try
+    {
+        const MappedFile file{path};
+        const std::string_view contents = file.contents();
+
+        if (contents.substr(0, kGzipMagic.size()) == kGzipMagic)
+        {
+            throw std::runtime_error{"compressed files are not supported"};
+        }
+
+        const std::vector<std::string> candidates = findEntityReferences(contents, prefixes);
+
+        // A resolver server skips references it has already cached.
+        const std::vector<std::string> refs =
+            resolverClient_
+                ? candidates
+                : uncachedReferences(acquireManager(Subsystem::kBackground), candidates);
+
+        prefetchStats_.scans.increment();
+        prefetchStats_.referencesFound.increment(candidates.size());
+        prefetchStats_.requested.increment(refs.size());
+
+        if (logger_->isSeverityLogged(Severity::kDebug))
+        {
+            logger_->debug(logging::concatAsStr("OpenAssetIOAsset: found ",
+                                                candidates.size(),
+                                                " reference(s) in ",
+                                                path,
+                                                ", prefetching ",
+                                                refs.size()));
+        }
+
+        pathPrefetcher_.request(refs);
+    }
+    catch (const std::exception& exc)
+    {
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(
+                "OpenAssetIOAsset: failed to prefetch references in ", path, ": ", exc.what()));
+        }
+    }
+}
+
+resolver_protocol::Strings OpenAssetIOAsset::callResolver(
+    const std::string_view method,
+    const resolver_protocol::Operation operation,
+    resolver_protocol::Strings args)
+{
+    auto values = callWithDeadline(method,
+                                   resolverCircuitBreaker_,
+                                   "resolver",
+                                   [] {},
+                                   [client = resolverClient_, operation, args = std::move(args)]
+                                   {
+                                       // The server may be in this process (e.g. in
+                                       // tests), where it may need the GIL to call a
+                                       // Python manager.
+                                       const ScopedGilRelease releaseGil;
+                                       return client->callOne(operation, args);
+                                   });
+
+    if (isResolverUnavailable_.load(std::memory_order_relaxed) &&
+        isResolverUnavailable_.exchange(false) && logger_->isSeverityLogged(Severity::kInfo))
+    {
+        logger_->info("OpenAssetIOAsset: resolver server is available again");
+    }
+    return values;
+}
+
+void OpenAssetIOAsset::warnResolverUnavailable(const std::system_error& exc)
+{
+    if (!isResolverUnavailable_.exchange(true) && logger_->isSeverityLogged(Severity::kWarning))
+    {
+        logger_->warning(logging::concatAsStr(
+            "OpenAssetIOAsset: resolver server unavailable, using local manager instead: ",
+            exc.what()));
+    }
+}
+
+std::shared_ptr<const OpenAssetIOAsset::ResolverServerInfo> OpenAssetIOAsset::resolverServerInfo(
+    const std::string_view method)
+{
+    if (auto serverInfo = std::atomic_load(&resolverServerInfo_))
+    {
+        return serverInfo;
+    }
+    // Concurrent first calls may each fetch, which is harmless.
+    const auto values =
+        callResolver(method, resolver_protocol::Operation::kGetManagerInfo, {});
+    auto serverInfo = std::make_shared<const ResolverServerInfo>(ResolverServerInfo{
+        std::stoull(values.at(0)),
+        values.size() > 1 ? std::optional{values[1]} : std::nullopt});
+    std::atomic_store(&resolverServerInfo_, serverInfo);
+    return serverInfo;
+}
+
+bool OpenAssetIOAsset::isEntityReferenceStringViaResolver(const std::string_view method,
+                                                          const std::string& str)
+{
+    const auto serverInfo = resolverServerInfo(method);
+    return assetIdFilter_.isEntityReferenceString(
+        str,
+        serverInfo->generation,
+        serverInfo->entityReferencePrefix,
+        [&](const std::string& candidate)
+        {
+            return callResolver(
+                       method, resolver_protocol::Operation::kIsEntityReference, {candidate})
+                       .at(0) == "1";
+        });
+}
+
+std::string OpenAssetIOAsset::resolvePathViaResolver(const std::string& assetId)
+{
+    const auto serverInfo = resolverServerInfo("resolveAsset");
+    if (!isEntityReferenceStringViaResolver("resolveAsset", assetId))
+    {
+        return assetId;
+    }
+    auto [ref, managerDrivenValue] = splitManagerDrivenValue(assetId);
+    if (!managerDrivenValue.empty())
+    {
+        // See resolveAsset.
+        return std::move(managerDrivenValue);
+    }
+
+    // The server caches paths itself, so paths are only cached here to
+    // fall back on if the server fails to respond in time.
+    const bool isPathCacheEnabled = isReadOnly_ || pathCacheHardTtl_.count() != 0;
+    try
+    {
+        std::string path =
+            callResolver("resolveAsset", resolver_protocol::Operation::kResolvePath, {assetId})
+                .at(0);
+        if (isPathCacheEnabled)
+        {
+            pathCache_.put(ref,
+                           serverInfo->generation,
+                           CachedPath{pathInterner_.intern(path),
+                                      std::chrono::steady_clock::now(),
+                                      isReadOnly_ ? Mutability::kImmutable : Mutability::kMutable,
+                                      {}},
+                           isReadOnly_ ? ReferenceCache<CachedPath>::kNeverExpires
+                                       : std::chrono::steady_clock::duration{pathCacheHardTtl_});
+        }
+        return path;
+    }
+    catch (const DeadlineExceededError& exc)
+    {
+        auto lastKnownGood = isPathCacheEnabled
+                                 ? pathCache_.getIgnoringExpiry(ref, serverInfo->generation)
+                                 : std::nullopt;
+        if (!lastKnownGood)
+        {
+            throw;
+        }
+        callStats_.lastKnownGoodFallbacks.increment();
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(exc.what(),
+                                                  ". Using last known path for ",
+                                                  ref,
+                                                  ": ",
+                                                  lastKnownGood->path.str()));
+        }
+        return lastKnownGood->path.str();
+    }
+}
+
+std::optional<std::string> OpenAssetIOAsset::entityReferencePrefix()
+{
+    if (resolverClient_)
+    {
+        try
+        {
+            return resolverServerInfo("containsAssetId")->entityReferencePrefix;
+        }
+        catch (const std::system_error& exc)
+        {
+            warnResolverUnavailable(exc);
+        }
+    }
+    return acquireManager().state->entityReferencePrefix();
+}
+
+std::vector<resolver_protocol::Result> OpenAssetIOAsset::handleResolverRequest(
+    const resolver_protocol::Request& request)
+{
+    using resolver_protocol::Operation;
+    using resolver_protocol::Result;
+    using resolver_protocol::Status;
+    using resolver_protocol::Strings;
+
+    if (request.operation == Operation::kResolvePath)
+    {
+        // Resolve uncached paths in a single batch, so that the
+        // per-item resolution below is served from the cache.
+        std::vector<std::string> assetIds;
+        assetIds.reserve(request.items.size());
+        for (const Strings& args : request.items)
+        {
+            if (!args.empty())
+            {
+                assetIds.push_back(args.front());
+            }
+        }
+        const auto refs = uncachedReferences(acquireManager(), assetIds);
+        if (refs.size() > 1)
+        {
+            Counter resolvedCount;
+            Counter failedCount;
+            resolvePathsIntoCache(refs, Subsystem::kLookup, resolvedCount, failedCount);
+        }
+    }
+
+    std::vector<Result> results;
+    results.reserve(request.items.size());
+    for (const Strings& args : request.items)
+    {
+        try
+        {
+            switch (request.operation)
+            {
+            case Operation::kResolvePath:
+            {
+                std::string path;
+                resolveAsset(args.at(0), path);
+                results.push_back({Status::kOk, {std::move(path)}});
+                break;
+            }
+            case Operation::kResolveVersion:
+            {
+                std::string version;
+                resolveAssetVersion(args.at(0), version, args.at(1));
+                results.push_back({Status::kOk, {std::move(version)}});
+                break;
+            }
+            case Operation::kGetFields:
+            {
+                StringMap fields;
+                getAssetFields(args.at(0), args.at(1) == "1", fields);
+                Strings values;
+                values.reserve(fields.size() * 2);
+                for (auto& [key, value] : fields)
+                {
+                    values.push_back(key);
+                    values.push_back(std::move(value));
+                }
+                results.push_back({Status::kOk, std::move(values)});
+                break;
+            }
+            case Operation::kGetManagerInfo:
+            {
+                const ManagerLease lease = acquireManager();
+                Strings values{std::to_string(lease.state->generation())};
+                if (const auto& prefix = lease.state->entityReferencePrefix())
+                {
+                    values.push_back(*prefix);
+                }
+                results.push_back({Status::kOk, std::move(values)});
+                break;
+            }
+            case Operation::kIsEntityReference:
+            {
+                const bool isReference =
+                    isEntityReferenceString(acquireManager(), "isAssetId", args.at(0));
+                results.push_back({Status::kOk, {isReference ? "1" : "0"}});
+                break;
+            }
+            }
+        }
+        catch (const std::exception& exc)
+        {
+            results.push_back({Status::kError, {exc.what()}});
+        }
+    }
+    return results;
+}
+
+std::vector<std::string> OpenAssetIOAsset::resolvePathRange(const std::string& assetId,
+                                                            const std::vector<int>& frames)
+{
+    std::string path;
+    resolveAsset(assetId, path);
+
+    if (!FnKat::DefaultFileSequencePlugin::isFileSequence(path))
+    {
+        return std::vector<std::string>(frames.size(), path);
+    }
+
+    // Expand the sequence ourselves, if we can do so identically to
+    // Katana, rather than having Katana re-parse it for every frame.
+    std::optional<FileSequenceTemplate> sequence = FileSequenceTemplate::parse(path);
+    if (sequence &&
+        sequence->path(1) != FnKat::DefaultFileSequencePlugin::resolveFileSequence(path, 1))
+    {
+        if (logger_->isSeverityLogged(Severity::kDebug))
+        {
+            logger_->debug(logging::concatAsStr(
+                "OpenAssetIOAsset::resolvePathRange: unrecognised file sequence ", path));
+        }
+        sequence.reset();
+    }
+
+    std::vector<std::string> paths;
+    paths.reserve(frames.size());
+    for (const int frame : frames)
+    {
+        // Leave negative frame numbering conventions to Katana.
+        paths.push_back(sequence && frame >= 0
+                            ? sequence->path(frame)
+                            : FnKat::DefaultFileSequencePlugin::resolveFileSequence(path, frame));
+    }
+    return paths;
+}
+
+void OpenAssetIOAsset::clearPathCache()
+{
+    pathCacheEpoch_.fetch_add(1, std::memory_order_acq_rel);
+    pathRefresher_.cancelPending();
+    pathPrefetcher_.cancelPending();
+    pathRevalidator_.cancelPending();
+    pathCache_.clear();
+    recentCalls_.clear();
+    readOnlyTraitsCache_.clear();
+    readOnlyQueryCache_.clear();
+}
+
+void OpenAssetIOAsset::clearMutableCacheEntries(const std::uint64_t generation)
+{
+    changeDetector_.cancelPending();
+
+    // Previous results of discarded entries, to compare against once
+    // re-resolved.
+    std::unordered_map<std::string, ChangeReport::Result> previousResults;
+    const std::size_t numRetained =
+        discardMutableCacheEntries(reportChangesOnReset_ ? &previousResults : nullptr);
+    pathCacheStats_.retainedOnReset.increment(numRetained);
+
+    if (reportChangesOnReset_)
+    {
+        std::vector<std::string> refs;
+        refs.reserve(previousResults.size());
+        for (const auto& [ref, result] : previousResults)
+        {
+            refs.push_back(ref);
+        }
+        changeReport_.begin(std::move(previousResults));
+        changeDetector_.request(refs);
+    }
+
+    if (logger_->isSeverityLogged(Severity::kDebug))
+    {
+        logger_->debug(logging::concatAsStr(
+            "OpenAssetIOAsset: retained ", numRetained, " cached path(s) on reset"));
+    }
+    if (numRetained == 0 || resetRevalidationSampleSize_ == 0)
+    {
+        return;
+    }
+
+    // Reservoir sample the retained references, so that a manager that
+    // has (incorrectly) changed the content of a specific version is
+    // noticed without re-resolving every retained path.
+    std::vector<std::string> sample;
+    sample.reserve(std::min(numRetained, resetRevalidationSampleSize_));
+    std::minstd_rand rng{static_cast<std::minstd_rand::result_type>(
+        std::chrono::steady_clock::now().time_since_epoch().count())};
+    std::size_t numSeen = 0;
+    const auto sampleReference = [&](const std::string& ref)
+    {
+        ++numSeen;
+        if (sample.size() < resetRevalidationSampleSize_)
+        {
+            sample.push_back(ref);
+            return;
+        }
+        const std::size_t idx = std::uniform_int_distribution<std::size_t>{0, numSeen - 1}(rng);
+        if (idx < sample.size())
+        {
+            sample[idx] = ref;
+        }
+    };
+    pathCache_.forEachReference(generation, sampleReference);
+    pathRevalidator_.request(sample);
+}
+
+std::size_t OpenAssetIOAsset::discardMutableCacheEntries(
+    std::unordered_map<std::string, ChangeReport::Result>* previousResults)
+{
+    pathCacheEpoch_.fetch_add(1, std::memory_order_acq_rel);
+    pathRefresher_.cancelPending();
+    pathPrefetcher_.cancelPending();
+    pathRevalidator_.cancelPending();
+
+    const std::size_t numRetained = pathCache_.eraseIf(
+        [&](const std::string& ref, const CachedPath& cached)
+        {
+            if (cached.mutability == Mutability::kImmutable)
+            {
+                return false;
+            }
+            if (previousResults)
+            {
+                previousResults->try_emplace(
+                    ref, ChangeReport::Result{cached.path.str(), cached.stableTag});
+            }
+            return true;
+        });
+    recentCalls_.clear();
+    readOnlyTraitsCache_.clear();
+    readOnlyQueryCache_.clear();
+    return numRetained;
+}
+
+void OpenAssetIOAsset::discardPublishedCacheEntries(const std::vector<std::string>& refs)
+{
+    {
+        const std::lock_guard lock{publishedRefsMutex_};
+        ++publishSequence_;
+        if (numBackgroundResolves_ > 0)
+        {
+            for (const std::string& ref : refs)
+            {
+                publishedRefs_[ref] = publishSequence_;
+            }
+        }
+    }
+
+    // The published references may previously have been missing, and
+    // the content of an explicit version may have been overwritten,
+    // e.g. by a new revision.
+    for (const std::string& ref : refs)
+    {
+        negativeCache_.erase(ref);
+        pathCache_.erase(ref);
+        recentCalls_.erase(ref);
+    }
+
+    if (logger_->isSeverityLogged(Severity::kDebug))
+    {
+        logger_->debug(logging::concatAsStr(
+            "OpenAssetIOAsset: discarded cached data of ", refs.size(), " published reference(s)"));
+    }
+}
+
+void OpenAssetIOAsset::detectChanges(const std::vector<std::string>& refs)
+{
+    using openassetio::trait::TraitsDataPtr;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+    using openassetio_mediacreation::traits::lifecycle::VersionTrait;
+
+    bool isCompleted = false;
+    try
+    {
+        const BackgroundResolveScope resolveScope{this};
+        const std::uint64_t epoch = pathCacheEpoch_.load(std::memory_order_acquire);
+        const ManagerLease lease = acquireManager(Subsystem::kBackground);
+        const auto& manager = lease.manager();
+
+        openassetio::EntityReferences entityReferences;
+        entityReferences.reserve(refs.size());
+        for (const std::string& ref : refs)
+        {
+            entityReferences.push_back(manager->createEntityReference(ref));
+        }
+
+        const auto results = resolveBatch(lease,
+                                          "detectChanges",
+                                          entityReferences,
+                                          {LocatableContentTrait::kId, VersionTrait::kId});
+        for (std::size_t idx = 0; idx < results.size(); ++idx)
+        {
+            const auto* traitsData = std::get_if<TraitsDataPtr>(&results[idx]);
+            const auto url =
+                traitsData ? LocatableContentTrait(*traitsData).getLocation() : std::nullopt;
+            if (!url)
+            {
+                isCompleted |= changeReport_.recordUnresolvable(refs[idx]);
+                continue;
+            }
+            std::string path = urlPathConverter_.pathFromUrl(*url);
+            // The re-resolved path is as good as any Katana would
+            // otherwise request after the reset.
+            if (pathCacheEpoch_.load(std::memory_order_acquire) == epoch &&
+                !resolveScope.isPublished(refs[idx]))
+            {
+                cachePath(lease, refs[idx], path, *traitsData);
+            }
+            isCompleted |= changeReport_.record(
+                refs[idx],
+                {std::move(path), VersionTrait{*traitsData}.getStableTag().value_or("")});
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        // The report remains incomplete.
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(
+                "OpenAssetIOAsset: failed to check references for changes: ", exc.what()));
+        }
+        return;
+    }
+
+    if (isCompleted && logger_->isSeverityLogged(Severity::kInfo))
+    {
+        logger_->info(logging::concatAsStr("OpenAssetIOAsset: ",
+                                           changeReport_.changes().size(),
+                                           " of ",
+                                           changeReport_.numChecked(),
+                                           " reference(s) resolve differently since the reset"));
+    }
+}
+
+void OpenAssetIOAsset::revalidatePaths(const std::vector<std::string>& refs)
+{
+    using openassetio::errors::BatchElementError;
+    using openassetio::trait::TraitsDataPtr;
+    using openassetio_mediacreation::traits::content::LocatableContentTrait;
+
+    if (logger_->isSeverityLogged(Severity::kDebug))
+    {
+        logger_->debug(logging::concatAsStr(
+            "OpenAssetIOAsset: revalidating ", refs.size(), " cached path(s)"));
+    }
+
+    try
+    {
+        const std::uint64_t epoch = pathCacheEpoch_.load(std::memory_order_acquire);
+        const ManagerLease lease = acquireManager(Subsystem::kBackground);
+        const auto& manager = lease.manager();
+
+        openassetio::EntityReferences entityReferences;
+        entityReferences.reserve(refs.size());
+        for (const std::string& ref : refs)
+        {
+            entityReferences.push_back(manager->createEntityReference(ref));
+        }
+
+        // Don't discard paths cached since a subsequent reset.
+        const auto discard = [&](const std::size_t idx)
+        {
+            if (pathCacheEpoch_.load(std::memory_order_acquire) == epoch)
+            {
+                pathCache_.erase(refs[idx]);
+            }
+        };
+
+        std::size_t numMismatches = 0;
+        std::string firstMismatch;
+
+        const auto results =
+            resolveBatch(lease, "revalidatePaths", entityReferences, {LocatableContentTrait::kId});
+        for (std::size_t idx = 0; idx < results.size(); ++idx)
+        {
+            if (const auto* error = std::get_if<BatchElementError>(&results[idx]))
+            {
+                // Transient errors, e.g. a brief outage, say nothing of
+                // whether the path has changed, so the path is kept.
+                // Otherwise, the reference no longer resolves, so the
+                // error is surfaced by resolving synchronously.
+                if (isNegativelyCacheable(*error))
+                {
+                    discard(idx);
+                }
+                continue;
+            }
+            const auto url =
+                LocatableContentTrait(std::get<TraitsDataPtr>(results[idx])).getLocation();
+            const auto cachedPath = pathCache_.visit(refs[idx],
+                                                     lease.state->generation(),
+                                                     [](const CachedPath& cached)
+                                                     { return cached.path.str(); });
+            // An entry evicted since being sampled has nothing to
+            // compare against.
+            if (!cachedPath)
+            {
+                continue;
+            }
+            if (!url)
+            {
+                discard(idx);
+                continue;
+            }
+            if (urlPathConverter_.pathFromUrl(*url) != *cachedPath)
+            {
+                if (numMismatches++ == 0)
+                {
+                    firstMismatch = refs[idx];
+                }
+                discard(idx);
+                continue;
+            }
+            pathCacheStats_.revalidations.increment();
+        }
+
+        if (numMismatches == 0)
+        {
+            return;
+        }
+        pathCacheStats_.revalidationMismatches.increment(numMismatches);
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr("OpenAssetIOAsset: ",
+                                                  numMismatches,
+                                                  " path(s) retained on reset have changed, "
+                                                  "including '",
+                                                  firstMismatch,
+                                                  "'. Discarding them."));
+        }
+    }
+    catch (const std::exception& exc)
+    {
+        // Retained paths remain in use, as they would have had the
+        // revalidation not been attempted.
+        if (logger_->isSeverityLogged(Severity::kWarning))
+        {
+            logger_->warning(logging::concatAsStr(
+                "OpenAssetIOAsset: failed to revalidate retained paths: ", exc.what()));
+        }
+    }
 }
 
 // --- Register plugin ------------------------
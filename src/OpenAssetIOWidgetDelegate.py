@@ -124,10 +124,12 @@ class UIDelegateService:
         self.__ui_delegate: UIDelegate = NotImplemented  # Sentinel for lazy-loading.
         self.__manager: Manager | None = None
         self.__context: Context | None = None
+        self.__manager_state_id: int | None = None
 
     def reset_manager(self):
         self.__manager = None
         self.__context = None
+        self.__manager_state_id = None
 
     def ui_delegate(self):
         if self.__ui_delegate is not NotImplemented:
@@ -175,13 +177,23 @@ class UIDelegateService:
         return self.manager_and_context()[1]
 
     def manager_and_context(self):
-        if self.__manager is not None and self.__context is not None:
-            return self.__manager, self.__context
-
         assetapi_plugin = AssetAPI.GetAssetPlugin(plugin_id)
         if assetapi_plugin is None:
             return None, None
 
+        # The plugin replaces its manager if re-initialized with
+        # different settings, so check ours is still current.
+        if (
+            self.__manager is not None
+            and self.__context is not None
+            and assetapi_plugin.runAssetPluginCommand(
+                "",
+                "isManagerStateCurrent",
+                {"stateId": str(self.__manager_state_id)},
+            )
+        ):
+            return self.__manager, self.__context
+
         result = {}
         assetapi_plugin.runAssetPluginCommand(
             "",
@@ -191,6 +203,7 @@ class UIDelegateService:
         )
         self.__manager = result["manager"]
         self.__context = result["context"]
+        self.__manager_state_id = result["stateId"]
 
         return self.__manager, self.__context
 
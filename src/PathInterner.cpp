@@ -0,0 +1,142 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "PathInterner.hpp"
+
+#include <algorithm>
+
+namespace
+{
+#ifdef _WIN32
+constexpr std::string_view kSeparators = "/\\";
+#else
+constexpr std::string_view kSeparators = "/";
+#endif
+// Approximate overhead of each directory beyond its own size: the
+// std::shared_ptr control block, and the map node and bucket.
+constexpr std::size_t kDirectoryOverhead = 4 * sizeof(void*) + 5 * sizeof(void*);
+}  // namespace
+
+std::size_t InternedPath::size() const
+{
+    return (directory_ ? directory_->length : 0) + leaf_.size();
+}
+
+void InternedPath::copyTo(std::string& out) const
+{
+    // Fill back to front, since each directory knows only its parent.
+    out.resize(size());
+    char* const begin = out.data();
+    std::copy(leaf_.begin(), leaf_.end(), begin + out.size() - leaf_.size());
+    for (const Directory* directory = directory_.get(); directory != nullptr;
+         directory = directory->parent.get())
+    {
+        std::copy(directory->component.begin(),
+                  directory->component.end(),
+                  begin + directory->length - directory->component.size());
+    }
+}
+
+std::string InternedPath::str() const
+{
+    std::string path;
+    copyTo(path);
+    return path;
+}
+
+PathInterner::PathInterner(CacheMemoryBudget* budget) : budget_{budget} {}
+
+PathInterner::~PathInterner()
+{
+    if (budget_)
+    {
+        budget_->release(bytes_);
+    }
+}
+
+InternedPath PathInterner::intern(const std::string_view path)
+{
+    std::shared_ptr<const Directory> directory;
+    std::size_t componentBegin = 0;
+    {
+        const std::lock_guard lock{mutex_};
+        for (std::size_t sepPos = path.find_first_of(kSeparators);
+             sepPos != std::string_view::npos;
+             sepPos = path.find_first_of(kSeparators, componentBegin))
+        {
+            directory = internDirectory(std::move(directory),
+                                        path.substr(componentBegin, sepPos + 1 - componentBegin));
+            componentBegin = sepPos + 1;
+        }
+    }
+    return InternedPath{std::move(directory), std::string{path.substr(componentBegin)}};
+}
+
+std::size_t PathInterner::size() const
+{
+    const std::lock_guard lock{mutex_};
+    return directories_.size();
+}
+
+std::size_t PathInterner::memoryUsage() const
+{
+    const std::lock_guard lock{mutex_};
+    return bytes_;
+}
+
+std::shared_ptr<const PathInterner::Directory> PathInterner::internDirectory(
+    std::shared_ptr<const Directory> parent, const std::string_view component)
+{
+    if (const auto slotIt = directories_.find(Key{parent.get(), component});
+        slotIt != directories_.end())
+    {
+        if (auto directory = slotIt->second.weak.lock())
+        {
+            return directory;
+        }
+        // Directory is being freed on another thread, which is waiting
+        // to remove it, so replace it.
+        directories_.erase(slotIt);
+    }
+
+    const std::size_t length = (parent ? parent->length : 0) + component.size();
+    std::shared_ptr<const Directory> directory{
+        new Directory{std::move(parent), std::string{component}, length},
+        [this](const Directory* toRelease) { release(toRelease); }};
+
+    const std::size_t bytes = directoryBytes(*directory);
+    bytes_ += bytes;
+    if (budget_)
+    {
+        budget_->charge(bytes);
+    }
+    directories_.emplace(Key{directory->parent.get(), directory->component},
+                         Slot{directory.get(), directory});
+    return directory;
+}
+
+void PathInterner::release(const Directory* directory)
+{
+    {
+        const std::lock_guard lock{mutex_};
+        const auto slotIt = directories_.find(Key{directory->parent.get(), directory->component});
+        if (slotIt != directories_.end() && slotIt->second.directory == directory)
+        {
+            directories_.erase(slotIt);
+        }
+        const std::size_t bytes = directoryBytes(*directory);
+        bytes_ -= bytes;
+        if (budget_)
+        {
+            budget_->release(bytes);
+        }
+    }
+    // Outside the lock, since this may release the parent directory.
+    delete directory;  // NOLINT(*-owning-memory)
+}
+
+std::size_t PathInterner::directoryBytes(const Directory& directory)
+{
+    return sizeof(Directory) + heapBytes(directory.component) + sizeof(Key) + sizeof(Slot) +
+           kDirectoryOverhead;
+}
@@ -0,0 +1,148 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "CacheMemoryBudget.hpp"
+
+class PathInterner;
+
+/**
+ * File path whose directories are stored once, and shared with all
+ * other paths interned by the same PathInterner.
+ *
+ * Directories form a trie of path components, each referencing its
+ * parent directory, such that paths that differ only in their final
+ * few components (e.g. show/seq/shot/department/...) share storage for
+ * the rest.
+ *
+ * Instances are immutable, so may be read concurrently without
+ * locking.
+ */
+class InternedPath
+{
+public:
+    InternedPath() = default;
+
+    /// Length of the path.
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * Write the path to a buffer, replacing its contents, with a single
+     * copy of each component.
+     */
+    void copyTo(std::string& out) const;
+
+    [[nodiscard]] std::string str() const;
+
+    /// Bytes owned by this path alone, i.e. excluding directories.
+    [[nodiscard]] std::size_t memoryUsage() const { return heapBytes(leaf_); }
+
+private:
+    friend class PathInterner;
+
+    struct Directory
+    {
+        std::shared_ptr<const Directory> parent;
+        /// Name of the directory, including its trailing separator.
+        std::string component;
+        /// Length of the path up to and including this directory.
+        std::size_t length;
+    };
+
+    InternedPath(std::shared_ptr<const Directory> directory, std::string leaf)
+        : directory_{std::move(directory)}, leaf_{std::move(leaf)}
+    {
+    }
+
+    std::shared_ptr<const Directory> directory_;
+    /// Final component of the path, e.g. the file name.
+    std::string leaf_;
+};
+
+/**
+ * Creates InternedPaths, de-duplicating their directories.
+ *
+ * Directories are freed once no longer referenced by any path. The
+ * interner must therefore outlive all paths it creates.
+ *
+ * Interning is serialised, but reading interned paths is not.
+ */
+class PathInterner
+{
+public:
+    /**
+     * @param budget Budget to account the memory used by directories
+     * against, if any.
+     */
+    explicit PathInterner(CacheMemoryBudget* budget = nullptr);
+
+    ~PathInterner();
+
+    PathInterner(const PathInterner&) = delete;
+    PathInterner& operator=(const PathInterner&) = delete;
+    PathInterner(PathInterner&&) = delete;
+    PathInterner& operator=(PathInterner&&) = delete;
+
+    [[nodiscard]] InternedPath intern(std::string_view path);
+
+    /// Number of distinct directories currently referenced.
+    [[nodiscard]] std::size_t size() const;
+
+    /// Bytes used by directories currently referenced.
+    [[nodiscard]] std::size_t memoryUsage() const;
+
+private:
+    using Directory = InternedPath::Directory;
+
+    struct Key
+    {
+        const Directory* parent;
+        /// View of the Directory's component.
+        std::string_view component;
+
+        bool operator==(const Key& other) const
+        {
+            return parent == other.parent && component == other.component;
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            return std::hash<std::string_view>{}(key.component) ^
+                   (std::hash<const Directory*>{}(key.parent) * 31);
+        }
+    };
+
+    struct Slot
+    {
+        /// Identity of the directory, valid until erased.
+        const Directory* directory;
+        std::weak_ptr<const Directory> weak;
+    };
+
+    /// Must be called with mutex_ held.
+    std::shared_ptr<const Directory> internDirectory(std::shared_ptr<const Directory> parent,
+                                                     std::string_view component);
+
+    /// Deleter of Directory instances.
+    void release(const Directory* directory);
+
+    static std::size_t directoryBytes(const Directory& directory);
+
+    CacheMemoryBudget* const budget_;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, Slot, KeyHash> directories_;
+    std::size_t bytes_{0};
+};
@@ -45,6 +45,8 @@
 #include <katana_openassetio/traits/timeDomain/FCurveTrait.hpp>
 #include <katana_openassetio/traits/twoDimensional/PresetResolutionTrait.hpp>
 
+#include "DirectoryScanCache.hpp"
+#include "PublishTiming.hpp"
 #include "constants.hpp"
 
 PublishStrategy::PublishStrategy(FileUrlPathConverterPtr fileUrlPathConverter)
@@ -565,7 +567,12 @@ private:
  */
 struct ImageAssetPublisher final : MediaCreationPublishStrategy<BitmapImageResourceSpecification>
 {
-    using MediaCreationPublishStrategy::MediaCreationPublishStrategy;
+    ImageAssetPublisher(FileUrlPathConverterPtr fileUrlPathConverter,
+                        DirectoryScanCache* directoryScanCache)
+        : MediaCreationPublishStrategy{std::move(fileUrlPathConverter)},
+          directoryScanCache_{directoryScanCache}
+    {
+    }
 
     [[nodiscard]] TraitsDataPtr prePublishTraitData(
         // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
@@ -597,8 +604,14 @@ struct ImageAssetPublisher final : MediaCreationPublishStrategy<BitmapImageResou
             managerDrivenValueIter != fields.end())
         {
             // Extract the frame range by globbing the path.
-            if (const auto maybeFrameRange =
-                    findFrameRangeFromSequenceOnDisk(managerDrivenValueIter->second))
+            const auto maybeFrameRange = [&]
+            {
+                const PublishPhaseScope scanPhase{PublishPhaseTimings::current(),
+                                                  PublishPhase::kFrameRangeScan};
+                return findFrameRangeFromSequenceOnDisk(managerDrivenValueIter->second,
+                                                        *directoryScanCache_);
+            }();
+            if (maybeFrameRange)
             {
                 FrameRangedTrait frameRangedTrait{traitsData};
                 frameRangedTrait.setStartFrame(maybeFrameRange->first);
@@ -612,6 +625,8 @@ struct ImageAssetPublisher final : MediaCreationPublishStrategy<BitmapImageResou
     }
 
 private:
+    DirectoryScanCache* directoryScanCache_;
+
     static inline const FnKat::Asset::StringMap kExtToMimeMap{
         {"exr", "image/x-exr"},                                    // From xdg/shared-mime-info
         {"deepexr", "image/x-exr"},                                // Assume same as .exr
@@ -674,12 +689,14 @@ private:
      *
      * @param fileSequence Path to a frame with a placeholder token in
      * place of the frame number.
+     * @param directoryScanCache Cache of directory listings, which may
+     * be updated whilst frames are still being written.
      *
      * @return A pair of min and max frame numbers, or std::nullopt if
      * no sequence was found.
      */
     static std::optional<std::pair<int, int>> findFrameRangeFromSequenceOnDisk(
-        const std::string& fileSequence)
+        const std::string& fileSequence, DirectoryScanCache& directoryScanCache)
     {
         if (!FnKat::DefaultFileSequencePlugin::isFileSequence(fileSequence))
         {
@@ -706,19 +723,24 @@ private:
 
         // Loop over all files in the directory of the resolved path,
         // looking for frames.
-        std::filesystem::path const directory =
-            std::filesystem::path{prefixAndSuffix[0]}.parent_path();
-        for (const auto& file : std::filesystem::directory_iterator(directory))
-        {
-            const std::string filePath = file.path().string();
-
-            if (file.is_regular_file() && pystring::startswith(filePath, prefixAndSuffix[0]) &&
-                pystring::endswith(filePath, prefixAndSuffix[1]))
+        const std::filesystem::path prefixPath{prefixAndSuffix[0]};
+        const std::filesystem::path directory = prefixPath.parent_path();
+        const std::string fileNamePrefix = prefixPath.filename().string();
+        directoryScanCache.forEachFile(
+            directory,
+            [&](const std::string_view fileName)
             {
-                const std::string_view frameStr = pystring::slice_view(
-                    filePath,
-                    static_cast<int>(prefixAndSuffix[0].size()),
-                    static_cast<int>(filePath.size() - prefixAndSuffix[1].size()));
+                if (fileName.size() < fileNamePrefix.size() + prefixAndSuffix[1].size() ||
+                    fileName.substr(0, fileNamePrefix.size()) != fileNamePrefix ||
+                    fileName.substr(fileName.size() - prefixAndSuffix[1].size()) !=
+                        prefixAndSuffix[1])
+                {
+                    return;
+                }
+                const std::string_view frameStr =
+                    fileName.substr(fileNamePrefix.size(),
+                                    fileName.size() - fileNamePrefix.size() -
+                                        prefixAndSuffix[1].size());
 
                 int frameNum = 0;
                 const char* const begin = frameStr.data();
@@ -732,8 +754,7 @@ private:
                     minFrame = std::min(minFrame, frameNum);
                     maxFrame = std::max(maxFrame, frameNum);
                 }
-            }
-        }
+            });
 
         if (minFrame > maxFrame)
         {
@@ -745,7 +766,8 @@ private:
 };
 }  // anonymous namespace
 
-PublishStrategies::PublishStrategies(const FileUrlPathConverterPtr& fileUrlPathConverter)
+PublishStrategies::PublishStrategies(const FileUrlPathConverterPtr& fileUrlPathConverter,
+                                     DirectoryScanCache* directoryScanCache)
 {
     strategies_[kFnAssetTypeKatanaScene] =
         std::make_unique<KatanaSceneAssetPublisher>(fileUrlPathConverter);
@@ -753,7 +775,8 @@ PublishStrategies::PublishStrategies(const FileUrlPathConverterPtr& fileUrlPathC
     strategies_[kFnAssetTypeMacro] = std::make_unique<MacroPublisher>(fileUrlPathConverter);
     strategies_[kFnAssetTypeLiveGroup] =
         std::make_unique<LiveGroupAssetPublisher>(fileUrlPathConverter);
-    strategies_[kFnAssetTypeImage] = std::make_unique<ImageAssetPublisher>(fileUrlPathConverter);
+    strategies_[kFnAssetTypeImage] =
+        std::make_unique<ImageAssetPublisher>(fileUrlPathConverter, directoryScanCache);
     strategies_[kFnAssetTypeLookFile] =
         std::make_unique<LookfileAssetPublisher>(fileUrlPathConverter);
     strategies_[kFnAssetTypeLookFileMgrSettings] =
@@ -13,6 +13,8 @@
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/utils/path.hpp>
 
+class DirectoryScanCache;
+
 class PublishStrategy
 {
 public:
@@ -41,7 +43,15 @@ class PublishStrategies
 public:
     using FileUrlPathConverterPtr = std::shared_ptr<openassetio::utils::FileUrlPathConverter>;
 
-    explicit PublishStrategies(const FileUrlPathConverterPtr& fileUrlPathConverter);
+    /**
+     * @param fileUrlPathConverter Converter for URLs of published
+     * content.
+     * @param directoryScanCache Cache of directory listings, e.g. for
+     * finding the frames of rendered image sequences, which must
+     * outlive this instance.
+     */
+    PublishStrategies(const FileUrlPathConverterPtr& fileUrlPathConverter,
+                      DirectoryScanCache* directoryScanCache);
 
     const PublishStrategy& strategyForAssetType(const std::string& assetType) const;
 
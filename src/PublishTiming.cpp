@@ -0,0 +1,91 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "PublishTiming.hpp"
+
+namespace
+{
+std::size_t phaseIdx(const PublishPhase phase)
+{
+    return static_cast<std::size_t>(phase);
+}
+
+thread_local PublishPhaseTimings* currentTimings = nullptr;  // NOLINT(*-non-const-global-variables)
+}  // namespace
+
+std::string_view publishPhaseName(const PublishPhase phase)
+{
+    switch (phase)
+    {
+    case PublishPhase::kManagementPolicy:
+        return "managementPolicy";
+    case PublishPhase::kTraitConstruction:
+        return "traitConstruction";
+    case PublishPhase::kPreflight:
+        return "preflight";
+    case PublishPhase::kVersionProbe:
+        return "versionProbe";
+    case PublishPhase::kManagerDrivenResolve:
+        return "managerDrivenResolve";
+    case PublishPhase::kFrameRangeScan:
+        return "frameRangeScan";
+    case PublishPhase::kRegister:
+        return "register";
+    }
+
+    // Should never happen (check compiler warnings for unhandled `switch` case).
+    return "unknown";
+}
+
+PublishPhaseTimings::PublishPhaseTimings() : previous_{currentTimings}
+{
+    currentTimings = this;
+}
+
+PublishPhaseTimings::~PublishPhaseTimings()
+{
+    currentTimings = previous_;
+}
+
+PublishPhaseTimings* PublishPhaseTimings::current()
+{
+    return currentTimings;
+}
+
+bool PublishPhaseTimings::wasTimed(const PublishPhase phase) const
+{
+    return wasTimed_[phaseIdx(phase)];
+}
+
+PublishPhaseTimings::Duration PublishPhaseTimings::duration(const PublishPhase phase) const
+{
+    return durations_[phaseIdx(phase)];
+}
+
+PublishPhaseScope::PublishPhaseScope(PublishPhaseTimings* timings, const PublishPhase phase)
+    : timings_{timings}, phase_{phase}
+{
+    if (timings_ == nullptr)
+    {
+        return;
+    }
+    outer_ = timings_->activeScope_;
+    timings_->activeScope_ = this;
+    start_ = std::chrono::steady_clock::now();
+}
+
+PublishPhaseScope::~PublishPhaseScope()
+{
+    if (timings_ == nullptr)
+    {
+        return;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    timings_->durations_[phaseIdx(phase_)] += elapsed;
+    timings_->wasTimed_[phaseIdx(phase_)] = true;
+    if (outer_ != nullptr)
+    {
+        timings_->durations_[phaseIdx(outer_->phase_)] -= elapsed;
+    }
+    timings_->activeScope_ = outer_;
+}
@@ -0,0 +1,106 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Steps of publishing an asset, via createAssetAndPath and
+ * postCreateAsset, that are timed separately.
+ */
+enum class PublishPhase : std::size_t
+{
+    /// Querying whether the manager can publish the asset's traits.
+    kManagementPolicy,
+    /// Building the traits to publish, excluding any frame range scan.
+    kTraitConstruction,
+    kPreflight,
+    /// Finding the explicit version to write to, for "versionUp=False".
+    kVersionProbe,
+    /// Resolving the path to write to.
+    kManagerDrivenResolve,
+    /// Scanning the disk for the frames of a published image sequence.
+    kFrameRangeScan,
+    kRegister,
+};
+
+constexpr std::size_t kNumPublishPhases = static_cast<std::size_t>(PublishPhase::kRegister) + 1;
+
+/**
+ * Name of a phase, e.g. for reporting.
+ */
+std::string_view publishPhaseName(PublishPhase phase);
+
+class PublishPhaseScope;
+
+/**
+ * Durations of the phases of a single publishing call.
+ *
+ * Whilst an instance exists, it is the current instance of the
+ * constructing thread, so that phases can be timed by code that has no
+ * access to it, e.g. publish strategies, see current().
+ *
+ * Phases are exclusive: the time spent in a phase timed whilst another
+ * is being timed, e.g. a frame range scan during trait construction, is
+ * deducted from the outer phase.
+ */
+class PublishPhaseTimings
+{
+public:
+    using Duration = std::chrono::steady_clock::duration;
+
+    PublishPhaseTimings();
+    ~PublishPhaseTimings();
+
+    PublishPhaseTimings(const PublishPhaseTimings&) = delete;
+    PublishPhaseTimings& operator=(const PublishPhaseTimings&) = delete;
+    PublishPhaseTimings(PublishPhaseTimings&&) = delete;
+    PublishPhaseTimings& operator=(PublishPhaseTimings&&) = delete;
+
+    /// The innermost instance on the calling thread, if any.
+    static PublishPhaseTimings* current();
+
+    /// Whether the phase was timed at all.
+    [[nodiscard]] bool wasTimed(PublishPhase phase) const;
+
+    [[nodiscard]] Duration duration(PublishPhase phase) const;
+
+private:
+    friend class PublishPhaseScope;
+
+    PublishPhaseTimings* previous_;
+    std::array<Duration, kNumPublishPhases> durations_{};
+    std::array<bool, kNumPublishPhases> wasTimed_{};
+    /// Phase being timed, if any, see PublishPhaseScope.
+    PublishPhaseScope* activeScope_{nullptr};
+};
+
+/**
+ * Times a publish phase from construction to destruction.
+ */
+class PublishPhaseScope
+{
+public:
+    /**
+     * @param timings Timings to add to, e.g. PublishPhaseTimings::current().
+     * If null, nothing is timed.
+     * @param phase Phase to time.
+     */
+    PublishPhaseScope(PublishPhaseTimings* timings, PublishPhase phase);
+    ~PublishPhaseScope();
+
+    PublishPhaseScope(const PublishPhaseScope&) = delete;
+    PublishPhaseScope& operator=(const PublishPhaseScope&) = delete;
+    PublishPhaseScope(PublishPhaseScope&&) = delete;
+    PublishPhaseScope& operator=(PublishPhaseScope&&) = delete;
+
+private:
+    PublishPhaseTimings* timings_;
+    PublishPhase phase_;
+    PublishPhaseScope* outer_{nullptr};
+    std::chrono::steady_clock::time_point start_;
+};
@@ -0,0 +1,480 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "CacheMemoryBudget.hpp"
+
+/**
+ * Whether the data associated with an entity reference may change over
+ * time.
+ *
+ * References to a specific version of an entity are immutable, and so
+ * data derived from them can be cached indefinitely. References to
+ * meta-versions (e.g. "latest") are mutable, and must be periodically
+ * refreshed.
+ */
+enum class Mutability
+{
+    kImmutable,
+    kMutable
+};
+
+/**
+ * Thread-safe cache of values keyed by entity reference string.
+ *
+ * Entries expire after a per-entry time-to-live, unless added with
+ * `kNeverExpires`. Expired entries are never returned, and are purged
+ * lazily as new entries are added.
+ *
+ * Entries are also stamped with the generation of the manager
+ * configuration they were derived from (see ManagerState), and are only
+ * returned to callers querying with the same generation.
+ *
+ * The key space is split into independently locked shards, so that
+ * concurrent lookups on different references rarely contend.
+ *
+ * If given a CacheMemoryBudget, the memory used by each entry is
+ * accounted against it, and entries may be evicted, least recently
+ * used first (approximately), to keep within the budget.
+ *
+ * @tparam Value Type of cached value. Must be copyable, and provide a
+ * `memoryUsage()` method returning the bytes it owns beyond its own
+ * size.
+ */
+template <class Value>
+class ReferenceCache final : public CacheMemoryBudget::Member
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Generation = std::uint64_t;
+
+    explicit ReferenceCache(CacheMemoryBudget* budget = nullptr) : budget_{budget}
+    {
+        if (budget_)
+        {
+            budget_->add(this);
+        }
+    }
+
+    ~ReferenceCache() override
+    {
+        if (budget_)
+        {
+            budget_->remove(this);
+            budget_->release(memoryUsage());
+        }
+    }
+
+    ReferenceCache(const ReferenceCache&) = delete;
+    ReferenceCache& operator=(const ReferenceCache&) = delete;
+    ReferenceCache(ReferenceCache&&) = delete;
+    ReferenceCache& operator=(ReferenceCache&&) = delete;
+
+    /// Time-to-live of entries that should be kept until explicitly
+    /// erased or cleared, e.g. those derived from immutable references.
+    static constexpr Clock::duration kNeverExpires = Clock::duration::max();
+
+    /**
+     * Get the value cached for a reference, if present, unexpired and
+     * of the given generation.
+     */
+    [[nodiscard]] std::optional<Value> get(const std::string& ref,
+                                           const Generation generation) const
+    {
+        return visit(ref, generation, [](const Value& value) { return value; });
+    }
+
+    /**
+     * Call a function with the value cached for a reference, if
+     * present, unexpired and of the given generation, without copying
+     * the value.
+     *
+     * The function is called whilst holding a lock, so must not call
+     * back into the cache.
+     *
+     * @return Result of the function, if called.
+     */
+    template <class Fn>
+    [[nodiscard]] auto visit(const std::string& ref, const Generation generation, Fn&& fn) const
+        -> std::optional<std::invoke_result_t<Fn, const Value&>>
+    {
+        const Clock::time_point now = Clock::now();
+        const Shard& shard = shardFor(ref);
+        const std::shared_lock lock{shard.mutex};
+        const auto entryIt = shard.entries.find(ref);
+        if (entryIt == shard.entries.end() || entryIt->second.generation != generation ||
+            entryIt->second.expiry <= now)
+        {
+            return std::nullopt;
+        }
+        entryIt->second.lastAccess.store(now);
+        return std::forward<Fn>(fn)(entryIt->second.value);
+    }
+
+    /**
+     * Whether a value is cached for a reference, unexpired and of the
+     * given generation.
+     */
+    [[nodiscard]] bool contains(const std::string& ref, const Generation generation) const
+    {
+        const Shard& shard = shardFor(ref);
+        const std::shared_lock lock{shard.mutex};
+        const auto entryIt = shard.entries.find(ref);
+        return entryIt != shard.entries.end() && entryIt->second.generation == generation &&
+               entryIt->second.expiry > Clock::now();
+    }
+
+    /**
+     * Get the value cached for a reference, if present and of the given
+     * generation, even if it has expired but not yet been purged.
+     *
+     * Useful as a fallback when fresh data cannot be retrieved.
+     */
+    [[nodiscard]] std::optional<Value> getIgnoringExpiry(const std::string& ref,
+                                                         const Generation generation) const
+    {
+        const Shard& shard = shardFor(ref);
+        const std::shared_lock lock{shard.mutex};
+        const auto entryIt = shard.entries.find(ref);
+        if (entryIt == shard.entries.end() || entryIt->second.generation != generation)
+        {
+            return std::nullopt;
+        }
+        entryIt->second.lastAccess.store(Clock::now());
+        return entryIt->second.value;
+    }
+
+    /**
+     * Add or replace the value cached for a reference.
+     */
+    void put(const std::string& ref,
+             const Generation generation,
+             Value value,
+             const Clock::duration ttl)
+    {
+        const Clock::time_point now = Clock::now();
+        const std::size_t bytes = entryBytes(ref, value);
+        {
+            Shard& shard = shardFor(ref);
+            const std::unique_lock lock{shard.mutex};
+            if (shard.entries.size() >= shard.purgeThreshold)
+            {
+                purgeExpired(shard, now);
+            }
+            const Clock::time_point expiry =
+                ttl == kNeverExpires ? Clock::time_point::max() : now + ttl;
+            Entry entry{std::move(value), generation, expiry, bytes, AccessTime{now}};
+            if (const auto entryIt = shard.entries.find(ref); entryIt != shard.entries.end())
+            {
+                release(entryIt->second.bytes);
+                entryIt->second = std::move(entry);
+            }
+            else
+            {
+                shard.entries.emplace(ref, std::move(entry));
+            }
+            charge(bytes);
+        }
+        if (budget_)
+        {
+            budget_->reclaim();
+        }
+    }
+
+    void erase(const std::string& ref)
+    {
+        Shard& shard = shardFor(ref);
+        const std::unique_lock lock{shard.mutex};
+        if (const auto entryIt = shard.entries.find(ref); entryIt != shard.entries.end())
+        {
+            release(entryIt->second.bytes);
+            shard.entries.erase(entryIt);
+        }
+    }
+
+    /**
+     * Erase entries for which a predicate, called with the reference
+     * and value of each entry, returns true. Also erases any expired
+     * entries.
+     *
+     * The predicate is called whilst holding a lock, so must not call
+     * back into the cache.
+     *
+     * @return Number of entries retained.
+     */
+    template <class Pred>
+    std::size_t eraseIf(Pred&& pred)
+    {
+        const Clock::time_point now = Clock::now();
+        std::size_t numRetained = 0;
+        for (Shard& shard : shards_)
+        {
+            const std::unique_lock lock{shard.mutex};
+            for (auto entryIt = shard.entries.begin(); entryIt != shard.entries.end();)
+            {
+                if (entryIt->second.expiry <= now || pred(entryIt->first, entryIt->second.value))
+                {
+                    release(entryIt->second.bytes);
+                    entryIt = shard.entries.erase(entryIt);
+                }
+                else
+                {
+                    ++entryIt;
+                    ++numRetained;
+                }
+            }
+        }
+        return numRetained;
+    }
+
+    /**
+     * Call a function with the reference of each unexpired entry of the
+     * given generation.
+     *
+     * The function is called whilst holding a lock, so must not call
+     * back into the cache.
+     */
+    template <class Fn>
+    void forEachReference(const Generation generation, Fn&& fn) const
+    {
+        const Clock::time_point now = Clock::now();
+        for (const Shard& shard : shards_)
+        {
+            const std::shared_lock lock{shard.mutex};
+            for (const auto& [ref, entry] : shard.entries)
+            {
+                if (entry.generation == generation && entry.expiry > now)
+                {
+                    fn(ref);
+                }
+            }
+        }
+    }
+
+    void clear()
+    {
+        for (Shard& shard : shards_)
+        {
+            const std::unique_lock lock{shard.mutex};
+            for (const auto& [ref, entry] : shard.entries)
+            {
+                release(entry.bytes);
+            }
+            shard.entries.clear();
+            shard.purgeThreshold = kMinPurgeThreshold;
+        }
+    }
+
+    /// Number of entries, including any expired but not yet purged.
+    [[nodiscard]] std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+    /// Bytes used by entries, including any expired but not yet purged.
+    [[nodiscard]] std::size_t memoryUsage() const
+    {
+        return bytes_.load(std::memory_order_relaxed);
+    }
+
+    /// Number of entries evicted to stay within the memory budget.
+    [[nodiscard]] std::uint64_t evictions() const
+    {
+        return evictions_.load(std::memory_order_relaxed);
+    }
+
+    std::optional<CacheMemoryBudget::EvictionCandidate> sampleEvictionCandidate(
+        const std::size_t numSamples) override
+    {
+        const Clock::time_point now = Clock::now();
+        // Visit shards in turn (a "clock hand"), so that eviction is
+        // spread across the key space.
+        for (std::size_t attempt = 0; attempt < kNumShards; ++attempt)
+        {
+            const std::size_t hand = evictionHand_.fetch_add(1, std::memory_order_relaxed);
+            const Shard& shard = shards_[hand % kNumShards];
+            const std::shared_lock lock{shard.mutex, std::try_to_lock};
+            if (!lock.owns_lock() || shard.entries.empty())
+            {
+                continue;
+            }
+
+            // Sample consecutive buckets, starting from where the
+            // previous sample of this shard left off.
+            const std::size_t numBuckets = shard.entries.bucket_count();
+            std::size_t bucket = hand / kNumShards * numSamples % numBuckets;
+            std::optional<CacheMemoryBudget::EvictionCandidate> candidate;
+            std::size_t numSampled = 0;
+            for (std::size_t numVisited = 0; numVisited < numBuckets && numSampled < numSamples;
+                 ++numVisited, bucket = (bucket + 1) % numBuckets)
+            {
+                for (auto entryIt = shard.entries.begin(bucket);
+                     entryIt != shard.entries.end(bucket) && numSampled < numSamples;
+                     ++entryIt, ++numSampled)
+                {
+                    const Entry& entry = entryIt->second;
+                    const Clock::time_point lastAccess =
+                        entry.expiry <= now ? Clock::time_point::min() : entry.lastAccess.load();
+                    if (!candidate || lastAccess < candidate->lastAccess)
+                    {
+                        candidate =
+                            CacheMemoryBudget::EvictionCandidate{entryIt->first, lastAccess};
+                    }
+                }
+            }
+            return candidate;
+        }
+        return std::nullopt;
+    }
+
+    bool evict(const CacheMemoryBudget::EvictionCandidate& candidate) override
+    {
+        Shard& shard = shardFor(candidate.key);
+        const std::unique_lock lock{shard.mutex};
+        const auto entryIt = shard.entries.find(candidate.key);
+        if (entryIt == shard.entries.end() ||
+            (candidate.lastAccess != Clock::time_point::min() &&
+             entryIt->second.lastAccess.load() > candidate.lastAccess))
+        {
+            return false;
+        }
+        release(entryIt->second.bytes);
+        shard.entries.erase(entryIt);
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    /**
+     * Time of the most recent lookup of an entry, updated by concurrent
+     * readers.
+     */
+    class AccessTime
+    {
+    public:
+        AccessTime() = default;
+        explicit AccessTime(const Clock::time_point time) : rep_{time.time_since_epoch().count()} {}
+        AccessTime(const AccessTime& other) : rep_{other.rep_.load(std::memory_order_relaxed)} {}
+        AccessTime& operator=(const AccessTime& other)
+        {
+            rep_.store(other.rep_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+        AccessTime(AccessTime&& other) noexcept : AccessTime{other} {}
+        AccessTime& operator=(AccessTime&& other) noexcept { return *this = other; }
+        ~AccessTime() = default;
+
+        [[nodiscard]] Clock::time_point load() const
+        {
+            return Clock::time_point{Clock::duration{rep_.load(std::memory_order_relaxed)}};
+        }
+
+        void store(const Clock::time_point time) const
+        {
+            rep_.store(time.time_since_epoch().count(), std::memory_order_relaxed);
+        }
+
+    private:
+        mutable std::atomic<Clock::rep> rep_{0};
+    };
+
+    struct Entry
+    {
+        Value value;
+        Generation generation;
+        Clock::time_point expiry;
+        /// Memory used by the entry, including its key.
+        std::size_t bytes;
+        AccessTime lastAccess;
+    };
+
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        // Size at which to next sweep for expired entries. Doubles if
+        // a sweep fails to free enough, to keep insertion amortised
+        // O(1).
+        std::size_t purgeThreshold{kMinPurgeThreshold};
+    };
+
+    static constexpr std::size_t kNumShards = 16;
+    static constexpr std::size_t kMinPurgeThreshold = 64;
+
+    // Approximate per-entry overhead of std::unordered_map: the node's
+    // next pointer and cached hash, plus its bucket pointer.
+    static constexpr std::size_t kNodeOverhead = 3 * sizeof(void*);
+
+    static std::size_t entryBytes(const std::string& ref, const Value& value)
+    {
+        return sizeof(std::pair<const std::string, Entry>) + kNodeOverhead + heapBytes(ref) +
+               value.memoryUsage();
+    }
+
+    void purgeExpired(Shard& shard, const Clock::time_point now)
+    {
+        for (auto entryIt = shard.entries.begin(); entryIt != shard.entries.end();)
+        {
+            if (entryIt->second.expiry <= now)
+            {
+                release(entryIt->second.bytes);
+                entryIt = shard.entries.erase(entryIt);
+            }
+            else
+            {
+                ++entryIt;
+            }
+        }
+        shard.purgeThreshold = std::max(kMinPurgeThreshold, shard.entries.size() * 2);
+    }
+
+    void charge(const std::size_t bytes)
+    {
+        size_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        if (budget_)
+        {
+            budget_->charge(bytes);
+        }
+    }
+
+    void release(const std::size_t bytes)
+    {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+        if (budget_)
+        {
+            budget_->release(bytes);
+        }
+    }
+
+    Shard& shardFor(const std::string& ref)
+    {
+        return shards_[std::hash<std::string>{}(ref) % kNumShards];
+    }
+
+    const Shard& shardFor(const std::string& ref) const
+    {
+        return shards_[std::hash<std::string>{}(ref) % kNumShards];
+    }
+
+    CacheMemoryBudget* const budget_;
+    std::array<Shard, kNumShards> shards_;
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::size_t> bytes_{0};
+    std::atomic<std::size_t> evictionHand_{0};
+    std::atomic<std::uint64_t> evictions_{0};
+};
@@ -0,0 +1,182 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ReferenceScanner.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+/**
+ * Lookup table of characters that terminate a reference.
+ */
+constexpr std::array<bool, 256> kIsDelimiter = []
+{
+    std::array<bool, 256> isDelimiter{};
+    // Whitespace and other control characters.
+    for (std::size_t chr = 0; chr <= static_cast<unsigned char>(' '); ++chr)
+    {
+        isDelimiter[chr] = true;
+    }
+    for (const unsigned char chr : {'"', '\'', '<', '>', '\x7f'})
+    {
+        isDelimiter[chr] = true;
+    }
+    return isDelimiter;
+}();
+
+/**
+ * Decode the predefined XML character entities.
+ */
+std::string decodeXmlEntities(const std::string_view str)
+{
+    constexpr std::array<std::pair<std::string_view, char>, 5> kEntities{{{"&amp;", '&'},
+                                                                          {"&lt;", '<'},
+                                                                          {"&gt;", '>'},
+                                                                          {"&quot;", '"'},
+                                                                          {"&apos;", '\''}}};
+    std::string decoded;
+    decoded.reserve(str.size());
+    std::size_t pos = 0;
+    while (pos < str.size())
+    {
+        if (str[pos] == '&')
+        {
+            const auto* entityIt = std::find_if(kEntities.begin(),
+                                                kEntities.end(),
+                                                [&](const auto& entity)
+                                                { return str.substr(pos, entity.first.size()) ==
+                                                         entity.first; });
+            if (entityIt != kEntities.end())
+            {
+                decoded += entityIt->second;
+                pos += entityIt->first.size();
+                continue;
+            }
+        }
+        decoded += str[pos];
+        ++pos;
+    }
+    return decoded;
+}
+}  // namespace
+
+#ifndef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+{
+    const int fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0)
+    {
+        throw std::system_error{errno, std::generic_category(), "Failed to open " + path};
+    }
+
+    struct stat fileStat = {};
+    if (::fstat(fileDescriptor, &fileStat) != 0)
+    {
+        const int error = errno;
+        ::close(fileDescriptor);
+        throw std::system_error{error, std::generic_category(), "Failed to stat " + path};
+    }
+    size_ = static_cast<std::size_t>(fileStat.st_size);
+
+    if (size_ != 0)
+    {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED)  // NOLINT(*-cstyle-cast, *-int-to-ptr)
+        {
+            const int error = errno;
+            ::close(fileDescriptor);
+            throw std::system_error{error, std::generic_category(), "Failed to map " + path};
+        }
+        // Contents are read once, front to back.
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+    }
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fileDescriptor);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        // NOLINTNEXTLINE(*-const-cast)
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+{
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+    {
+        throw std::system_error{
+            std::make_error_code(std::errc::no_such_file_or_directory), "Failed to open " + path};
+    }
+    buffer_.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+#endif
+
+std::vector<std::string> findEntityReferences(const std::string_view text,
+                                              const std::vector<std::string>& prefixes)
+{
+    std::unordered_set<std::string_view> uniqueReferences;
+
+    for (const std::string& prefix : prefixes)
+    {
+        if (prefix.empty())
+        {
+            continue;
+        }
+        // std::string_view::find is typically implemented using memchr
+        // to locate candidates for the first character, which is
+        // vectorised by the C library.
+        std::size_t pos = text.find(prefix);
+        while (pos != std::string_view::npos)
+        {
+            std::size_t end = pos + prefix.size();
+            while (end < text.size() && !kIsDelimiter[static_cast<unsigned char>(text[end])])
+            {
+                ++end;
+            }
+            uniqueReferences.insert(text.substr(pos, end - pos));
+            pos = text.find(prefix, end);
+        }
+    }
+
+    std::vector<std::string> references;
+    references.reserve(uniqueReferences.size());
+    for (const std::string_view reference : uniqueReferences)
+    {
+        references.push_back(reference.find('&') == std::string_view::npos
+                                 ? std::string{reference}
+                                 : decodeXmlEntities(reference));
+    }
+    return references;
+}
@@ -0,0 +1,54 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Read-only view of a file's contents, memory-mapped where supported.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @throws std::system_error If the file cannot be read.
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    [[nodiscard]] std::string_view contents() const { return {data_, size_}; }
+
+private:
+    const char* data_{nullptr};
+    std::size_t size_{0};
+    /// Fallback storage, where memory mapping is not supported.
+    std::string buffer_;
+};
+
+/**
+ * Find all unique entity references in a body of text, e.g. a Katana
+ * project file.
+ *
+ * A reference is taken to start with one of the given prefixes, and
+ * extend up to the next whitespace, quote or XML tag delimiter. XML
+ * character entities within a reference are decoded.
+ *
+ * Candidate references are not validated, so should be checked with
+ * the manager before use.
+ *
+ * @param text Text to search.
+ * @param prefixes Entity reference prefixes to search for.
+ * @return Unique references.
+ */
+std::vector<std::string> findEntityReferences(std::string_view text,
+                                              const std::vector<std::string>& prefixes);
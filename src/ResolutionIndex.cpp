@@ -0,0 +1,471 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolutionIndex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
+
+namespace
+{
+using openassetio::trait::TraitSet;
+using openassetio::trait::TraitsData;
+using openassetio::trait::TraitsDataPtr;
+namespace property = openassetio::trait::property;
+
+constexpr std::array<char, 8> kMagic{'K', 'O', 'A', 'I', 'N', 'D', 'E', 'X'};
+constexpr std::uint32_t kFormatVersion = 1;
+// Written in native byte order, so readers can detect a mismatch.
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+
+struct StringRef
+{
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+struct Header
+{
+    std::array<char, 8> magic;
+    std::uint32_t formatVersion;
+    std::uint32_t byteOrderMark;
+    std::uint32_t numEntities;
+    std::uint32_t numTraits;
+    std::uint32_t numProperties;
+    std::uint32_t numVersions;
+    StringRef prefix;
+    std::uint64_t stringsSize;
+};
+
+struct EntityRecord
+{
+    StringRef reference;
+    std::uint32_t firstTrait;
+    std::uint32_t numTraits;
+    std::uint32_t firstVersion;
+    std::uint32_t numVersions;
+};
+
+struct TraitRecord
+{
+    StringRef id;
+    std::uint32_t firstProperty;
+    std::uint32_t numProperties;
+};
+
+enum class PropertyType : std::uint32_t
+{
+    kBool,
+    kInt,
+    kFloat,
+    kStr
+};
+
+struct PropertyRecord
+{
+    StringRef key;
+    PropertyType type;
+    std::uint32_t reserved;
+    /// Bool or Int value, Float bit pattern, or StringRef of a Str.
+    std::uint64_t value;
+};
+
+struct VersionRecord
+{
+    StringRef reference;
+};
+
+static_assert(sizeof(Header) == 48);
+static_assert(sizeof(EntityRecord) == 24);
+static_assert(sizeof(TraitRecord) == 16);
+static_assert(sizeof(PropertyRecord) == 24);
+static_assert(sizeof(VersionRecord) == 8);
+
+template <class Record>
+void writeRecords(std::ofstream& stream, const std::vector<Record>& records)
+{
+    static_assert(std::is_trivially_copyable_v<Record>);
+    // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+    stream.write(reinterpret_cast<const char*>(records.data()),
+                 static_cast<std::streamsize>(records.size() * sizeof(Record)));
+}
+
+std::uint32_t checkedSize(const std::size_t size, const char* what)
+{
+    if (size > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::runtime_error{std::string{"Too many "} + what + " for a resolution index"};
+    }
+    return static_cast<std::uint32_t>(size);
+}
+
+/**
+ * Pool of strings, each stored once.
+ */
+class StringPool
+{
+public:
+    StringRef add(const std::string_view str)
+    {
+        if (const auto refIt = refs_.find(std::string{str}); refIt != refs_.end())
+        {
+            return refIt->second;
+        }
+        const StringRef ref{checkedSize(data_.size(), "strings"),
+                            checkedSize(str.size(), "strings")};
+        data_.append(str);
+        checkedSize(data_.size(), "strings");
+        refs_.emplace(str, ref);
+        return ref;
+    }
+
+    [[nodiscard]] const std::string& data() const { return data_; }
+
+private:
+    std::string data_;
+    std::unordered_map<std::string, StringRef> refs_;
+};
+
+std::string temporaryPathFor(const std::string& path)
+{
+#ifndef _WIN32
+    const auto pid = getpid();
+#else
+    const auto pid = _getpid();
+#endif
+    return path + ".tmp" + std::to_string(pid);
+}
+
+[[noreturn]] void throwInvalid(const std::string& path, const std::string_view reason)
+{
+    throw std::runtime_error{"Invalid resolution index '" + path + "': " + std::string{reason}};
+}
+}  // namespace
+
+void writeResolutionIndex(const std::string& path,
+                          std::vector<IndexedEntity> entities,
+                          const std::string_view entityReferencePrefix)
+{
+    std::stable_sort(entities.begin(),
+                     entities.end(),
+                     [](const IndexedEntity& lhs, const IndexedEntity& rhs)
+                     { return lhs.entityReference < rhs.entityReference; });
+    entities.erase(std::unique(entities.begin(),
+                               entities.end(),
+                               [](const IndexedEntity& lhs, const IndexedEntity& rhs)
+                               { return lhs.entityReference == rhs.entityReference; }),
+                   entities.end());
+
+    StringPool strings;
+    std::vector<EntityRecord> entityRecords;
+    std::vector<TraitRecord> traitRecords;
+    std::vector<PropertyRecord> propertyRecords;
+    std::vector<VersionRecord> versionRecords;
+    entityRecords.reserve(entities.size());
+
+    for (const IndexedEntity& entity : entities)
+    {
+        EntityRecord& entityRecord = entityRecords.emplace_back();
+        entityRecord.reference = strings.add(entity.entityReference);
+        entityRecord.firstTrait = checkedSize(traitRecords.size(), "traits");
+        entityRecord.firstVersion = checkedSize(versionRecords.size(), "versions");
+
+        const TraitSet traitSet = entity.traitsData ? entity.traitsData->traitSet() : TraitSet{};
+        for (const auto& traitId : traitSet)
+        {
+            TraitRecord& traitRecord = traitRecords.emplace_back();
+            traitRecord.id = strings.add(traitId);
+            traitRecord.firstProperty = checkedSize(propertyRecords.size(), "properties");
+
+            for (const auto& key : entity.traitsData->traitPropertyKeys(traitId))
+            {
+                property::Value value;
+                entity.traitsData->getTraitProperty(&value, traitId, key);
+
+                PropertyRecord propertyRecord{strings.add(key), PropertyType::kBool, 0, 0};
+                if (const auto* boolValue = std::get_if<openassetio::Bool>(&value))
+                {
+                    propertyRecord.type = PropertyType::kBool;
+                    propertyRecord.value = *boolValue ? 1 : 0;
+                }
+                else if (const auto* intValue = std::get_if<openassetio::Int>(&value))
+                {
+                    propertyRecord.type = PropertyType::kInt;
+                    propertyRecord.value = static_cast<std::uint64_t>(*intValue);
+                }
+                else if (const auto* floatValue = std::get_if<openassetio::Float>(&value))
+                {
+                    propertyRecord.type = PropertyType::kFloat;
+                    std::memcpy(&propertyRecord.value, floatValue, sizeof(propertyRecord.value));
+                }
+                else
+                {
+                    propertyRecord.type = PropertyType::kStr;
+                    const StringRef strRef = strings.add(std::get<openassetio::Str>(value));
+                    std::memcpy(&propertyRecord.value, &strRef, sizeof(propertyRecord.value));
+                }
+                propertyRecords.push_back(propertyRecord);
+            }
+            traitRecord.numProperties =
+                checkedSize(propertyRecords.size(), "properties") - traitRecord.firstProperty;
+        }
+        entityRecord.numTraits =
+            checkedSize(traitRecords.size(), "traits") - entityRecord.firstTrait;
+
+        for (const std::string& version : entity.versions)
+        {
+            versionRecords.push_back({strings.add(version)});
+        }
+        entityRecord.numVersions =
+            checkedSize(versionRecords.size(), "versions") - entityRecord.firstVersion;
+    }
+
+    const Header header{kMagic,
+                        kFormatVersion,
+                        kByteOrderMark,
+                        checkedSize(entityRecords.size(), "entities"),
+                        checkedSize(traitRecords.size(), "traits"),
+                        checkedSize(propertyRecords.size(), "properties"),
+                        checkedSize(versionRecords.size(), "versions"),
+                        strings.add(entityReferencePrefix),
+                        strings.data().size()};
+
+    const std::string temporaryPath = temporaryPathFor(path);
+    {
+        std::ofstream stream{temporaryPath, std::ios::binary | std::ios::trunc};
+        // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeRecords(stream, entityRecords);
+        writeRecords(stream, traitRecords);
+        writeRecords(stream, propertyRecords);
+        writeRecords(stream, versionRecords);
+        stream.write(strings.data().data(), static_cast<std::streamsize>(strings.data().size()));
+        stream.close();
+        if (!stream)
+        {
+            std::error_code errorCode;
+            std::filesystem::remove(temporaryPath, errorCode);
+            throw std::runtime_error{"Failed to write resolution index '" + path + "'"};
+        }
+    }
+    std::filesystem::rename(temporaryPath, path);
+}
+
+ResolutionIndex::ResolutionIndex(const std::string& path) : file_{path}, contents_{file_.contents()}
+{
+    if (contents_.size() < sizeof(Header))
+    {
+        throwInvalid(path, "truncated header");
+    }
+    Header header{};
+    std::memcpy(&header, contents_.data(), sizeof(header));
+    if (header.magic != kMagic)
+    {
+        throwInvalid(path, "not an index file");
+    }
+    if (header.formatVersion != kFormatVersion || header.byteOrderMark != kByteOrderMark)
+    {
+        throwInvalid(path, "unsupported format version or byte order");
+    }
+
+    numEntities_ = header.numEntities;
+    entitiesOffset_ = sizeof(Header);
+    traitsOffset_ = entitiesOffset_ + std::size_t{header.numEntities} * sizeof(EntityRecord);
+    propertiesOffset_ = traitsOffset_ + std::size_t{header.numTraits} * sizeof(TraitRecord);
+    versionsOffset_ =
+        propertiesOffset_ + std::size_t{header.numProperties} * sizeof(PropertyRecord);
+    stringsOffset_ = versionsOffset_ + std::size_t{header.numVersions} * sizeof(VersionRecord);
+    if (contents_.size() != stringsOffset_ + header.stringsSize)
+    {
+        throwInvalid(path, "unexpected size");
+    }
+
+    // Validate every record up front, so that lookups need not.
+    const auto checkString = [&](const StringRef& ref)
+    {
+        if (std::size_t{ref.offset} + ref.size > header.stringsSize)
+        {
+            throwInvalid(path, "string out of bounds");
+        }
+    };
+    const auto checkRange = [&](const std::uint32_t first,
+                                const std::uint32_t count,
+                                const std::uint32_t total)
+    {
+        if (std::size_t{first} + count > total)
+        {
+            throwInvalid(path, "record range out of bounds");
+        }
+    };
+
+    checkString(header.prefix);
+    for (std::size_t idx = 0; idx < header.numEntities; ++idx)
+    {
+        const auto entity = record<EntityRecord>(entitiesOffset_, idx);
+        checkString(entity.reference);
+        checkRange(entity.firstTrait, entity.numTraits, header.numTraits);
+        checkRange(entity.firstVersion, entity.numVersions, header.numVersions);
+    }
+    for (std::size_t idx = 0; idx < header.numTraits; ++idx)
+    {
+        const auto trait = record<TraitRecord>(traitsOffset_, idx);
+        checkString(trait.id);
+        checkRange(trait.firstProperty, trait.numProperties, header.numProperties);
+        allTraits_.emplace(contents_.substr(stringsOffset_ + trait.id.offset, trait.id.size));
+    }
+    for (std::size_t idx = 0; idx < header.numProperties; ++idx)
+    {
+        const auto property = record<PropertyRecord>(propertiesOffset_, idx);
+        checkString(property.key);
+        if (property.type == PropertyType::kStr)
+        {
+            StringRef strRef{};
+            std::memcpy(&strRef, &property.value, sizeof(strRef));
+            checkString(strRef);
+        }
+        else if (property.type > PropertyType::kStr)
+        {
+            throwInvalid(path, "unknown property type");
+        }
+    }
+    for (std::size_t idx = 0; idx < header.numVersions; ++idx)
+    {
+        checkString(record<VersionRecord>(versionsOffset_, idx).reference);
+    }
+
+    prefix_ = contents_.substr(stringsOffset_ + header.prefix.offset, header.prefix.size);
+}
+
+std::optional<ResolutionIndex::EntityId> ResolutionIndex::find(
+    const std::string_view entityReference) const
+{
+    EntityId first = 0;
+    EntityId count = numEntities_;
+    while (count > 0)
+    {
+        const EntityId step = count / 2;
+        const EntityId mid = first + step;
+        if (this->entityReference(mid) < entityReference)
+        {
+            first = mid + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    if (first < numEntities_ && this->entityReference(first) == entityReference)
+    {
+        return first;
+    }
+    return std::nullopt;
+}
+
+TraitSet ResolutionIndex::traitSet(const EntityId entityId) const
+{
+    const auto entity = record<EntityRecord>(entitiesOffset_, entityId);
+    TraitSet traitSet;
+    for (std::uint32_t idx = 0; idx < entity.numTraits; ++idx)
+    {
+        const auto trait = record<TraitRecord>(traitsOffset_, entity.firstTrait + idx);
+        traitSet.emplace(contents_.substr(stringsOffset_ + trait.id.offset, trait.id.size));
+    }
+    return traitSet;
+}
+
+TraitsDataPtr ResolutionIndex::traitsData(const EntityId entityId, const TraitSet& traitSet) const
+{
+    const auto string = [&](const StringRef& ref)
+    { return std::string{contents_.substr(stringsOffset_ + ref.offset, ref.size)}; };
+
+    auto traitsData = TraitsData::make();
+    const auto entity = record<EntityRecord>(entitiesOffset_, entityId);
+    for (std::uint32_t traitIdx = 0; traitIdx < entity.numTraits; ++traitIdx)
+    {
+        const auto trait = record<TraitRecord>(traitsOffset_, entity.firstTrait + traitIdx);
+        std::string traitId = string(trait.id);
+        if (traitSet.count(traitId) == 0)
+        {
+            continue;
+        }
+        traitsData->addTrait(traitId);
+
+        for (std::uint32_t propertyIdx = 0; propertyIdx < trait.numProperties; ++propertyIdx)
+        {
+            const auto property =
+                record<PropertyRecord>(propertiesOffset_, trait.firstProperty + propertyIdx);
+            property::Value value;
+            switch (property.type)
+            {
+            case PropertyType::kBool:
+                value = openassetio::Bool{property.value != 0};
+                break;
+            case PropertyType::kInt:
+                value = static_cast<openassetio::Int>(property.value);
+                break;
+            case PropertyType::kFloat:
+            {
+                openassetio::Float floatValue = 0;
+                std::memcpy(&floatValue, &property.value, sizeof(floatValue));
+                value = floatValue;
+                break;
+            }
+            case PropertyType::kStr:
+            {
+                StringRef strRef{};
+                std::memcpy(&strRef, &property.value, sizeof(strRef));
+                value = string(strRef);
+                break;
+            }
+            }
+            traitsData->setTraitProperty(traitId, string(property.key), std::move(value));
+        }
+    }
+    return traitsData;
+}
+
+std::vector<std::string_view> ResolutionIndex::versions(const EntityId entityId) const
+{
+    const auto entity = record<EntityRecord>(entitiesOffset_, entityId);
+    std::vector<std::string_view> versions;
+    versions.reserve(entity.numVersions);
+    for (std::uint32_t idx = 0; idx < entity.numVersions; ++idx)
+    {
+        const auto version = record<VersionRecord>(versionsOffset_, entity.firstVersion + idx);
+        versions.push_back(
+            contents_.substr(stringsOffset_ + version.reference.offset, version.reference.size));
+    }
+    return versions;
+}
+
+template <class Record>
+Record ResolutionIndex::record(const std::size_t arrayOffset, const std::size_t idx) const
+{
+    // Copied, as records in the mapping are not necessarily aligned.
+    Record rec{};
+    std::memcpy(&rec, contents_.data() + arrayOffset + idx * sizeof(Record), sizeof(Record));
+    return rec;
+}
+
+std::string_view ResolutionIndex::entityReference(const EntityId entityId) const
+{
+    const auto entity = record<EntityRecord>(entitiesOffset_, entityId);
+    return contents_.substr(stringsOffset_ + entity.reference.offset, entity.reference.size);
+}
@@ -0,0 +1,113 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+
+#include "ReferenceScanner.hpp"
+
+/**
+ * An entity to be written to a resolution index.
+ */
+struct IndexedEntity
+{
+    std::string entityReference;
+    /// All traits of the entity, and their properties.
+    openassetio::trait::TraitsDataPtr traitsData;
+    /// References to each version of the entity, if any.
+    std::vector<std::string> versions;
+};
+
+/**
+ * Write a resolution index file, see ResolutionIndex.
+ *
+ * The file is written alongside the destination and renamed into
+ * place, so that processes reading an existing index are unaffected.
+ *
+ * @param path Path of the index file.
+ * @param entities Entities to index. Where several share a reference,
+ * the first is indexed.
+ * @param entityReferencePrefix Prefix common to all entity references
+ * of the source manager, if any.
+ *
+ * @throws std::runtime_error If the file cannot be written.
+ */
+void writeResolutionIndex(const std::string& path,
+                          std::vector<IndexedEntity> entities,
+                          std::string_view entityReferencePrefix);
+
+/**
+ * Immutable index of the traits and versions of entities, read from a
+ * memory-mapped file.
+ *
+ * The file consists of a header, followed by arrays of fixed-size
+ * entity, trait, property and version records, followed by a pool of
+ * the strings they refer to. Entity records are sorted by reference,
+ * so that lookups are a binary search of the mapped file, without
+ * parsing or copying it up front. The file is validated on
+ * construction, so lookups cannot read out of bounds.
+ *
+ * Instances are immutable, and so may be used from any thread.
+ */
+class ResolutionIndex
+{
+public:
+    /// Position of an entity in the index.
+    using EntityId = std::uint32_t;
+
+    /**
+     * @throws std::runtime_error If the file cannot be read, or is not
+     * a valid index.
+     */
+    explicit ResolutionIndex(const std::string& path);
+
+    /// Find an entity by its reference.
+    [[nodiscard]] std::optional<EntityId> find(std::string_view entityReference) const;
+
+    /// Number of entities in the index.
+    [[nodiscard]] std::size_t size() const { return numEntities_; }
+
+    /// Prefix common to all entity references, or empty if unknown.
+    [[nodiscard]] std::string_view entityReferencePrefix() const { return prefix_; }
+
+    /// Traits held by any entity in the index.
+    [[nodiscard]] const openassetio::trait::TraitSet& allTraits() const { return allTraits_; }
+
+    [[nodiscard]] openassetio::trait::TraitSet traitSet(EntityId entityId) const;
+
+    /**
+     * Traits of an entity, and their properties, limited to the given
+     * traits.
+     */
+    [[nodiscard]] openassetio::trait::TraitsDataPtr traitsData(
+        EntityId entityId, const openassetio::trait::TraitSet& traitSet) const;
+
+    /// References to each version of an entity, if any.
+    [[nodiscard]] std::vector<std::string_view> versions(EntityId entityId) const;
+
+private:
+    template <class Record>
+    [[nodiscard]] Record record(std::size_t arrayOffset, std::size_t idx) const;
+
+    [[nodiscard]] std::string_view entityReference(EntityId entityId) const;
+
+    MappedFile file_;
+    std::string_view contents_;
+    std::uint32_t numEntities_ = 0;
+    std::size_t entitiesOffset_ = 0;
+    std::size_t traitsOffset_ = 0;
+    std::size_t propertiesOffset_ = 0;
+    std::size_t versionsOffset_ = 0;
+    std::size_t stringsOffset_ = 0;
+    std::string_view prefix_;
+    openassetio::trait::TraitSet allTraits_;
+};
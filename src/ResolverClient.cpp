@@ -0,0 +1,173 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolverClient.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+ResolverClient::ResolverClient(std::string socketPath, const std::chrono::milliseconds timeout)
+    : socketPath_{std::move(socketPath)}, timeout_{timeout}
+{
+}
+
+ResolverClient::~ResolverClient()
+{
+#ifndef _WIN32
+    for (const int connectionFd : idleConnections_)
+    {
+        ::close(connectionFd);
+    }
+#endif
+}
+
+std::vector<resolver_protocol::Result> ResolverClient::call(
+    const resolver_protocol::Request& request)
+{
+#ifndef _WIN32
+    const std::string requestPayload = resolver_protocol::encodeRequest(request);
+
+    // A pooled connection may have been closed by the server since it
+    // was last used (e.g. if the server restarted), so retry once with
+    // a fresh connection. A server that timed out is not retried, which
+    // would only double the wait.
+    for (int attempt = 0;; ++attempt)
+    {
+        int connectionFd = -1;
+        {
+            const std::lock_guard lock{idleConnectionsMutex_};
+            if (!idleConnections_.empty())
+            {
+                connectionFd = idleConnections_.back();
+                idleConnections_.pop_back();
+            }
+        }
+        const bool isPooled = connectionFd >= 0;
+        if (!isPooled)
+        {
+            connectionFd = connect();
+        }
+
+        std::string responsePayload;
+        try
+        {
+            resolver_protocol::writeFrame(connectionFd, requestPayload);
+            if (!resolver_protocol::readFrame(connectionFd, responsePayload))
+            {
+                throw std::system_error{std::make_error_code(std::errc::connection_reset),
+                                        "Resolver server closed the connection"};
+            }
+        }
+        catch (const std::system_error& exc)
+        {
+            ::close(connectionFd);
+            const int error = exc.code().value();
+            if (isPooled && attempt == 0 && error != EAGAIN && error != EWOULDBLOCK)
+            {
+                continue;
+            }
+            throw;
+        }
+        catch (const std::exception&)
+        {
+            ::close(connectionFd);
+            if (isPooled && attempt == 0)
+            {
+                continue;
+            }
+            throw;
+        }
+
+        {
+            const std::lock_guard lock{idleConnectionsMutex_};
+            idleConnections_.push_back(connectionFd);
+        }
+
+        auto results = resolver_protocol::decodeResults(responsePayload);
+        if (results.size() != request.items.size())
+        {
+            throw std::runtime_error{"Resolver server returned an unexpected number of results"};
+        }
+        return results;
+    }
+#else
+    (void)request;
+    throw std::runtime_error{"Unix domain sockets are not supported on this platform"};
+#endif
+}
+
+resolver_protocol::Strings ResolverClient::callOne(const resolver_protocol::Operation operation,
+                                                   resolver_protocol::Strings args)
+{
+    resolver_protocol::Request request{operation, {}};
+    request.items.push_back(std::move(args));
+
+    resolver_protocol::Result result = std::move(call(request).front());
+    if (result.status != resolver_protocol::Status::kOk)
+    {
+        throw std::runtime_error{result.values.empty() ? "Resolver server error"
+                                                       : result.values.front()};
+    }
+    return std::move(result.values);
+}
+
+int ResolverClient::connect() const
+{
+#ifndef _WIN32
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath_.size() >= sizeof(address.sun_path))
+    {
+        throw std::system_error{std::make_error_code(std::errc::filename_too_long),
+                                "Resolver socket path too long: " + socketPath_};
+    }
+    std::memcpy(address.sun_path, socketPath_.c_str(), socketPath_.size() + 1);
+
+    const int connectionFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (connectionFd < 0)
+    {
+        throw std::system_error{errno, std::generic_category(), "Failed to create socket"};
+    }
+    if (timeout_.count() > 0)
+    {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout_);
+        timeval timeout{};
+        timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(seconds.count());
+        timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>(
+            std::chrono::duration_cast<std::chrono::microseconds>(timeout_ - seconds).count());
+        if (::setsockopt(connectionFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0 ||
+            ::setsockopt(connectionFd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) != 0)
+        {
+            const int error = errno;
+            ::close(connectionFd);
+            throw std::system_error{error, std::generic_category(), "Failed to set socket timeout"};
+        }
+    }
+    // NOLINTNEXTLINE(*-reinterpret-cast)
+    if (::connect(connectionFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) !=
+        0)
+    {
+        const int error = errno;
+        ::close(connectionFd);
+        throw std::system_error{
+            error, std::generic_category(), "Failed to connect to resolver at " + socketPath_};
+    }
+    return connectionFd;
+#else
+    throw std::runtime_error{"Unix domain sockets are not supported on this platform"};
+#endif
+}
@@ -0,0 +1,68 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ResolverProtocol.hpp"
+
+/**
+ * Client of a ResolverServer, see resolver_protocol.
+ *
+ * Connections are pooled, such that concurrent calls from multiple
+ * threads each use their own connection, and connections are reused
+ * across calls.
+ */
+class ResolverClient
+{
+public:
+    /**
+     * Connections are made on demand, so construction does not
+     * require the server to be running.
+     *
+     * @param socketPath Path of the server's socket.
+     * @param timeout Time to wait for each read from or write to the
+     * server, or zero to wait indefinitely.
+     */
+    ResolverClient(std::string socketPath, std::chrono::milliseconds timeout);
+
+    ~ResolverClient();
+
+    ResolverClient(const ResolverClient&) = delete;
+    ResolverClient& operator=(const ResolverClient&) = delete;
+    ResolverClient(ResolverClient&&) = delete;
+    ResolverClient& operator=(ResolverClient&&) = delete;
+
+    /**
+     * Send a batch of request items, returning one result per item.
+     *
+     * @throws std::system_error If the server cannot be reached, or
+     * fails to respond within the timeout.
+     * @throws std::runtime_error If the response is malformed.
+     */
+    std::vector<resolver_protocol::Result> call(const resolver_protocol::Request& request);
+
+    /**
+     * Send a single request item, returning its values.
+     *
+     * @throws std::runtime_error With the server's message, if the item
+     * failed.
+     */
+    resolver_protocol::Strings callOne(resolver_protocol::Operation operation,
+                                       resolver_protocol::Strings args);
+
+    [[nodiscard]] const std::string& socketPath() const { return socketPath_; }
+
+private:
+    [[nodiscard]] int connect() const;
+
+    const std::string socketPath_;
+    const std::chrono::milliseconds timeout_;
+
+    std::mutex idleConnectionsMutex_;
+    std::vector<int> idleConnections_;
+};
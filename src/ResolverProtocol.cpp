@@ -0,0 +1,289 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolverProtocol.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#endif
+
+namespace resolver_protocol
+{
+namespace
+{
+constexpr std::size_t kUint32Size = 4;
+
+void appendUint32(std::string& out, const std::uint32_t value)
+{
+    for (std::size_t byteIdx = 0; byteIdx < kUint32Size; ++byteIdx)
+    {
+        out += static_cast<char>((value >> (8 * byteIdx)) & 0xffU);
+    }
+}
+
+void appendString(std::string& out, const std::string_view str)
+{
+    appendUint32(out, static_cast<std::uint32_t>(str.size()));
+    out += str;
+}
+
+void appendStrings(std::string& out, const Strings& strs)
+{
+    appendUint32(out, static_cast<std::uint32_t>(strs.size()));
+    for (const std::string& str : strs)
+    {
+        appendString(out, str);
+    }
+}
+
+std::uint32_t decodeUint32(const std::string_view bytes)
+{
+    std::uint32_t value = 0;
+    for (std::size_t byteIdx = 0; byteIdx < kUint32Size; ++byteIdx)
+    {
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[byteIdx]))
+                 << (8 * byteIdx);
+    }
+    return value;
+}
+
+/**
+ * Sequential reader of a payload, checking bounds as it goes.
+ */
+class PayloadReader
+{
+public:
+    explicit PayloadReader(const std::string_view payload) : remaining_{payload} {}
+
+    std::uint8_t readUint8() { return static_cast<std::uint8_t>(take(1).front()); }
+
+    std::uint32_t readUint32() { return decodeUint32(take(kUint32Size)); }
+
+    std::string readString() { return std::string{take(readUint32())}; }
+
+    Strings readStrings()
+    {
+        const std::uint32_t count = readUint32();
+        // Each string occupies at least its length prefix.
+        if (count > remaining_.size() / kUint32Size)
+        {
+            throw std::runtime_error{"Malformed resolver message: invalid count"};
+        }
+        Strings strs;
+        strs.reserve(count);
+        for (std::uint32_t idx = 0; idx < count; ++idx)
+        {
+            strs.push_back(readString());
+        }
+        return strs;
+    }
+
+    void expectEnd() const
+    {
+        if (!remaining_.empty())
+        {
+            throw std::runtime_error{"Malformed resolver message: trailing data"};
+        }
+    }
+
+private:
+    std::string_view take(const std::size_t size)
+    {
+        if (size > remaining_.size())
+        {
+            throw std::runtime_error{"Malformed resolver message: truncated"};
+        }
+        const std::string_view bytes = remaining_.substr(0, size);
+        remaining_.remove_prefix(size);
+        return bytes;
+    }
+
+    std::string_view remaining_;
+};
+
+#ifndef _WIN32
+/**
+ * Read exactly `size` bytes, returning the number read, which is less
+ * than `size` only if the peer closed the connection.
+ */
+std::size_t readFully(const int socketFd, char* data, const std::size_t size)
+{
+    std::size_t numRead = 0;
+    while (numRead < size)
+    {
+        const auto result = ::recv(socketFd, data + numRead, size - numRead, 0);
+        if (result == 0)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::system_error{errno, std::generic_category(), "Failed to read from socket"};
+        }
+        numRead += static_cast<std::size_t>(result);
+    }
+    return numRead;
+}
+#endif
+}  // namespace
+
+std::string encodeRequest(const Request& request)
+{
+    std::string payload;
+    payload += static_cast<char>(request.operation);
+    appendUint32(payload, static_cast<std::uint32_t>(request.items.size()));
+    for (const Strings& item : request.items)
+    {
+        appendStrings(payload, item);
+    }
+    return payload;
+}
+
+Request decodeRequest(const std::string_view payload)
+{
+    PayloadReader reader{payload};
+    Request request{static_cast<Operation>(reader.readUint8()), {}};
+    switch (request.operation)
+    {
+    case Operation::kResolvePath:
+    case Operation::kResolveVersion:
+    case Operation::kGetFields:
+    case Operation::kGetManagerInfo:
+    case Operation::kIsEntityReference:
+        break;
+    default:
+        throw std::runtime_error{"Malformed resolver message: unknown operation"};
+    }
+    const std::uint32_t numItems = reader.readUint32();
+    if (numItems > payload.size() / kUint32Size)
+    {
+        throw std::runtime_error{"Malformed resolver message: invalid count"};
+    }
+    request.items.reserve(numItems);
+    for (std::uint32_t idx = 0; idx < numItems; ++idx)
+    {
+        request.items.push_back(reader.readStrings());
+    }
+    reader.expectEnd();
+    return request;
+}
+
+std::string encodeResults(const std::vector<Result>& results)
+{
+    std::string payload;
+    appendUint32(payload, static_cast<std::uint32_t>(results.size()));
+    for (const Result& result : results)
+    {
+        payload += static_cast<char>(result.status);
+        appendStrings(payload, result.values);
+    }
+    return payload;
+}
+
+std::vector<Result> decodeResults(const std::string_view payload)
+{
+    PayloadReader reader{payload};
+    const std::uint32_t numResults = reader.readUint32();
+    if (numResults > payload.size() / kUint32Size)
+    {
+        throw std::runtime_error{"Malformed resolver message: invalid count"};
+    }
+    std::vector<Result> results;
+    results.reserve(numResults);
+    for (std::uint32_t idx = 0; idx < numResults; ++idx)
+    {
+        const auto status = static_cast<Status>(reader.readUint8());
+        if (status != Status::kOk && status != Status::kError)
+        {
+            throw std::runtime_error{"Malformed resolver message: unknown status"};
+        }
+        results.push_back({status, reader.readStrings()});
+    }
+    reader.expectEnd();
+    return results;
+}
+
+#ifndef _WIN32
+
+void writeFrame(const int socketFd, const std::string_view payload)
+{
+    if (payload.size() > kMaxPayloadSize)
+    {
+        throw std::runtime_error{"Resolver message too large"};
+    }
+    std::string frame;
+    frame.reserve(kUint32Size + payload.size());
+    appendUint32(frame, static_cast<std::uint32_t>(payload.size()));
+    frame += payload;
+
+    std::size_t numWritten = 0;
+    while (numWritten < frame.size())
+    {
+        // Don't raise SIGPIPE if the peer has gone away.
+        const auto result =
+            ::send(socketFd, frame.data() + numWritten, frame.size() - numWritten, MSG_NOSIGNAL);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::system_error{errno, std::generic_category(), "Failed to write to socket"};
+        }
+        numWritten += static_cast<std::size_t>(result);
+    }
+}
+
+bool readFrame(const int socketFd, std::string& payload)
+{
+    std::array<char, kUint32Size> header{};
+    const std::size_t headerSize = readFully(socketFd, header.data(), header.size());
+    if (headerSize == 0)
+    {
+        return false;
+    }
+    if (headerSize < header.size())
+    {
+        throw std::runtime_error{"Truncated resolver message"};
+    }
+
+    const std::uint32_t size = decodeUint32({header.data(), header.size()});
+    if (size > kMaxPayloadSize)
+    {
+        throw std::runtime_error{"Resolver message too large"};
+    }
+    payload.resize(size);
+    if (readFully(socketFd, payload.data(), size) < size)
+    {
+        throw std::runtime_error{"Truncated resolver message"};
+    }
+    return true;
+}
+
+#else
+
+void writeFrame(int /*socketFd*/, std::string_view /*payload*/)
+{
+    throw std::runtime_error{"Unix domain sockets are not supported on this platform"};
+}
+
+bool readFrame(int /*socketFd*/, std::string& /*payload*/)
+{
+    throw std::runtime_error{"Unix domain sockets are not supported on this platform"};
+}
+
+#endif
+}  // namespace resolver_protocol
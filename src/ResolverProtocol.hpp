@@ -0,0 +1,96 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Binary protocol spoken between a resolver client and server over a
+ * Unix domain socket.
+ *
+ * Each message is a frame of a little-endian uint32 payload length
+ * followed by the payload. Strings are encoded as a uint32 length
+ * followed by their bytes.
+ *
+ * A request payload is an operation code, followed by a batch of
+ * items, each a list of string arguments. A response payload is a list
+ * of results, one per item, each a status code followed by a list of
+ * string values. For a failed item, the values are the error message.
+ */
+namespace resolver_protocol
+{
+enum class Operation : std::uint8_t
+{
+    /// Arguments: [assetId]. Values: [path].
+    kResolvePath = 1,
+    /// Arguments: [assetId, versionStr]. Values: [version].
+    kResolveVersion = 2,
+    /// Arguments: [assetId, includeDefaults ("0" or "1")].
+    /// Values: [key1, value1, key2, value2, ...].
+    kGetFields = 3,
+    /// Arguments: []. Values: [generation], followed by the manager's
+    /// entity reference prefix, if it advertises one.
+    kGetManagerInfo = 4,
+    /// Arguments: [str]. Values: ["1"] if an entity reference, else
+    /// ["0"].
+    kIsEntityReference = 5
+};
+
+enum class Status : std::uint8_t
+{
+    kOk = 0,
+    kError = 1
+};
+
+using Strings = std::vector<std::string>;
+
+struct Request
+{
+    Operation operation;
+    std::vector<Strings> items;
+};
+
+struct Result
+{
+    Status status;
+    Strings values;
+};
+
+/// Largest payload accepted, to bound memory use for malformed frames.
+constexpr std::uint32_t kMaxPayloadSize = 64U * 1024U * 1024U;
+
+std::string encodeRequest(const Request& request);
+
+/**
+ * @throws std::runtime_error If the payload is malformed.
+ */
+Request decodeRequest(std::string_view payload);
+
+std::string encodeResults(const std::vector<Result>& results);
+
+/**
+ * @throws std::runtime_error If the payload is malformed.
+ */
+std::vector<Result> decodeResults(std::string_view payload);
+
+/**
+ * Write a frame containing the given payload to a socket.
+ *
+ * @throws std::system_error If the write fails.
+ */
+void writeFrame(int socketFd, std::string_view payload);
+
+/**
+ * Read a frame from a socket.
+ *
+ * @return false if the peer closed the connection before the start of
+ * a frame.
+ * @throws std::system_error If the read fails.
+ * @throws std::runtime_error If the frame is truncated or too large.
+ */
+bool readFrame(int socketFd, std::string& payload);
+}  // namespace resolver_protocol
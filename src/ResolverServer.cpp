@@ -0,0 +1,255 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "ResolverServer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+
+namespace
+{
+/// Whether a server is accepting connections on the given socket.
+bool isListening(const sockaddr_un& address)
+{
+    const int probeFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probeFd < 0)
+    {
+        return false;
+    }
+    // NOLINTNEXTLINE(*-reinterpret-cast)
+    const bool isConnected =
+        ::connect(probeFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    ::close(probeFd);
+    return isConnected;
+}
+}  // namespace
+
+ResolverServer::ResolverServer(std::string socketPath,
+                               HandlerFn handler,
+                               const std::size_t maxConnections)
+    : socketPath_{std::move(socketPath)},
+      handler_{std::move(handler)},
+      maxConnections_{std::max<std::size_t>(maxConnections, 1)}
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath_.size() >= sizeof(address.sun_path))
+    {
+        throw std::system_error{std::make_error_code(std::errc::filename_too_long),
+                                "Resolver socket path too long: " + socketPath_};
+    }
+    std::memcpy(address.sun_path, socketPath_.c_str(), socketPath_.size() + 1);
+
+    if (::pipe(stopPipe_) != 0)
+    {
+        throw std::system_error{errno, std::generic_category(), "Failed to create pipe"};
+    }
+
+    listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0)
+    {
+        const int error = errno;
+        ::close(stopPipe_[0]);
+        ::close(stopPipe_[1]);
+        throw std::system_error{error, std::generic_category(), "Failed to create socket"};
+    }
+
+    // Replace any socket left behind by a server that did not exit
+    // cleanly, but not that of a server that is still running.
+    if (isListening(address))
+    {
+        ::close(listenFd_);
+        ::close(stopPipe_[0]);
+        ::close(stopPipe_[1]);
+        throw std::system_error{std::make_error_code(std::errc::address_in_use),
+                                "Resolver socket already in use: " + socketPath_};
+    }
+    ::unlink(socketPath_.c_str());
+
+    // NOLINTNEXTLINE(*-reinterpret-cast)
+    if (::bind(listenFd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd_, SOMAXCONN) != 0)
+    {
+        const int error = errno;
+        ::close(listenFd_);
+        ::close(stopPipe_[0]);
+        ::close(stopPipe_[1]);
+        throw std::system_error{
+            error, std::generic_category(), "Failed to listen on " + socketPath_};
+    }
+
+    acceptThread_ = std::thread{&ResolverServer::acceptConnections, this};
+}
+
+ResolverServer::~ResolverServer()
+{
+    // Never read from, so remains readable, waking every poll.
+    const char stopByte = 0;
+    [[maybe_unused]] const auto numWritten = ::write(stopPipe_[1], &stopByte, 1);
+
+    {
+        const std::lock_guard lock{connectionsMutex_};
+        isStopping_ = true;
+    }
+    connectionsChanged_.notify_all();
+    acceptThread_.join();
+
+    // Connection threads lock the mutex as they finish, so must be
+    // joined without it.
+    std::list<std::thread> connectionThreads;
+    {
+        const std::lock_guard lock{connectionsMutex_};
+        connectionThreads.swap(connectionThreads_);
+        for (const int connectionFd : connectionFds_)
+        {
+            ::shutdown(connectionFd, SHUT_RDWR);
+        }
+    }
+    for (std::thread& thread : connectionThreads)
+    {
+        thread.join();
+    }
+
+    ::close(listenFd_);
+    ::unlink(socketPath_.c_str());
+    ::close(stopPipe_[0]);
+    ::close(stopPipe_[1]);
+}
+
+bool ResolverServer::waitForReadable(const int socketFd) const
+{
+    std::array<pollfd, 2> pollFds{{{socketFd, POLLIN, 0}, {stopPipe_[0], POLLIN, 0}}};
+    while (true)
+    {
+        if (::poll(pollFds.data(), pollFds.size(), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        if (pollFds[1].revents != 0)
+        {
+            return false;
+        }
+        if (pollFds[0].revents != 0)
+        {
+            return true;
+        }
+    }
+}
+
+void ResolverServer::acceptConnections()
+{
+    while (waitForReadable(listenFd_))
+    {
+        std::unique_lock lock{connectionsMutex_};
+        connectionsChanged_.wait(lock,
+                                 [this]
+                                 {
+                                     const std::size_t numLive =
+                                         connectionThreads_.size() - finishedThreadIds_.size();
+                                     return isStopping_ || numLive < maxConnections_;
+                                 });
+        if (isStopping_)
+        {
+            return;
+        }
+
+        const int connectionFd = ::accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (connectionFd < 0)
+        {
+            continue;
+        }
+
+        // Reap threads of connections that have since closed.
+        for (const std::thread::id finishedId : finishedThreadIds_)
+        {
+            const auto threadIt = std::find_if(connectionThreads_.begin(),
+                                               connectionThreads_.end(),
+                                               [&](const std::thread& thread)
+                                               { return thread.get_id() == finishedId; });
+            threadIt->join();
+            connectionThreads_.erase(threadIt);
+        }
+        finishedThreadIds_.clear();
+
+        connectionFds_.insert(connectionFd);
+        connectionThreads_.emplace_back(&ResolverServer::serveConnection, this, connectionFd);
+    }
+}
+
+void ResolverServer::serveConnection(const int connectionFd)
+{
+    using resolver_protocol::Request;
+    using resolver_protocol::Result;
+    using resolver_protocol::Status;
+
+    std::string payload;
+    try
+    {
+        while (waitForReadable(connectionFd) && resolver_protocol::readFrame(connectionFd, payload))
+        {
+            const Request request = resolver_protocol::decodeRequest(payload);
+
+            std::vector<Result> results;
+            try
+            {
+                results = handler_(request);
+            }
+            catch (const std::exception& exc)
+            {
+                results.assign(request.items.size(), Result{Status::kError, {exc.what()}});
+            }
+            resolver_protocol::writeFrame(connectionFd, resolver_protocol::encodeResults(results));
+        }
+    }
+    catch (const std::exception&)  // NOLINT(*-empty-catch)
+    {
+        // Malformed request or broken connection, so drop the client,
+        // which will reconnect if it is still alive.
+    }
+    {
+        // Forget the socket before closing it, so that it is not shut
+        // down after its descriptor is reused.
+        const std::lock_guard lock{connectionsMutex_};
+        connectionFds_.erase(connectionFd);
+        finishedThreadIds_.push_back(std::this_thread::get_id());
+    }
+    ::close(connectionFd);
+    connectionsChanged_.notify_all();
+}
+
+#else
+
+ResolverServer::ResolverServer(std::string socketPath,
+                               HandlerFn handler,
+                               const std::size_t maxConnections)
+    : socketPath_{std::move(socketPath)},
+      handler_{std::move(handler)},
+      maxConnections_{maxConnections}
+{
+    throw std::runtime_error{"Unix domain sockets are not supported on this platform"};
+}
+
+ResolverServer::~ResolverServer() = default;
+
+#endif
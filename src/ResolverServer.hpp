@@ -0,0 +1,88 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "ResolverProtocol.hpp"
+
+/**
+ * Serves resolver requests over a Unix domain socket, see
+ * resolver_protocol.
+ *
+ * Connections are accepted on a background thread, and each is served
+ * on its own thread, such that requests from different clients are
+ * handled concurrently. Once the maximum number of connections are
+ * being served, further connections wait to be accepted.
+ */
+class ResolverServer
+{
+public:
+    /**
+     * Function to handle a batch of request items. Called on
+     * connection threads. Must return one result per item. Exceptions
+     * are reported to the client as a failure of every item.
+     */
+    using HandlerFn =
+        std::function<std::vector<resolver_protocol::Result>(const resolver_protocol::Request&)>;
+
+    /**
+     * Start serving on the given socket path. Any existing socket file
+     * at the path is replaced, unless another server is listening on
+     * it.
+     *
+     * @param maxConnections Most connections served at once.
+     *
+     * @throws std::system_error If the socket cannot be created, or is
+     * in use.
+     */
+    ResolverServer(std::string socketPath, HandlerFn handler, std::size_t maxConnections);
+
+    /**
+     * Stop serving, closing all connections and removing the socket
+     * file.
+     */
+    ~ResolverServer();
+
+    ResolverServer(const ResolverServer&) = delete;
+    ResolverServer& operator=(const ResolverServer&) = delete;
+    ResolverServer(ResolverServer&&) = delete;
+    ResolverServer& operator=(ResolverServer&&) = delete;
+
+    [[nodiscard]] const std::string& socketPath() const { return socketPath_; }
+
+private:
+    void acceptConnections();
+    void serveConnection(int connectionFd);
+
+    /// Wait until the socket is readable or the server is stopping.
+    [[nodiscard]] bool waitForReadable(int socketFd) const;
+
+    const std::string socketPath_;
+    const HandlerFn handler_;
+    const std::size_t maxConnections_;
+    int listenFd_{-1};
+    /// Written to on destruction, to wake all threads blocked in poll.
+    int stopPipe_[2]{-1, -1};  // NOLINT(*-avoid-c-arrays)
+
+    std::mutex connectionsMutex_;
+    /// Notified as connections finish, or the server is stopping.
+    std::condition_variable connectionsChanged_;
+    bool isStopping_{false};
+    std::list<std::thread> connectionThreads_;
+    /// Connection threads that have finished, and can be joined.
+    std::vector<std::thread::id> finishedThreadIds_;
+    /// Sockets of connections still being served, shut down on
+    /// destruction to wake blocked reads.
+    std::unordered_set<int> connectionFds_;
+    std::thread acceptThread_;
+};
@@ -0,0 +1,168 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "RoundTripMonitor.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace
+{
+std::vector<std::string> sortedTraitIds(const openassetio::trait::TraitSet& traitSet)
+{
+    std::vector<std::string> traitIds{traitSet.begin(), traitSet.end()};
+    std::sort(traitIds.begin(), traitIds.end());
+    return traitIds;
+}
+}  // namespace
+
+RoundTripMonitor::RoundTripMonitor(const std::chrono::milliseconds operationGap,
+                                   const std::size_t batchableThreshold,
+                                   const std::size_t roundTripBudget)
+    : operationGap_{operationGap},
+      batchableThreshold_{batchableThreshold},
+      roundTripBudget_{roundTripBudget}
+{
+}
+
+std::vector<BatchableCalls> RoundTripMonitor::record(const std::string_view method,
+                                                     const std::string_view managerCall,
+                                                     const std::size_t numElements,
+                                                     const openassetio::trait::TraitSet& traitSet,
+                                                     const Clock::time_point now)
+{
+    numRoundTrips_.fetch_add(1, std::memory_order_relaxed);
+    if (!isEnabled())
+    {
+        return {};
+    }
+
+    // Only single-element calls are keyed, so build the key outside
+    // the lock, and only when needed.
+    std::optional<CallKey> callKey;
+    if (numElements == 1 && batchableThreshold_ != 0)
+    {
+        callKey.emplace(method, managerCall, sortedTraitIds(traitSet));
+    }
+
+    std::vector<BatchableCalls> newlyBatchable;
+    const std::lock_guard lock{mutex_};
+
+    auto [operationIt, isNew] = operations_.try_emplace(std::this_thread::get_id());
+    Operation& operation = operationIt->second;
+    if (!isNew && now - operation.lastCall > operationGap_)
+    {
+        complete(operation, newlyBatchable);
+        operation = Operation{};
+        isNew = true;
+    }
+    if (isNew)
+    {
+        operation.method = std::string{method};
+    }
+    operation.lastCall = now;
+    ++operation.roundTrips;
+    if (callKey)
+    {
+        ++operation.singleElementCalls[std::move(*callKey)];
+    }
+    return newlyBatchable;
+}
+
+std::vector<BatchableCalls> RoundTripMonitor::completeIdle(const Clock::time_point now)
+{
+    std::vector<BatchableCalls> newlyBatchable;
+    const std::lock_guard lock{mutex_};
+    for (auto operationIt = operations_.begin(); operationIt != operations_.end();)
+    {
+        if (now - operationIt->second.lastCall > operationGap_)
+        {
+            complete(operationIt->second, newlyBatchable);
+            operationIt = operations_.erase(operationIt);
+        }
+        else
+        {
+            ++operationIt;
+        }
+    }
+    return newlyBatchable;
+}
+
+std::vector<OperationRoundTrips> RoundTripMonitor::operationRoundTrips() const
+{
+    const std::lock_guard lock{mutex_};
+    std::vector<OperationRoundTrips> result;
+    result.reserve(operationRoundTrips_.size());
+    std::transform(operationRoundTrips_.begin(),
+                   operationRoundTrips_.end(),
+                   std::back_inserter(result),
+                   [](const auto& methodAndRoundTrips) { return methodAndRoundTrips.second; });
+    return result;
+}
+
+std::vector<BatchableCalls> RoundTripMonitor::batchableCalls() const
+{
+    const std::lock_guard lock{mutex_};
+    std::vector<BatchableCalls> result;
+    result.reserve(batchableCalls_.size());
+    std::transform(batchableCalls_.begin(),
+                   batchableCalls_.end(),
+                   std::back_inserter(result),
+                   [](const auto& keyAndCalls) { return keyAndCalls.second; });
+    return result;
+}
+
+std::uint64_t RoundTripMonitor::numRoundTrips() const
+{
+    return numRoundTrips_.load(std::memory_order_relaxed);
+}
+
+bool RoundTripMonitor::isEnabled() const
+{
+    return batchableThreshold_ != 0 || roundTripBudget_ != 0;
+}
+
+void RoundTripMonitor::complete(const Operation& operation,
+                                std::vector<BatchableCalls>& newlyBatchable)
+{
+    auto roundTripsIt = operationRoundTrips_.find(operation.method);
+    if (roundTripsIt == operationRoundTrips_.end())
+    {
+        roundTripsIt = operationRoundTrips_.emplace(operation.method, OperationRoundTrips{}).first;
+        roundTripsIt->second.method = operation.method;
+    }
+    OperationRoundTrips& roundTrips = roundTripsIt->second;
+    ++roundTrips.operations;
+    roundTrips.roundTrips += operation.roundTrips;
+    roundTrips.maxRoundTrips = std::max(roundTrips.maxRoundTrips, operation.roundTrips);
+    if (roundTripBudget_ != 0 && operation.roundTrips > roundTripBudget_)
+    {
+        ++roundTrips.overBudget;
+    }
+
+    for (const auto& [callKey, numCalls] : operation.singleElementCalls)
+    {
+        if (numCalls < batchableThreshold_)
+        {
+            continue;
+        }
+        auto [batchableIt, isNew] = batchableCalls_.try_emplace(callKey);
+        BatchableCalls& batchable = batchableIt->second;
+        if (isNew)
+        {
+            const auto& [method, managerCall, traitIds] = callKey;
+            batchable.method = method;
+            batchable.managerCall = managerCall;
+            batchable.traitIds = traitIds;
+        }
+        ++batchable.operations;
+        batchable.calls += numCalls;
+        batchable.maxCalls = std::max(batchable.maxCalls, numCalls);
+        if (isNew)
+        {
+            newlyBatchable.push_back(batchable);
+        }
+    }
+}
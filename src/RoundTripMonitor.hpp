@@ -0,0 +1,162 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <openassetio/trait/collection.hpp>
+
+/**
+ * Round trips made by the logical operations (e.g. a cook, a publish)
+ * that start with a given Asset API method.
+ */
+struct OperationRoundTrips
+{
+    /// Asset API method making the first manager call of the
+    /// operations.
+    std::string method;
+    /// Completed operations.
+    std::uint64_t operations = 0;
+    /// Manager calls made by those operations.
+    std::uint64_t roundTrips = 0;
+    /// Most manager calls made by a single operation.
+    std::uint64_t maxRoundTrips = 0;
+    /// Operations that made more manager calls than the budget.
+    std::uint64_t overBudget = 0;
+};
+
+/**
+ * Repeated single-element manager calls, made by the same Asset API
+ * method with the same traits within a logical operation, which could
+ * have been a single batched call, i.e. an N+1 query pattern.
+ */
+struct BatchableCalls
+{
+    /// Asset API method making the calls.
+    std::string method;
+    /// Manager method called, e.g. "resolve".
+    std::string managerCall;
+    /// Sorted IDs of the traits queried.
+    std::vector<std::string> traitIds;
+    /// Operations in which the calls were found.
+    std::uint64_t operations = 0;
+    /// Single-element calls made by those operations.
+    std::uint64_t calls = 0;
+    /// Most single-element calls made by a single operation.
+    std::uint64_t maxCalls = 0;
+};
+
+/**
+ * Groups manager round trips into logical operations, and accounts for
+ * the round trips each operation makes, to find where batching would
+ * reduce them.
+ *
+ * Katana makes Asset API calls one item at a time, in bursts, e.g.
+ * whilst cooking a scene or opening a project. An operation is a burst
+ * of calls made by the same thread, ending once the thread makes no
+ * call for longer than a gap. Within each operation, single-element
+ * calls to the same manager method with the same traits, on behalf of
+ * the same Asset API method, are counted, and reported as batchable
+ * once they reach a threshold.
+ *
+ * Operations are completed lazily, as their thread makes its next call
+ * or when reports are requested. Safe to use from any thread.
+ *
+ * Grouping calls into operations takes a lock and allocates per call,
+ * so is only done if a batchable threshold or round trip budget is
+ * given. Otherwise, only the number of round trips is counted.
+ */
+class RoundTripMonitor
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param operationGap Time a thread must make no manager calls for
+     * its operation to be complete.
+     * @param batchableThreshold Number of single-element calls within
+     * an operation for them to be reported as batchable. 0 disables
+     * detection.
+     * @param roundTripBudget Manager calls an operation is expected to
+     * make at most. 0 for no budget.
+     */
+    RoundTripMonitor(std::chrono::milliseconds operationGap,
+                     std::size_t batchableThreshold,
+                     std::size_t roundTripBudget);
+
+    /**
+     * Record a manager call made by the calling thread. Only counted,
+     * unless enabled.
+     *
+     * @param method Asset API method making the call.
+     * @param managerCall Manager method called.
+     * @param numElements Number of entity references (or trait sets) in
+     * the call.
+     * @param traitSet Traits queried, if any.
+     * @param now Time of the call.
+     *
+     * @return Batchable calls found for the first time as a result of
+     * completing the thread's previous operation, e.g. to be logged.
+     */
+    std::vector<BatchableCalls> record(std::string_view method,
+                                       std::string_view managerCall,
+                                       std::size_t numElements,
+                                       const openassetio::trait::TraitSet& traitSet,
+                                       Clock::time_point now = Clock::now());
+
+    /**
+     * Complete the operations of all threads idle for longer than the
+     * gap.
+     *
+     * @return As per record.
+     */
+    std::vector<BatchableCalls> completeIdle(Clock::time_point now = Clock::now());
+
+    /// Round trips of completed operations, by the method starting them.
+    [[nodiscard]] std::vector<OperationRoundTrips> operationRoundTrips() const;
+
+    /// Batchable calls found in completed operations.
+    [[nodiscard]] std::vector<BatchableCalls> batchableCalls() const;
+
+    /// Manager calls recorded.
+    [[nodiscard]] std::uint64_t numRoundTrips() const;
+
+    /// Whether calls are grouped into operations, see class docs.
+    [[nodiscard]] bool isEnabled() const;
+
+private:
+    /// Asset API method, manager method and sorted trait IDs.
+    using CallKey = std::tuple<std::string, std::string, std::vector<std::string>>;
+
+    struct Operation
+    {
+        std::string method;
+        Clock::time_point lastCall;
+        std::uint64_t roundTrips = 0;
+        std::map<CallKey, std::uint64_t> singleElementCalls;
+    };
+
+    void complete(const Operation& operation, std::vector<BatchableCalls>& newlyBatchable);
+
+    const std::chrono::milliseconds operationGap_;
+    const std::size_t batchableThreshold_;
+    const std::size_t roundTripBudget_;
+
+    std::atomic<std::uint64_t> numRoundTrips_{0};
+    mutable std::mutex mutex_;
+    std::unordered_map<std::thread::id, Operation> operations_;
+    std::map<std::string, OperationRoundTrips, std::less<>> operationRoundTrips_;
+    std::map<CallKey, BatchableCalls> batchableCalls_;
+};
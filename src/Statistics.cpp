@@ -0,0 +1,101 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "Statistics.hpp"
+
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+const std::vector<double> Histogram::kDurationBounds{
+    0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05,
+    0.1,    0.25,    0.5,    1,     2.5,    5,     10,   30,    60};
+
+const std::vector<double> Histogram::kBatchSizeBounds{
+    1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 4096, 16384};
+
+Histogram::Histogram(std::vector<double> upperBounds)
+    : upperBounds_{std::move(upperBounds)}, bucketCounts_(upperBounds_.size() + 1)
+{
+}
+
+void Histogram::observe(const double value)
+{
+    const auto bucketIt = std::lower_bound(upperBounds_.begin(), upperBounds_.end(), value);
+    bucketCounts_[static_cast<std::size_t>(bucketIt - upperBounds_.begin())].increment();
+
+    // No atomic fetch_add for floating point until C++20.
+    double sum = sum_.load(std::memory_order_relaxed);
+    while (!sum_.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed))
+    {
+    }
+}
+
+std::vector<std::uint64_t> Histogram::bucketCounts() const
+{
+    std::vector<std::uint64_t> counts;
+    counts.reserve(bucketCounts_.size());
+    for (const Counter& bucketCount : bucketCounts_)
+    {
+        counts.push_back(bucketCount.value());
+    }
+    return counts;
+}
+
+std::uint64_t Histogram::count() const
+{
+    const std::vector<std::uint64_t> counts = bucketCounts();
+    return std::accumulate(counts.begin(), counts.end(), std::uint64_t{0});
+}
+
+double Histogram::quantile(const double fraction) const
+{
+    const std::vector<std::uint64_t> counts = bucketCounts();
+    const std::uint64_t total = std::accumulate(counts.begin(), counts.end(), std::uint64_t{0});
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    const double rank = std::clamp(fraction, 0.0, 1.0) * static_cast<double>(total);
+    std::uint64_t cumulative = 0;
+    for (std::size_t idx = 0; idx < upperBounds_.size(); ++idx)
+    {
+        const std::uint64_t previous = cumulative;
+        cumulative += counts[idx];
+        if (counts[idx] != 0 && static_cast<double>(cumulative) >= rank)
+        {
+            const double lowerBound = idx == 0 ? std::min(0.0, upperBounds_[0])
+                                               : upperBounds_[idx - 1];
+            return lowerBound + (upperBounds_[idx] - lowerBound) *
+                                    (rank - static_cast<double>(previous)) /
+                                    static_cast<double>(counts[idx]);
+        }
+    }
+    return upperBounds_.empty() ? 0 : upperBounds_.back();
+}
+
+HistogramFamily::HistogramFamily(std::vector<std::string> labelNames,
+                                 std::vector<double> upperBounds)
+    : labelNames_{std::move(labelNames)}, upperBounds_{std::move(upperBounds)}
+{
+}
+
+Histogram& HistogramFamily::get(const std::initializer_list<std::string_view> labelValues)
+{
+    {
+        const std::shared_lock lock{mutex_};
+        if (const auto histogramIt = histograms_.find(labelValues);
+            histogramIt != histograms_.end())
+        {
+            return histogramIt->second;
+        }
+    }
+    const std::unique_lock lock{mutex_};
+    return histograms_
+        .emplace(std::piecewise_construct,
+                 std::forward_as_tuple(labelValues.begin(), labelValues.end()),
+                 std::forward_as_tuple(upperBounds_))
+        .first->second;
+}
@@ -0,0 +1,301 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Monotonically increasing event count, safe to update from any
+ * thread.
+ *
+ * Counts are for diagnostics only, so no ordering with respect to other
+ * memory operations is guaranteed.
+ */
+class Counter
+{
+public:
+    void increment(const std::uint64_t count = 1)
+    {
+        value_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> value_{0};
+};
+
+/**
+ * Distribution of observed values, e.g. latencies, counted in buckets
+ * with fixed upper bounds, safe to update from any thread.
+ *
+ * As per Counter, for diagnostics only, so a snapshot of the buckets
+ * taken whilst values are being observed may be slightly inconsistent.
+ */
+class Histogram
+{
+public:
+    /// Bounds suitable for durations, in seconds.
+    static const std::vector<double> kDurationBounds;
+    /// Bounds suitable for the number of elements in a batch.
+    static const std::vector<double> kBatchSizeBounds;
+
+    /**
+     * @param upperBounds Ascending, inclusive, upper bounds of each
+     * bucket. A further bucket counts values above all of them.
+     */
+    explicit Histogram(std::vector<double> upperBounds);
+
+    void observe(double value);
+
+    [[nodiscard]] const std::vector<double>& upperBounds() const { return upperBounds_; }
+
+    /// Count of values in each bucket, i.e. not cumulative, the last
+    /// being that of values above all upper bounds.
+    [[nodiscard]] std::vector<std::uint64_t> bucketCounts() const;
+
+    [[nodiscard]] std::uint64_t count() const;
+
+    [[nodiscard]] double sum() const { return sum_.load(std::memory_order_relaxed); }
+
+    /**
+     * Estimate a quantile, e.g. 0.99, by interpolating within the
+     * bucket containing it. Quantiles in the last bucket are estimated
+     * as the largest upper bound. 0 if no values have been observed.
+     */
+    [[nodiscard]] double quantile(double fraction) const;
+
+private:
+    const std::vector<double> upperBounds_;
+    std::vector<Counter> bucketCounts_;
+    std::atomic<double> sum_{0};
+};
+
+/**
+ * Histograms of the same quantity, one per distinct combination of
+ * label values, e.g. per Asset API method, safe to use from any
+ * thread.
+ */
+class HistogramFamily
+{
+public:
+    using LabelValues = std::vector<std::string>;
+
+    /**
+     * @param labelNames Names of the labels distinguishing histograms.
+     * @param upperBounds Bucket bounds of each histogram.
+     */
+    HistogramFamily(std::vector<std::string> labelNames, std::vector<double> upperBounds);
+
+    [[nodiscard]] const std::vector<std::string>& labelNames() const { return labelNames_; }
+
+    /**
+     * Histogram for the given label values, in the order of the label
+     * names, created on first use. It remains valid for the lifetime of
+     * the family.
+     */
+    Histogram& get(std::initializer_list<std::string_view> labelValues);
+
+    /**
+     * Call `fn(const LabelValues&, const Histogram&)` for each
+     * histogram, in label value order.
+     */
+    template <class Fn>
+    void forEach(Fn&& fn) const
+    {
+        const std::shared_lock lock{mutex_};
+        for (const auto& [labelValues, histogram] : histograms_)
+        {
+            fn(labelValues, histogram);
+        }
+    }
+
+private:
+    /// Allows lookup by label values without allocating.
+    struct LabelValuesLess
+    {
+        using is_transparent = void;
+
+        template <class Lhs, class Rhs>
+        bool operator()(const Lhs& lhs, const Rhs& rhs) const
+        {
+            return std::lexicographical_compare(
+                std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+        }
+    };
+
+    const std::vector<std::string> labelNames_;
+    const std::vector<double> upperBounds_;
+    mutable std::shared_mutex mutex_;
+    std::map<LabelValues, Histogram, LabelValuesLess> histograms_;
+};
+
+/**
+ * Observes the time from construction to destruction, in seconds.
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : histogram_{histogram}, start_{std::chrono::steady_clock::now()}
+    {
+    }
+
+    ~ScopedTimer()
+    {
+        histogram_.observe(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    ScopedTimer(ScopedTimer&&) = delete;
+    ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+private:
+    Histogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * Counts of lookups of recently encountered errors, see
+ * OpenAssetIOAsset::negativeCache_.
+ */
+struct NegativeCacheStats
+{
+    /// Lookups answered with a cached error, without a manager call.
+    Counter hits;
+    /// Lookups finding no cached error.
+    Counter misses;
+};
+
+/**
+ * Counts of resolved path cache lookups and refreshes.
+ */
+struct PathCacheStats
+{
+    /// Lookups served from a fresh entry.
+    Counter hits;
+    /// Lookups served from an entry older than the soft TTL.
+    Counter staleHits;
+    /// Lookups requiring a synchronous resolve.
+    Counter misses;
+    /// Entries added for references to a specific version, which are
+    /// kept indefinitely.
+    Counter immutableInserts;
+    /// Entries added for references to a meta-version, or without
+    /// version information, which expire.
+    Counter mutableInserts;
+    /// Batched resolves issued by the background refresher.
+    Counter refreshBatches;
+    /// Entries successfully refreshed in the background.
+    Counter refreshes;
+    /// Entries that failed to refresh in the background, and so were
+    /// evicted.
+    Counter refreshFailures;
+    /// Entries retained when the plugin was reset, i.e. those for
+    /// references to a specific version.
+    Counter retainedOnReset;
+    /// Retained entries re-resolved in the background, and found to be
+    /// unchanged.
+    Counter revalidations;
+    /// Retained entries re-resolved in the background, and found to
+    /// have changed or become unresolvable. Any such entry causes all
+    /// cached paths to be discarded.
+    Counter revalidationMismatches;
+};
+
+/**
+ * Counts of manager calls subject to a deadline that did not complete
+ * normally.
+ */
+struct ManagerCallStats
+{
+    /// Calls abandoned after their deadline passed.
+    Counter timeouts;
+    /// Calls not attempted, since the manager has repeatedly failed to
+    /// respond in time.
+    Counter rejections;
+    /// Calls attempted to check whether an unresponsive manager has
+    /// recovered.
+    Counter probes;
+    /// Failed calls for which a previously cached result was returned.
+    Counter lastKnownGoodFallbacks;
+};
+
+/**
+ * Counts of references found by scanning files, and prefetched.
+ */
+struct PrefetchStats
+{
+    /// Files scanned.
+    Counter scans;
+    /// Unique candidate references found in scanned files.
+    Counter referencesFound;
+    /// Valid references queued for prefetch, i.e. not already cached.
+    Counter requested;
+    /// Batched resolves issued.
+    Counter batches;
+    /// References successfully resolved and cached.
+    Counter resolved;
+    /// References that failed to resolve.
+    Counter failures;
+};
+
+/**
+ * Counts of pages retrieved by paged manager queries, and changes to
+ * the adaptive page size.
+ */
+struct PagingStats
+{
+    /// Paged queries made.
+    Counter queries;
+    /// Pages retrieved, including the final (possibly empty) page.
+    Counter pages;
+    /// Times the page size was increased.
+    Counter pageSizeIncreases;
+    /// Times the page size was decreased.
+    Counter pageSizeDecreases;
+};
+
+/**
+ * Counts of reads served from, and writes rejected by, read-only mode.
+ */
+struct ReadOnlyStats
+{
+    /// Resolves served from cached traits.
+    Counter traitsHits;
+    /// Resolves requiring a manager call.
+    Counter traitsMisses;
+    /// Other queries (entity traits, versions) served from the cache.
+    Counter queryHits;
+    /// Other queries requiring a manager call.
+    Counter queryMisses;
+    /// Calls to write APIs that were rejected.
+    Counter rejectedWrites;
+};
+
+/**
+ * Counts of traits fetched speculatively for predicted follow-up calls.
+ */
+struct SpeculationStats
+{
+    /// Follow-up calls observed for the same reference.
+    Counter successorsObserved;
+    /// Manager queries extended with speculative traits.
+    Counter speculations;
+    /// Follow-up calls served from speculatively fetched traits.
+    Counter hits;
+};
@@ -0,0 +1,161 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include "UrlPathConverter.hpp"
+
+#include <array>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define KATANAOPENASSETIO_HAS_SSE2
+#endif
+
+namespace
+{
+constexpr std::string_view kFastPathUrlPrefix = "file://";
+
+// Characters of a URL path that do not require decoding, other than
+// alphanumerics: the RFC 3986 unreserved and sub-delimiter characters,
+// plus ':', '@' and '/'. Anything else, notably '%', '?' and '#', is
+// left to the full converter, as are paths with empty or dot segments,
+// which may be normalised.
+template <char... kChars>
+struct CharSet
+{
+    static constexpr std::array<char, sizeof...(kChars)> kArray{kChars...};
+
+#ifdef KATANAOPENASSETIO_HAS_SSE2
+    /// Mask of the bytes of a chunk that are in the set.
+    static __m128i matches(const __m128i chunk)
+    {
+        __m128i isMatch = _mm_setzero_si128();
+        ((isMatch = _mm_or_si128(isMatch, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(kChars)))), ...);
+        return isMatch;
+    }
+#endif
+};
+
+using DisallowedPrintable = CharSet<'"', '#', '%', '<', '>', '?', '\\', '^', '`', '{', '|', '}'>;
+
+constexpr std::array<bool, 256> kIsAllowed = []
+{
+    std::array<bool, 256> isAllowed{};
+    for (std::size_t chr = '!'; chr <= '~'; ++chr)
+    {
+        isAllowed[chr] = true;
+    }
+    for (const char chr : DisallowedPrintable::kArray)
+    {
+        isAllowed[static_cast<unsigned char>(chr)] = false;
+    }
+    return isAllowed;
+}();
+
+/**
+ * Whether a URL path can be used as-is, i.e. all its characters are
+ * allowed, and it has no empty or dot segments requiring
+ * normalisation.
+ */
+bool isVerbatimPath(const std::string_view str)
+{
+    std::size_t pos = 0;
+    bool isPrevSlash = false;
+#ifdef KATANAOPENASSETIO_HAS_SSE2
+    // Check 16 characters at a time, for a range of printable ASCII
+    // excluding a few specific characters, and for '/' followed by '/'
+    // or '.'.
+    const __m128i lowerBound = _mm_set1_epi8(' ');
+    const __m128i upperBound = _mm_set1_epi8('\x7f');
+    const __m128i slash = _mm_set1_epi8('/');
+    const __m128i dot = _mm_set1_epi8('.');
+    __m128i isDisallowed = _mm_setzero_si128();
+    int prevSlashBit = 0;
+    for (; pos + 16 <= str.size(); pos += 16)
+    {
+        // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + pos));
+        // Signed comparison, so bytes >= 0x80 are also out of range.
+        const __m128i isInRange =
+            _mm_and_si128(_mm_cmpgt_epi8(chunk, lowerBound), _mm_cmplt_epi8(chunk, upperBound));
+        isDisallowed = _mm_or_si128(isDisallowed, _mm_xor_si128(isInRange, _mm_set1_epi8(-1)));
+        isDisallowed = _mm_or_si128(isDisallowed, DisallowedPrintable::matches(chunk));
+
+        const __m128i isSlash = _mm_cmpeq_epi8(chunk, slash);
+        const int slashBits = _mm_movemask_epi8(isSlash);
+        const int slashOrDotBits =
+            _mm_movemask_epi8(_mm_or_si128(isSlash, _mm_cmpeq_epi8(chunk, dot)));
+        if ((((slashBits << 1) | prevSlashBit) & slashOrDotBits) != 0)
+        {
+            return false;
+        }
+        prevSlashBit = (slashBits >> 15) & 1;
+    }
+    if (_mm_movemask_epi8(isDisallowed) != 0)
+    {
+        return false;
+    }
+    isPrevSlash = prevSlashBit != 0;
+#endif
+    for (; pos < str.size(); ++pos)
+    {
+        const char chr = str[pos];
+        if (!kIsAllowed[static_cast<unsigned char>(chr)] ||
+            (isPrevSlash && (chr == '/' || chr == '.')))
+        {
+            return false;
+        }
+        isPrevSlash = chr == '/';
+    }
+    return true;
+}
+}  // namespace
+
+UrlPathConverter::UrlPathConverter(FileUrlPathConverterPtr fileUrlPathConverter,
+                                   CacheMemoryBudget* budget)
+    : fileUrlPathConverter_{std::move(fileUrlPathConverter)}, memo_{budget}
+{
+}
+
+std::optional<std::string_view> UrlPathConverter::fastPathFromUrl(const std::string_view url)
+{
+#ifdef _WIN32
+    // Drive letters and UNC hosts require conversion.
+    (void)url;
+    return std::nullopt;
+#else
+    if (url.substr(0, kFastPathUrlPrefix.size()) != kFastPathUrlPrefix)
+    {
+        return std::nullopt;
+    }
+    // Path must immediately follow, i.e. no host.
+    const std::string_view path = url.substr(kFastPathUrlPrefix.size());
+    if (path.empty() || path.front() != '/' || !isVerbatimPath(path))
+    {
+        return std::nullopt;
+    }
+    return path;
+#endif
+}
+
+std::string UrlPathConverter::pathFromUrl(const std::string_view url)
+{
+    if (const auto path = fastPathFromUrl(url))
+    {
+        stats_.fastPaths.increment();
+        return std::string{*path};
+    }
+
+    const std::string urlStr{url};
+    if (auto memoised = memo_.visit(
+            urlStr, 0, [](const MemoisedPath& memoisedPath) { return memoisedPath.path; }))
+    {
+        stats_.memoHits.increment();
+        return std::move(*memoised);
+    }
+
+    stats_.fullConversions.increment();
+    std::string path = fileUrlPathConverter_->pathFromUrl(url);
+    memo_.put(urlStr, 0, MemoisedPath{path}, ReferenceCache<MemoisedPath>::kNeverExpires);
+    return path;
+}
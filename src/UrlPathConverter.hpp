@@ -0,0 +1,94 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <openassetio/utils/path.hpp>
+
+#include "CacheMemoryBudget.hpp"
+#include "ReferenceCache.hpp"
+#include "Statistics.hpp"
+
+/**
+ * Counts of file URL to path conversions, by how they were served.
+ */
+struct UrlConversionStats
+{
+    /// URLs converted by slicing, without decoding.
+    Counter fastPaths;
+    /// URLs whose conversion was previously memoised.
+    Counter memoHits;
+    /// URLs converted by OpenAssetIO's FileUrlPathConverter.
+    Counter fullConversions;
+};
+
+/**
+ * Converts file URLs to paths, avoiding the cost of full URL parsing
+ * and percent-decoding where possible.
+ *
+ * Most URLs returned by managers are of the form `file:///some/path`,
+ * consisting only of characters that need no decoding. Such URLs are
+ * detected with a single (vectorised, where supported) scan, and the
+ * path sliced directly from the URL. Other URLs are converted by
+ * OpenAssetIO's FileUrlPathConverter, and the result memoised.
+ */
+class UrlPathConverter
+{
+public:
+    using FileUrlPathConverterPtr = std::shared_ptr<openassetio::utils::FileUrlPathConverter>;
+
+    /**
+     * @param fileUrlPathConverter Converter for URLs not handled by the
+     * fast path.
+     * @param budget Memory budget for memoised conversions, if any.
+     */
+    explicit UrlPathConverter(FileUrlPathConverterPtr fileUrlPathConverter,
+                              CacheMemoryBudget* budget = nullptr);
+
+    /**
+     * Convert a file URL to a path in the format of the current
+     * platform.
+     *
+     * @throws openassetio::errors::InputValidationException If the URL
+     * is invalid, as per FileUrlPathConverter::pathFromUrl.
+     */
+    [[nodiscard]] std::string pathFromUrl(std::string_view url);
+
+    [[nodiscard]] const UrlConversionStats& stats() const { return stats_; }
+
+    /// Number of memoised conversions.
+    [[nodiscard]] std::size_t memoSize() const { return memo_.size(); }
+
+    /// Bytes used by memoised conversions.
+    [[nodiscard]] std::size_t memoMemoryUsage() const { return memo_.memoryUsage(); }
+
+    /// Number of memoised conversions evicted.
+    [[nodiscard]] std::uint64_t memoEvictions() const { return memo_.evictions(); }
+
+    /**
+     * Path of a URL that can be converted by slicing alone, if any.
+     *
+     * Exposed for testing.
+     */
+    [[nodiscard]] static std::optional<std::string_view> fastPathFromUrl(std::string_view url);
+
+private:
+    struct MemoisedPath
+    {
+        std::string path;
+
+        [[nodiscard]] std::size_t memoryUsage() const { return heapBytes(path); }
+    };
+
+    FileUrlPathConverterPtr fileUrlPathConverter_;
+    /// Conversions of URLs not handled by the fast path, keyed by URL.
+    ReferenceCache<MemoisedPath> memo_;
+    UrlConversionStats stats_;
+};
@@ -13,4 +13,6 @@ inline const std::string kEntityReference = "__entityReference";
 inline const std::string kManagerDrivenValue = "__managerDrivenValue";
 constexpr std::string_view kAssetIdManagerDrivenValueSep = "#value=";
 constexpr std::size_t kPageSize{256};
+/// Maximum number of frames expanded by the resolvePathRange command.
+constexpr std::size_t kMaxRangeFrames{1000000};
 };  // namespace constants
\ No newline at end of file
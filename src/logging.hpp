@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <FnAsset/plugin/FnAsset.h>
@@ -79,6 +80,16 @@ inline std::string toString(const char* str)
     return str;
 }
 
+/**
+ * Convert a string view to a string, unmodified.
+ *
+ * As for char arrays, used for non-value strings (e.g. function names).
+ */
+inline std::string toString(const std::string_view str)
+{
+    return std::string{str};
+}
+
 /**
  * Surround a string in single quotes.
  *
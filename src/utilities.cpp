@@ -3,7 +3,17 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "utilities.hpp"
 
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 #include <FnAsset/plugin/FnAsset.h>
 
@@ -21,6 +31,18 @@ bool getBooleanValue(const FnKat::Asset::StringMap& args, const std::string& key
     }
     return iter->second == "True";
 }
+
+std::optional<std::chrono::milliseconds> parseMilliseconds(const std::string_view valueStr)
+{
+    std::uint32_t value = 0;
+    const char* const end = valueStr.data() + valueStr.size();
+    if (const auto result = std::from_chars(valueStr.data(), end, value);
+        result.ec != std::errc{} || result.ptr != end)
+    {
+        return std::nullopt;
+    }
+    return std::chrono::milliseconds{value};
+}
 }  // anonymous namespace
 
 bool shouldVersionUp(const FnKat::Asset::StringMap& args)
@@ -32,4 +54,64 @@ bool shouldPublish(const FnKat::Asset::StringMap& args)
 {
     return getBooleanValue(args, "publish");
 }
+
+std::chrono::milliseconds millisecondsFromEnvVar(const char* envVarName,
+                                                 const std::chrono::milliseconds defaultValue)
+{
+    const char* envVarValue = std::getenv(envVarName);
+    if (envVarValue == nullptr)
+    {
+        return defaultValue;
+    }
+    return parseMilliseconds(envVarValue).value_or(defaultValue);
+}
+
+std::size_t sizeFromEnvVar(const char* envVarName, const std::size_t defaultValue)
+{
+    const char* envVarValue = std::getenv(envVarName);
+    if (envVarValue == nullptr)
+    {
+        return defaultValue;
+    }
+    const std::string_view valueStr{envVarValue};
+    std::size_t value = 0;
+    const char* const end = valueStr.data() + valueStr.size();
+    if (const auto result = std::from_chars(valueStr.data(), end, value);
+        result.ec != std::errc{} || result.ptr != end)
+    {
+        return defaultValue;
+    }
+    return value;
+}
+
+std::map<std::string, std::chrono::milliseconds, std::less<>> namedMillisecondsFromEnvVar(
+    const char* envVarName)
+{
+    std::map<std::string, std::chrono::milliseconds, std::less<>> durations;
+
+    const char* envVarValue = std::getenv(envVarName);
+    if (envVarValue == nullptr)
+    {
+        return durations;
+    }
+
+    std::string_view remaining{envVarValue};
+    while (!remaining.empty())
+    {
+        const std::size_t itemEnd = remaining.find(',');
+        const std::string_view item = remaining.substr(0, itemEnd);
+        remaining.remove_prefix(itemEnd == std::string_view::npos ? remaining.size() : itemEnd + 1);
+
+        const std::size_t sep = item.find('=');
+        if (sep == std::string_view::npos || sep == 0)
+        {
+            continue;
+        }
+        if (const auto duration = parseMilliseconds(item.substr(sep + 1)))
+        {
+            durations.insert_or_assign(std::string{item.substr(0, sep)}, *duration);
+        }
+    }
+    return durations;
+}
 }  // namespace utilities
@@ -3,6 +3,12 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
 #include <FnAsset/plugin/FnAsset.h>
 
 namespace utilities
@@ -16,4 +22,20 @@ bool shouldVersionUp(const FnKat::Asset::StringMap& args);
 // indicating that the user has requested this version set as the latest
 // version.
 bool shouldPublish(const FnKat::Asset::StringMap& args);
+
+// Returns the duration, in milliseconds, given by the named environment
+// variable, or defaultValue if it is unset or not a non-negative
+// integer.
+std::chrono::milliseconds millisecondsFromEnvVar(const char* envVarName,
+                                                 std::chrono::milliseconds defaultValue);
+
+// Returns the count given by the named environment variable, or
+// defaultValue if it is unset or not a non-negative integer.
+std::size_t sizeFromEnvVar(const char* envVarName, std::size_t defaultValue);
+
+// Returns the durations, in milliseconds, given by the named
+// environment variable as a comma-separated list of `name=value`
+// pairs. Malformed pairs are skipped.
+std::map<std::string, std::chrono::milliseconds, std::less<>> namedMillisecondsFromEnvVar(
+    const char* envVarName);
 }  // namespace utilities
@@ -0,0 +1,167 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "AssetIdFilter.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+namespace
+{
+constexpr std::string_view kPrefix = "bal:///";
+
+/**
+ * Stand-in for a manager's isEntityReferenceString, counting calls.
+ */
+struct FakeManager
+{
+    std::size_t numCalls = 0;
+
+    bool operator()(const std::string& str)
+    {
+        ++numCalls;
+        return AssetIdFilter::hasPrefix(str, kPrefix);
+    }
+};
+}  // namespace
+
+SCENARIO("Checking whether strings are entity references")
+{
+    AssetIdFilter filter;
+    FakeManager manager;
+    constexpr AssetIdFilter::Generation kGeneration = 1;
+
+    GIVEN("a manager that advertises an entity reference prefix")
+    {
+        const std::optional<std::string> prefix{kPrefix};
+
+        WHEN("strings are checked")
+        {
+            const bool isRef = filter.isEntityReferenceString(
+                "bal:///cat", kGeneration, prefix, std::ref(manager));
+            const bool isNotRef = filter.isEntityReferenceString(
+                "/some/path/bal:///", kGeneration, prefix, std::ref(manager));
+            const bool isTooShort =
+                filter.isEntityReferenceString("bal:/", kGeneration, prefix, std::ref(manager));
+
+            THEN("the prefix alone determines the result")
+            {
+                CHECK(isRef);
+                CHECK_FALSE(isNotRef);
+                CHECK_FALSE(isTooShort);
+                CHECK(manager.numCalls == 0);
+                CHECK(filter.stats().prefixChecks.value() == 3);
+            }
+        }
+    }
+
+    GIVEN("a manager that does not advertise an entity reference prefix")
+    {
+        const std::optional<std::string> prefix;
+        const std::string str = GENERATE("bal:///cat", "/some/path");
+        const bool expected = AssetIdFilter::hasPrefix(str, kPrefix);
+
+        WHEN("a string is checked for the first time")
+        {
+            const bool result =
+                filter.isEntityReferenceString(str, kGeneration, prefix, std::ref(manager));
+
+            THEN("the manager is asked, but the result is not memoised")
+            {
+                CHECK(result == expected);
+                CHECK(manager.numCalls == 1);
+                CHECK(filter.stats().firstSightings.value() == 1);
+                CHECK(filter.memoSize() == 0);
+            }
+
+            AND_WHEN("the string is checked repeatedly")
+            {
+                for (std::size_t idx = 0; idx < 3; ++idx)
+                {
+                    CHECK(filter.isEntityReferenceString(
+                              str, kGeneration, prefix, std::ref(manager)) == expected);
+                }
+
+                THEN("the manager is asked once more, then the result is memoised")
+                {
+                    CHECK(manager.numCalls == 2);
+                    CHECK(filter.stats().managerChecks.value() == 1);
+                    CHECK(filter.stats().memoHits.value() == 2);
+                    CHECK(filter.memoSize() == 1);
+                }
+            }
+
+            AND_WHEN("the string is checked with a different manager configuration")
+            {
+                const bool newResult = filter.isEntityReferenceString(
+                    str, kGeneration + 1, prefix, std::ref(manager));
+
+                THEN("the string is treated as unseen")
+                {
+                    CHECK(newResult == expected);
+                    CHECK(manager.numCalls == 2);
+                    CHECK(filter.stats().firstSightings.value() == 2);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Blocked Bloom filter")
+{
+    BlockedBloomFilter filter{100};
+
+    CHECK(filter.memoryUsage() == 128 * 64);
+
+    std::vector<std::uint64_t> hashes;
+    for (std::uint64_t idx = 0; idx < 1000; ++idx)
+    {
+        hashes.push_back(idx * 0x9e3779b97f4a7c15ULL);
+        filter.insert(hashes.back());
+    }
+    for (const std::uint64_t hash : hashes)
+    {
+        CHECK(filter.mayContain(hash));
+    }
+
+    filter.clear();
+    std::size_t numFalsePositives = 0;
+    for (const std::uint64_t hash : hashes)
+    {
+        numFalsePositives += filter.mayContain(hash) ? 1 : 0;
+    }
+    CHECK(numFalsePositives == 0);
+}
+
+TEST_CASE("Entity reference checks", "[.][benchmark]")
+{
+    AssetIdFilter filter;
+    const std::optional<std::string> prefix{kPrefix};
+    const std::optional<std::string> noPrefix;
+    const std::string str = "/jobs/show/sequences/sq010/shots/sh0100/lighting/beauty.1001.exr";
+    auto isEntityReferenceString = [](const std::string& candidate)
+    { return AssetIdFilter::hasPrefix(candidate, kPrefix); };
+
+    BENCHMARK("Prefix check")
+    {
+        return filter.isEntityReferenceString(str, 0, prefix, isEntityReferenceString);
+    };
+    BENCHMARK("Memoised check")
+    {
+        return filter.isEntityReferenceString(str, 0, noPrefix, isEntityReferenceString);
+    };
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
@@ -0,0 +1,94 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "ChangeReport.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+SCENARIO("Reporting references that resolve differently")
+{
+    ChangeReport report;
+
+    THEN("no report is complete until one is begun")
+    {
+        CHECK_FALSE(report.isComplete());
+    }
+
+    GIVEN("a report begun with the previous results of several references")
+    {
+        report.begin({{"ref:///unchanged", {"/path/a.v1.exr", "1"}},
+                      {"ref:///newVersion", {"/path/b.v1.exr", "1"}},
+                      {"ref:///removed", {"/path/c.v1.exr", "1"}}});
+
+        WHEN("the current results of some references are recorded")
+        {
+            CHECK_FALSE(report.record("ref:///unchanged", {"/path/a.v1.exr", "1"}));
+            CHECK_FALSE(report.record("ref:///newVersion", {"/path/b.v2.exr", "2"}));
+
+            THEN("only changed references are reported, and the report is incomplete")
+            {
+                CHECK_FALSE(report.isComplete());
+                CHECK(report.numChecked() == 2);
+
+                const std::vector<ReferenceChange> changes = report.changes();
+                REQUIRE(changes.size() == 1);
+                CHECK(changes[0].entityReference == "ref:///newVersion");
+                CHECK(changes[0].previousPath == "/path/b.v1.exr");
+                CHECK(changes[0].path == "/path/b.v2.exr");
+                CHECK(changes[0].previousVersion == "1");
+                CHECK(changes[0].version == "2");
+            }
+
+            AND_WHEN("the remaining reference is recorded as unresolvable")
+            {
+                const bool isCompleted = report.recordUnresolvable("ref:///removed");
+
+                THEN("the report is complete, and the reference reported with no path")
+                {
+                    CHECK(isCompleted);
+                    CHECK(report.isComplete());
+
+                    const std::vector<ReferenceChange> changes = report.changes();
+                    REQUIRE(changes.size() == 2);
+                    CHECK(changes[1].entityReference == "ref:///removed");
+                    CHECK(changes[1].path.empty());
+                }
+            }
+        }
+
+        WHEN("results are recorded for references not in the report")
+        {
+            CHECK_FALSE(report.record("ref:///other", {"/path/d.v1.exr", "1"}));
+            CHECK_FALSE(report.record("ref:///newVersion", {"/path/b.v2.exr", "2"}));
+            CHECK_FALSE(report.record("ref:///newVersion", {"/path/b.v3.exr", "3"}));
+
+            THEN("they are ignored, as are repeated results")
+            {
+                CHECK(report.numChecked() == 1);
+                REQUIRE(report.changes().size() == 1);
+                CHECK(report.changes()[0].version == "2");
+            }
+        }
+
+        WHEN("a new report is begun")
+        {
+            report.record("ref:///newVersion", {"/path/b.v2.exr", "2"});
+            report.begin({});
+
+            THEN("the previous report is discarded")
+            {
+                CHECK(report.isComplete());
+                CHECK(report.numChecked() == 0);
+                CHECK(report.changes().empty());
+            }
+        }
+    }
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
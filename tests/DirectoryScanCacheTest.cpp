@@ -0,0 +1,147 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "DirectoryScanCache.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+namespace
+{
+std::filesystem::path createTempDir()
+{
+    auto tempDir = std::filesystem::temp_directory_path() /
+                   ("katana_openassetio_scan_test_" + std::to_string(std::rand()));
+    std::filesystem::create_directories(tempDir);
+    return tempDir;
+}
+
+std::set<std::string> listFiles(DirectoryScanCache& cache, const std::filesystem::path& directory)
+{
+    std::set<std::string> files;
+    cache.forEachFile(directory, [&](const std::string_view name) { files.emplace(name); });
+    return files;
+}
+}  // namespace
+
+SCENARIO("Caching directory listings")
+{
+    const std::filesystem::path directory = createTempDir();
+    std::ofstream{directory / "beauty.1001.exr"};
+    std::filesystem::create_directory(directory / "subdir");
+
+    GIVEN("a cache")
+    {
+        DirectoryScanCache cache{2};
+
+        WHEN("a directory is listed")
+        {
+            const auto files = listFiles(cache, directory);
+
+            THEN("its regular files are listed from a scan")
+            {
+                CHECK(files == std::set<std::string>{"beauty.1001.exr"});
+                CHECK(cache.stats().scans.value() == 1);
+                CHECK(cache.size() == 1);
+            }
+
+            AND_WHEN("the directory is listed again, unchanged")
+            {
+                const auto relisted = listFiles(cache, directory);
+
+                THEN("the cached listing is used")
+                {
+                    CHECK(relisted == files);
+                    CHECK(cache.stats().scans.value() == 1);
+                    CHECK(cache.stats().hits.value() == 1);
+                }
+            }
+
+            AND_WHEN("files are written, renamed and removed, and the directory listed again")
+            {
+                std::ofstream{directory / "beauty.1002.exr"};
+                std::ofstream{directory / "beauty.1003.tmp"};
+                std::filesystem::rename(directory / "beauty.1003.tmp",
+                                        directory / "beauty.1003.exr");
+                std::filesystem::remove(directory / "beauty.1001.exr");
+                const auto relisted = listFiles(cache, directory);
+
+                THEN("the listing reflects the changes")
+                {
+                    CHECK(relisted == std::set<std::string>{"beauty.1002.exr", "beauty.1003.exr"});
+#ifdef __linux__
+                    if (cache.numWatched() == 1)
+                    {
+                        // Updated incrementally, rather than rescanned.
+                        CHECK(cache.stats().scans.value() == 1);
+                        CHECK(cache.stats().events.value() == 5);
+                    }
+#endif
+                }
+            }
+        }
+
+        WHEN("more directories are listed than the cache holds")
+        {
+            std::filesystem::create_directory(directory / "a");
+            std::filesystem::create_directory(directory / "b");
+            listFiles(cache, directory);
+            listFiles(cache, directory / "a");
+            listFiles(cache, directory);
+            listFiles(cache, directory / "b");
+
+            THEN("the least recently used is evicted")
+            {
+                CHECK(cache.size() == 2);
+                CHECK(cache.stats().evictions.value() == 1);
+
+                listFiles(cache, directory);
+                CHECK(cache.stats().hits.value() == 2);
+                listFiles(cache, directory / "a");
+                CHECK(cache.stats().scans.value() == 4);
+            }
+        }
+
+        WHEN("a listed directory is removed")
+        {
+            listFiles(cache, directory);
+            std::filesystem::remove_all(directory);
+
+            THEN("listing it again fails")
+            {
+                CHECK_THROWS_AS(listFiles(cache, directory), std::filesystem::filesystem_error);
+            }
+        }
+    }
+
+    GIVEN("a cache limited to no directories")
+    {
+        DirectoryScanCache cache{0};
+
+        WHEN("a directory is listed twice")
+        {
+            listFiles(cache, directory);
+            const auto files = listFiles(cache, directory);
+
+            THEN("it is scanned each time")
+            {
+                CHECK(files == std::set<std::string>{"beauty.1001.exr"});
+                CHECK(cache.stats().scans.value() == 2);
+                CHECK(cache.size() == 0);
+            }
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
@@ -0,0 +1,184 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "MetricsExporter.hpp"
+#include "Statistics.hpp"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+namespace
+{
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream stream{path};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+}  // namespace
+
+SCENARIO("Estimating quantiles from a histogram")
+{
+    Histogram histogram{{1, 2, 4}};
+
+    THEN("quantiles of an empty histogram are zero")
+    {
+        CHECK(histogram.count() == 0);
+        CHECK(histogram.quantile(0.5) == 0);
+    }
+
+    GIVEN("values observed in several buckets")
+    {
+        // Exactly representable, so that no tolerance is needed.
+        for (const double value : {0.5, 1.0, 1.5, 2.0, 3.0, 3.5, 3.75, 4.0})
+        {
+            histogram.observe(value);
+        }
+
+        THEN("they are counted in the bucket with the lowest inclusive upper bound")
+        {
+            CHECK(histogram.bucketCounts() == std::vector<std::uint64_t>{2, 2, 4, 0});
+            CHECK(histogram.count() == 8);
+            CHECK(histogram.sum() == 19.25);
+        }
+
+        THEN("quantiles are interpolated within their bucket")
+        {
+            CHECK(histogram.quantile(0.25) == 1.0);
+            CHECK(histogram.quantile(0.5) == 2.0);
+            CHECK(histogram.quantile(0.75) == 3.0);
+        }
+
+        AND_GIVEN("a value above all upper bounds")
+        {
+            histogram.observe(100);
+
+            THEN("quantiles within the unbounded bucket are the largest upper bound")
+            {
+                CHECK(histogram.bucketCounts().back() == 1);
+                CHECK(histogram.quantile(0.99) == 4.0);
+            }
+        }
+    }
+}
+
+SCENARIO("Rendering metrics in the Prometheus text format")
+{
+    PrometheusText text;
+
+    WHEN("a labelled counter is rendered")
+    {
+        text.describe("test_lookups_total", "counter", "Lookups, by result.");
+        text.sample("test_lookups_total", {{"result", "hit"}}, std::uint64_t{3});
+        text.sample("test_lookups_total", {{"result", "a \"quoted\"\\value"}}, std::uint64_t{4});
+
+        THEN("it is described, and label values are escaped")
+        {
+            CHECK(text.str() ==
+                  "# HELP test_lookups_total Lookups, by result.\n"
+                  "# TYPE test_lookups_total counter\n"
+                  "test_lookups_total{result=\"hit\"} 3\n"
+                  "test_lookups_total{result=\"a \\\"quoted\\\"\\\\value\"} 4\n");
+        }
+    }
+
+    WHEN("a family of histograms is rendered")
+    {
+        HistogramFamily family{{"method", "asset_type"}, {0.1, 1}};
+        family.get({"createAssetAndPath", "image"}).observe(0.05);
+        family.get({"createAssetAndPath", "image"}).observe(0.5);
+        family.get({"createAssetAndPath", "image"}).observe(2);
+        text.histograms("test_duration_seconds", family);
+        text.quantiles("test_duration_quantile_seconds", family, {0.5});
+
+        THEN("cumulative buckets are rendered, along with the sum, count and quantiles")
+        {
+            const std::string labels = R"(method="createAssetAndPath",asset_type="image")";
+            CHECK(text.str() ==
+                  "test_duration_seconds_bucket{" + labels + ",le=\"0.1\"} 1\n" +
+                      "test_duration_seconds_bucket{" + labels + ",le=\"1\"} 2\n" +
+                      "test_duration_seconds_bucket{" + labels + ",le=\"+Inf\"} 3\n" +
+                      "test_duration_seconds_sum{" + labels + "} 2.55\n" +
+                      "test_duration_seconds_count{" + labels + "} 3\n" +
+                      "test_duration_quantile_seconds{" + labels + ",quantile=\"0.5\"} 0.55\n");
+        }
+    }
+}
+
+SCENARIO("Periodically writing metrics to a file")
+{
+    const std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "katana_openassetio_metrics_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    GIVEN("an exporter writing to a path containing the process ID placeholder")
+    {
+        std::size_t numRenders = 0;
+        std::vector<std::string> errors;
+        MetricsExporter exporter{
+            (dir / "katana.{pid}.prom").string(),
+            std::chrono::hours{1},
+            [&] { return "test_renders_total " + std::to_string(++numRenders) + "\n"; },
+            [&](const std::exception& exc) { errors.emplace_back(exc.what()); }};
+
+        WHEN("the exporter is stopped")
+        {
+            exporter.stop();
+
+            THEN("the final metrics were written, with no temporary files left")
+            {
+#ifndef _WIN32
+                const std::filesystem::path expectedPath =
+                    dir / ("katana." + std::to_string(getpid()) + ".prom");
+                CHECK(exporter.path() == expectedPath.string());
+#endif
+                CHECK(numRenders > 0);
+                CHECK(readFile(exporter.path()) ==
+                      "test_renders_total " + std::to_string(numRenders) + "\n");
+                CHECK(std::distance(std::filesystem::directory_iterator{dir},
+                                    std::filesystem::directory_iterator{}) == 1);
+                CHECK(errors.empty());
+            }
+        }
+    }
+
+    GIVEN("an exporter writing to a directory that does not exist")
+    {
+        std::size_t numRenders = 0;
+        std::vector<std::string> errors;
+        MetricsExporter exporter{(dir / "missing" / "katana.prom").string(),
+                                 std::chrono::hours{1},
+                                 [&]
+                                 {
+                                     ++numRenders;
+                                     return std::string{};
+                                 },
+                                 [&](const std::exception& exc)
+                                 { errors.emplace_back(exc.what()); }};
+        exporter.stop();
+
+        THEN("each failure is reported")
+        {
+            CHECK(numRenders > 0);
+            CHECK(errors.size() == numRenders);
+        }
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
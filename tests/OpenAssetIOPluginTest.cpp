@@ -1,18 +1,26 @@
 // KatanaOpenAssetIO
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2025 The Foundry Visionmongers Ltd
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
@@ -25,6 +33,10 @@
 #include <FnAttribute/suite/FnAttributeSuite.h>
 #include <FnPluginManager/FnPluginManager.h>
 
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
 namespace std
 {
 /**
@@ -38,147 +50,1608 @@ std::ostream& operator<<(std::ostream& ostr, const std::pair<std::string, std::s
     ostr << "\n\n  '" << value.first << "' = '" << value.second << "'";
     return ostr;
 }
-}  // namespace std
+}  // namespace std
+
+namespace
+{
+/*
+ * Get an Asset base class instance, as well as the C suite and handle
+ * that wrap it, from the KatanaOpenAssetIO plugin.
+ *
+ * Return a shared_ptr with a custom deleter that uses the C AssetAPI
+ * function pointer suite's `destroy` function to ensure proper cleanup
+ * of the instance created by the plugin system.
+ */
+auto assetPluginInstanceAndSuiteAndHandle()
+{
+    auto* pluginHandle = FnKat::PluginManager::getPlugin("KatanaOpenAssetIO", "AssetPlugin", 1);
+    const auto* pluginSuite = FnKat::PluginManager::getPluginSuite(pluginHandle);
+    const auto* assetSuite = static_cast<const FnAssetPluginSuite_v1*>(pluginSuite);
+
+    FnAssetHandle instanceHandle = assetSuite->create();
+
+    std::shared_ptr<FnKat::Asset> instance{
+        &instanceHandle->getAsset(),
+        [destroy = assetSuite->destroy, instanceHandle]([[maybe_unused]] FnKat::Asset*)
+        { destroy(instanceHandle); }};
+
+    return std::tuple{std::move(instance), assetSuite, instanceHandle};
+}
+
+/**
+ * Get an Asset base class instance from the KatanaOpenAssetIO plugin.
+ */
+auto assetPluginInstance()
+{
+    auto [instance, assetSuite, instanceHandle] = assetPluginInstanceAndSuiteAndHandle();
+    return instance;
+}
+
+/**
+ * Set environment variables via Python's `os.environ`, restoring their
+ * previous values on destruction.
+ */
+class ScopedEnvVars
+{
+public:
+    /// Value of each variable, or nullopt to unset it.
+    using Values = std::vector<std::pair<std::string, std::optional<std::string>>>;
+
+    explicit ScopedEnvVars(const Values& values)
+        : osEnviron_{pybind11::module_::import("os").attr("environ")}
+    {
+        for (const auto& [name, value] : values)
+        {
+            previousValues_.emplace_back(name, osEnviron_.attr("get")(name));
+            if (value)
+            {
+                osEnviron_[name.c_str()] = *value;
+            }
+            else
+            {
+                osEnviron_.attr("pop")(name, pybind11::none());
+            }
+        }
+    }
+
+    ~ScopedEnvVars()
+    {
+        // In reverse, in case a variable was given more than once.
+        for (auto it = previousValues_.rbegin(); it != previousValues_.rend(); ++it)
+        {
+            if (it->second.is_none())
+            {
+                osEnviron_.attr("pop")(it->first, pybind11::none());
+            }
+            else
+            {
+                osEnviron_[it->first.c_str()] = it->second;
+            }
+        }
+    }
+
+    ScopedEnvVars(const ScopedEnvVars&) = delete;
+    ScopedEnvVars& operator=(const ScopedEnvVars&) = delete;
+    ScopedEnvVars(ScopedEnvVars&&) = delete;
+    ScopedEnvVars& operator=(ScopedEnvVars&&) = delete;
+
+private:
+    pybind11::object osEnviron_;
+    std::vector<std::pair<std::string, pybind11::object>> previousValues_;
+};
+
+/**
+ * Get an Asset base class instance from the KatanaOpenAssetIO plugin,
+ * with the given environment variables set whilst it is created.
+ */
+auto assetPluginInstance(const ScopedEnvVars::Values& envVars)
+{
+    const ScopedEnvVars scopedEnvVars{envVars};
+    return assetPluginInstance();
+}
+
+/**
+ * Run a plugin command that writes its results to the Python dict
+ * given by its `outDictId` argument, returning the dict.
+ */
+pybind11::dict pluginCommandDict(const std::shared_ptr<FnKat::Asset>& plugin,
+                                 const std::string& command)
+{
+    pybind11::dict outDict;
+    // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+    const auto outDictId = std::to_string(reinterpret_cast<std::intptr_t>(outDict.ptr()));
+    if (!plugin->runAssetPluginCommand("", command, {{"outDictId", outDictId}}))
+    {
+        throw std::runtime_error{"Failed to run plugin command " + command};
+    }
+    return outDict;
+}
+
+/**
+ * Get statistics from the KatanaOpenAssetIO plugin, as a Python dict.
+ */
+pybind11::dict pluginStats(const std::shared_ptr<FnKat::Asset>& plugin)
+{
+    return pluginCommandDict(plugin, "setStatsInPythonDict");
+}
+
+/**
+ * Create and return a unique temporary directory.
+ */
+std::filesystem::path createTempDir()
+{
+    // Seed rand with current time, to ensure it's unique across runs.
+    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    // Create a random subdirectory name to avoid collisions.
+    std::string randomSubDirName = "katana_openassetio_test_";
+    randomSubDirName += std::to_string(std::rand());
+    // Generate subdir off system temp dir.
+    auto tempDir = std::filesystem::temp_directory_path();
+    tempDir /= randomSubDirName;
+    // Create the temporary directory.
+    std::filesystem::create_directories(tempDir);
+    return tempDir;
+}
+
+/**
+ * Create an empty file at the specified path.
+ *
+ * @param filePath The path to the file to create.
+ * @throws std::runtime_error if the file could not be created.
+ */
+void touchFile(const std::filesystem::path& filePath)
+{
+    // Create an empty file at the specified path.
+    if (const std::ofstream file{filePath}; !file)
+    {
+        throw std::runtime_error("Failed to create file: " + filePath.string());
+    }
+}
+}  // namespace
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity,*-container-size-empty)
+
+TEST_CASE("BAL plugin is loaded")
+{
+    auto plugin = assetPluginInstance();
+    CHECK(plugin->isAssetId("bal:///"));
+    CHECK_FALSE(plugin->isAssetId("notbal:///"));
+
+    // BAL advertises an entity reference prefix, so the manager need
+    // not be consulted.
+    const auto assetIdCheckStats = pybind11::dict{pluginStats(plugin)["assetIdChecks"]};
+    CHECK(assetIdCheckStats["prefixChecks"].cast<std::size_t>() == 2);
+    CHECK(assetIdCheckStats["managerChecks"].cast<std::size_t>() == 0);
+    CHECK(assetIdCheckStats["firstSightings"].cast<std::size_t>() == 0);
+}
+
+SCENARIO("Describing the caller in the context locale")
+{
+    // Locale of the context used by the Python UI.
+    const auto contextLocale = [](const auto& plugin)
+    {
+        const auto managerAndContext =
+            pluginCommandDict(plugin, "setManagerAndContextInPythonDict");
+        return pybind11::object{managerAndContext["context"].attr("locale")};
+    };
+
+    GIVEN("a session mode set via the environment")
+    {
+        const std::string sessionMode = GENERATE("interactive", "batch");
+        auto plugin = assetPluginInstance({{"KATANAOPENASSETIO_SESSION_MODE", sessionMode}});
+
+        WHEN("the context used by the Python UI is retrieved")
+        {
+            const auto locale = contextLocale(plugin);
+            const auto hasTrait = [&](const char* traitId)
+            { return locale.attr("hasTrait")(traitId).cast<bool>(); };
+
+            THEN("its locale describes lookups in the given session mode")
+            {
+                const bool isBatch = sessionMode == "batch";
+                CHECK(hasTrait("katana-openassetio:locale.Lookup"));
+                CHECK_FALSE(hasTrait("katana-openassetio:locale.Publish"));
+                CHECK_FALSE(hasTrait("katana-openassetio:locale.Background"));
+                CHECK(hasTrait("katana-openassetio:locale.Batch") == isBatch);
+                CHECK(hasTrait("katana-openassetio:locale.Interactive") == !isBatch);
+            }
+        }
+    }
+
+    GIVEN("Katana launched in UI or batch mode on a host with a display")
+    {
+        const bool isUiMode = GENERATE(true, false);
+
+        // Stand-in for Katana's Configuration module.
+        auto types = pybind11::module_::import("types");
+        pybind11::dict configurationValues;
+        if (isUiMode)
+        {
+            configurationValues["KATANA_UI_MODE"] = "1";
+        }
+        auto configuration = types.attr("SimpleNamespace")();
+        configuration.attr("get") = configurationValues.attr("get");
+        auto katana = types.attr("ModuleType")("Katana");
+        katana.attr("Configuration") = configuration;
+
+        auto sysModules = pybind11::module_::import("sys").attr("modules");
+        sysModules["Katana"] = katana;
+        auto plugin = assetPluginInstance({{"DISPLAY", ":0"}});
+        sysModules.attr("pop")("Katana");
+
+        WHEN("the context used by the Python UI is retrieved")
+        {
+            const auto locale = contextLocale(plugin);
+            const auto hasTrait = [&](const char* traitId)
+            { return locale.attr("hasTrait")(traitId).cast<bool>(); };
+
+            THEN("its locale describes Katana's mode, irrespective of the display")
+            {
+                CHECK(hasTrait("katana-openassetio:locale.Interactive") == isUiMode);
+                CHECK(hasTrait("katana-openassetio:locale.Batch") == !isUiMode);
+            }
+        }
+    }
+}
+
+SCENARIO("getAssetFields()")
+{
+    auto plugin = assetPluginInstance();
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    GIVEN("an asset ID with no corresponding entity")
+    {
+        const std::string assetId = "bal:///notfound";
+
+        WHEN("getAssetFields is called")
+        {
+            FnKat::Asset::StringMap assetFields;
+            plugin->getAssetFields(assetId, true, assetFields);
+
+            THEN("asset fields are available but empty")
+            {
+                CHECK(assetFields[kFnAssetFieldName] == "");
+                CHECK(assetFields[kFnAssetFieldVersion] == "");
+            }
+        }
+    }
+}
+
+SCENARIO("Resolving entities that do not exist yet")
+{
+    auto plugin = assetPluginInstance();
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "",
+        "initialize",
+        {{"library_path", BAL_DB_DIR "/bal_db_LookFileMaterialsOut_publishing.json"}}));
+
+    GIVEN("a reference to a version that has not been published")
+    {
+        const std::string assetId = "bal:///cat?v=2";
+
+        WHEN("the reference is resolved repeatedly")
+        {
+            std::string resolvedPath;
+
+            THEN("every attempt fails")
+            {
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+
+                FnKat::Asset::StringMap assetFields;
+                plugin->getAssetFields(assetId, true, assetFields);
+                CHECK(assetFields[kFnAssetFieldName] == "");
+            }
+
+            AND_WHEN("the version is subsequently published")
+            {
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+
+                FnKat::Asset::StringMap assetFields;
+                plugin->getAssetFields("bal:///cat?v=1", true, assetFields);
+                const FnKat::Asset::StringMap args{{"outputFormat", "as archive"}};
+                std::string inFlightAssetId;
+                plugin->createAssetAndPath(
+                    nullptr, "look file", assetFields, args, true, inFlightAssetId);
+                FnKat::Asset::StringMap inFlightAssetFields;
+                plugin->getAssetFields(inFlightAssetId, false, inFlightAssetFields);
+                std::string newAssetId;
+                plugin->postCreateAsset(
+                    nullptr, "look file", inFlightAssetFields, args, newAssetId);
+                REQUIRE(newAssetId == assetId);
+
+                THEN("the reference resolves to the published path")
+                {
+                    plugin->resolveAsset(assetId, resolvedPath);
+                    CHECK(resolvedPath == "/some/staging/area/cat.klf");
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Re-initializing the manager")
+{
+    auto plugin = assetPluginInstance();
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_empty.json"}}));
+
+    const auto managerStateId = [&]
+    {
+        const auto managerAndContext =
+            pluginCommandDict(plugin, "setManagerAndContextInPythonDict");
+        return std::to_string(managerAndContext["stateId"].cast<std::uint64_t>());
+    };
+    const std::string initialStateId = managerStateId();
+
+    GIVEN("a reference that failed to resolve")
+    {
+        const std::string assetId = "bal:///cat";
+        std::string resolvedPath;
+        REQUIRE_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+
+        WHEN("the manager is re-initialized with the same settings")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(
+                "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_empty.json"}}));
+
+            THEN("the manager is retained")
+            {
+                CHECK(plugin->runAssetPluginCommand(
+                    "", "isManagerStateCurrent", {{"stateId", initialStateId}}));
+            }
+
+            THEN("the reference still fails to resolve, from the cache")
+            {
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+                const auto negativeCacheStats =
+                    pybind11::dict{pluginStats(plugin)["negativeCache"]};
+                CHECK(negativeCacheStats["hits"].cast<std::size_t>() == 1);
+            }
+        }
+
+        WHEN("the manager is re-initialized with a library containing the entity")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(
+                "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+            THEN("the manager is replaced")
+            {
+                CHECK_FALSE(plugin->runAssetPluginCommand(
+                    "", "isManagerStateCurrent", {{"stateId", initialStateId}}));
+                CHECK(plugin->runAssetPluginCommand(
+                    "", "isManagerStateCurrent", {{"stateId", managerStateId()}}));
+            }
+
+            THEN("the reference resolves")
+            {
+                plugin->resolveAsset(assetId, resolvedPath);
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+            }
+        }
+    }
+
+    GIVEN("a resolved reference")
+    {
+        REQUIRE(plugin->runAssetPluginCommand(
+            "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+        std::string resolvedPath;
+        plugin->resolveAsset("bal:///cat", resolvedPath);
+
+        WHEN("the manager is re-initialized with the same settings")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(
+                "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+            THEN("the cached path is used")
+            {
+                std::string cachedPath;
+                plugin->resolveAsset("bal:///cat", cachedPath);
+                CHECK(cachedPath == resolvedPath);
+                const auto pathCacheStats = pybind11::dict{pluginStats(plugin)["pathCache"]};
+                CHECK(pathCacheStats["hits"].cast<std::size_t>() == 1);
+                CHECK(pathCacheStats["misses"].cast<std::size_t>() == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("Cache memory budget")
+{
+    auto plugin = assetPluginInstance();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto cacheMemoryStats = [&]
+    { return pybind11::dict{pluginStats(plugin)["cacheMemory"]}; };
+
+    GIVEN("a resolved path")
+    {
+        std::string resolvedPath;
+        plugin->resolveAsset("bal:///cat", resolvedPath);
+
+        THEN("the memory used by the path cache is reported")
+        {
+            const auto stats = cacheMemoryStats();
+            const auto pathCacheStats = pybind11::dict{stats["pathCache"]};
+            CHECK(pathCacheStats["entries"].cast<std::size_t>() == 1);
+            CHECK(pathCacheStats["bytes"].cast<std::size_t>() > resolvedPath.size());
+            CHECK(stats["usage"].cast<std::size_t>() >=
+                  pathCacheStats["bytes"].cast<std::size_t>());
+        }
+
+        THEN("the directories of the path are stored separately")
+        {
+            const auto directoriesStats = pybind11::dict{cacheMemoryStats()["pathDirectories"]};
+            // "/", "some/", "permanent/", "storage/"
+            CHECK(directoriesStats["entries"].cast<std::size_t>() == 4);
+            CHECK(directoriesStats["bytes"].cast<std::size_t>() > 0);
+        }
+
+        WHEN("the path is resolved again")
+        {
+            std::string cachedPath;
+            plugin->resolveAsset("bal:///cat", cachedPath);
+
+            THEN("it is reconstructed from the cache")
+            {
+                CHECK(cachedPath == resolvedPath);
+                const auto pathCacheStats = pybind11::dict{pluginStats(plugin)["pathCache"]};
+                CHECK(pathCacheStats["hits"].cast<std::size_t>() == 1);
+            }
+        }
+
+        WHEN("the budget is set via the initialize command")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(
+                "", "initialize", {{"KATANAOPENASSETIO_CACHE_BUDGET_MB", "64"}}));
+
+            THEN("the budget is updated")
+            {
+                CHECK(cacheMemoryStats()["budget"].cast<std::size_t>() == 64 * 1024 * 1024);
+            }
+
+            THEN("cached paths are retained")
+            {
+                const auto pathCacheStats = pybind11::dict{cacheMemoryStats()["pathCache"]};
+                CHECK(pathCacheStats["entries"].cast<std::size_t>() == 1);
+            }
+        }
+
+        WHEN("an invalid budget is given")
+        {
+            THEN("the command fails")
+            {
+                CHECK_FALSE(plugin->runAssetPluginCommand(
+                    "", "initialize", {{"KATANAOPENASSETIO_CACHE_BUDGET_MB", "lots"}}));
+            }
+        }
+    }
+}
+
+SCENARIO("getAssetDisplayName()")
+{
+    auto plugin = assetPluginInstance();
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    GIVEN("a valid asset ID")
+    {
+        const std::string assetId = "bal:///cat";
+
+        WHEN("display name is retrieved")
+        {
+            std::string displayName;
+            plugin->getAssetDisplayName(assetId, displayName);
+
+            THEN("display name is as the DisplayName trait's name property")
+            {
+                CHECK(displayName == "😺");
+            }
+        }
+    }
+
+    GIVEN("an invalid asset ID")
+    {
+        const std::string assetId = "notbal:///cat";
+
+        WHEN("display name is retrieved")
+        {
+            std::string displayName;
+            plugin->getAssetDisplayName(assetId, displayName);
+
+            THEN("display name is the asset ID")
+            {
+                CHECK(displayName == "notbal:///cat");
+            }
+        }
+    }
+}
+
+SCENARIO("Concurrent Asset API calls")
+{
+    auto plugin = assetPluginInstance();
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    constexpr std::size_t kNumThreads = 8;
+    constexpr std::size_t kNumCallsPerThread = 50;
+    const std::string assetId = "bal:///cat";
+    const std::string expectedPath = "/some/permanent/storage/cat.v1.##.exr";
+
+    // Resolve `assetId` repeatedly from several threads, recording the
+    // last path (or error) seen by each.
+    const auto resolveFromManyThreads = [&](const auto& onMainThread)
+    {
+        std::vector<std::string> results(kNumThreads);
+        // Worker threads must be able to take the GIL to call into the
+        // Python manager.
+        const pybind11::gil_scoped_release releaseGil;
+        std::vector<std::thread> threads;
+        for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx)
+        {
+            threads.emplace_back(
+                [&, threadIdx]
+                {
+                    try
+                    {
+                        for (std::size_t callIdx = 0; callIdx < kNumCallsPerThread; ++callIdx)
+                        {
+                            plugin->resolveAsset(assetId, results[threadIdx]);
+                        }
+                    }
+                    catch (const std::exception& exc)
+                    {
+                        results[threadIdx] = exc.what();
+                    }
+                });
+        }
+        onMainThread();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return results;
+    };
+
+    WHEN("an asset is resolved from many threads at once")
+    {
+        const auto results = resolveFromManyThreads([] {});
+
+        THEN("every thread resolves the same path")
+        {
+            for (const auto& result : results)
+            {
+                CHECK(result == expectedPath);
+            }
+        }
+    }
+
+    WHEN("the manager is re-initialized whilst other threads are resolving")
+    {
+        bool initialized = false;
+        const auto results = resolveFromManyThreads(
+            [&]
+            {
+                const pybind11::gil_scoped_acquire acquireGil;
+                initialized = plugin->runAssetPluginCommand(
+                    "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}});
+            });
+
+        THEN("re-initialization succeeds and in-flight calls are unaffected")
+        {
+            CHECK(initialized);
+            for (const auto& result : results)
+            {
+                CHECK(result == expectedPath);
+            }
+        }
+    }
+}
+
+SCENARIO("Refreshing cached paths")
+{
+    // Treat every cached path as stale.
+    auto plugin = assetPluginInstance({{"KATANAOPENASSETIO_PATH_CACHE_SOFT_TTL_MS", "0"}});
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto pathCacheStats = [&] { return pybind11::dict{pluginStats(plugin)["pathCache"]}; };
+
+    GIVEN("a path that has been resolved and cached")
+    {
+        const std::string assetId = "bal:///cat";
+        const std::string expectedPath = "/some/permanent/storage/cat.v1.##.exr";
+        std::string resolvedPath;
+        plugin->resolveAsset(assetId, resolvedPath);
+
+        WHEN("the path is resolved again after the soft TTL has elapsed")
+        {
+            plugin->resolveAsset(assetId, resolvedPath);
+
+            THEN("the cached path is returned and refreshed in the background")
+            {
+                CHECK(resolvedPath == expectedPath);
+
+                std::size_t refreshes = 0;
+                for (std::size_t attempt = 0; attempt < 500 && refreshes == 0; ++attempt)
+                {
+                    {
+                        // Background thread must be able to take the
+                        // GIL to call into the Python manager.
+                        const pybind11::gil_scoped_release releaseGil;
+                        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                    }
+                    refreshes = pathCacheStats()["refreshes"].cast<std::size_t>();
+                }
+
+                const auto stats = pathCacheStats();
+                CHECK(refreshes == 1);
+                CHECK(stats["refreshBatches"].cast<std::size_t>() == 1);
+                CHECK(stats["refreshFailures"].cast<std::size_t>() == 0);
+                CHECK(stats["misses"].cast<std::size_t>() == 1);
+                CHECK(stats["mutableInserts"].cast<std::size_t>() == 1);
+                CHECK(stats["staleHits"].cast<std::size_t>() == 1);
+
+                plugin->resolveAsset(assetId, resolvedPath);
+                CHECK(resolvedPath == expectedPath);
+            }
+        }
+    }
+
+    GIVEN("a path resolved from a reference to a specific version")
+    {
+        const std::string assetId = "bal:///cat?v=1";
+        std::string resolvedPath;
+        plugin->resolveAsset(assetId, resolvedPath);
+
+        WHEN("the path is resolved again after the soft TTL has elapsed")
+        {
+            plugin->resolveAsset(assetId, resolvedPath);
+
+            THEN("the cached path is returned without being refreshed")
+            {
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+
+                const auto stats = pathCacheStats();
+                CHECK(stats["immutableInserts"].cast<std::size_t>() == 1);
+                CHECK(stats["mutableInserts"].cast<std::size_t>() == 0);
+                CHECK(stats["hits"].cast<std::size_t>() == 1);
+                CHECK(stats["staleHits"].cast<std::size_t>() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Retaining cached paths on reset")
+{
+    auto plugin = assetPluginInstance();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto pathCacheStats = [&] { return pybind11::dict{pluginStats(plugin)["pathCache"]}; };
+    const std::string expectedPath = "/some/permanent/storage/cat.v1.##.exr";
+
+    GIVEN("paths resolved from references to a specific version and a meta-version")
+    {
+        std::string resolvedPath;
+        plugin->resolveAsset("bal:///cat?v=1", resolvedPath);
+        plugin->resolveAsset("bal:///cat", resolvedPath);
+
+        WHEN("Katana's caches are flushed and the paths are resolved again")
+        {
+            plugin->reset();
+
+            THEN("only the path of the specific version is retained")
+            {
+                CHECK(pathCacheStats()["retainedOnReset"].cast<std::size_t>() == 1);
+
+                plugin->resolveAsset("bal:///cat?v=1", resolvedPath);
+                CHECK(resolvedPath == expectedPath);
+                plugin->resolveAsset("bal:///cat", resolvedPath);
+                CHECK(resolvedPath == expectedPath);
+
+                const auto stats = pathCacheStats();
+                CHECK(stats["hits"].cast<std::size_t>() == 1);
+                CHECK(stats["misses"].cast<std::size_t>() == 3);
+            }
+
+            THEN("the retained path is revalidated in the background")
+            {
+                std::size_t revalidations = 0;
+                for (std::size_t attempt = 0; attempt < 500 && revalidations == 0; ++attempt)
+                {
+                    {
+                        // Background thread must be able to take the
+                        // GIL to call into the Python manager.
+                        const pybind11::gil_scoped_release releaseGil;
+                        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                    }
+                    revalidations = pathCacheStats()["revalidations"].cast<std::size_t>();
+                }
+                CHECK(revalidations == 1);
+                CHECK(pathCacheStats()["revalidationMismatches"].cast<std::size_t>() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Retaining cached paths on publish")
+{
+    auto plugin = assetPluginInstance();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_Katana_scene_publishing.json"}}));
+
+    const auto pathCacheStats = [&] { return pybind11::dict{pluginStats(plugin)["pathCache"]}; };
+    const std::string expectedPath = "/some/permanent/storage/cat.v1.rev1.katana";
+
+    GIVEN("paths resolved from references to a specific version and a meta-version")
+    {
+        std::string resolvedPath;
+        plugin->resolveAsset("bal:///cat/v1?v=1", resolvedPath);
+        REQUIRE(resolvedPath == expectedPath);
+        plugin->resolveAsset("bal:///cat/v1", resolvedPath);
+        // An unrelated reference that fails to resolve.
+        CHECK_THROWS(plugin->resolveAsset("bal:///dog", resolvedPath));
+
+        WHEN("a new version of the entity is published")
+        {
+            const FnKat::Asset::StringMap args{{"publish", "True"}, {"versionUp", "True"}};
+            FnKat::Asset::StringMap assetFields;
+            plugin->getAssetFields("bal:///cat/v1", false, assetFields);
+            std::string inFlightAssetId;
+            plugin->createAssetAndPath(
+                nullptr, "katana scene", assetFields, args, true, inFlightAssetId);
+            FnKat::Asset::StringMap inFlightAssetFields;
+            plugin->getAssetFields(inFlightAssetId, false, inFlightAssetFields);
+            std::string newAssetId;
+            plugin->postCreateAsset(nullptr, "katana scene", inFlightAssetFields, args, newAssetId);
+
+            THEN("only cached data of the published references is discarded")
+            {
+                const auto statsBefore = pathCacheStats();
+                const auto hitsBefore = statsBefore["hits"].cast<std::size_t>();
+                const auto missesBefore = statsBefore["misses"].cast<std::size_t>();
+
+                plugin->resolveAsset("bal:///cat/v1?v=1", resolvedPath);
+                CHECK(resolvedPath == expectedPath);
+                plugin->resolveAsset("bal:///cat/v1", resolvedPath);
+
+                const auto statsAfter = pathCacheStats();
+                CHECK(statsAfter["hits"].cast<std::size_t>() == hitsBefore + 1);
+                CHECK(statsAfter["misses"].cast<std::size_t>() == missesBefore + 1);
+
+                CHECK_THROWS(plugin->resolveAsset("bal:///dog", resolvedPath));
+                CHECK(pybind11::dict{pluginStats(plugin)["negativeCache"]}["hits"]
+                          .cast<std::size_t>() == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("Reporting references that resolve differently after reset")
+{
+    auto plugin = assetPluginInstance({{"KATANAOPENASSETIO_REPORT_CHANGES_ON_RESET", "1"}});
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto changeReport = [&]
+    { return pluginCommandDict(plugin, "setChangeReportInPythonDict"); };
+
+    GIVEN("paths resolved from references to a specific version and a meta-version")
+    {
+        std::string resolvedPath;
+        plugin->resolveAsset("bal:///cat?v=1", resolvedPath);
+        plugin->resolveAsset("bal:///cat", resolvedPath);
+
+        WHEN("Katana's caches are flushed")
+        {
+            plugin->reset();
+
+            THEN("the meta-version is re-resolved in the background and found unchanged")
+            {
+                bool isComplete = false;
+                for (std::size_t attempt = 0; attempt < 500 && !isComplete; ++attempt)
+                {
+                    {
+                        // Background thread must be able to take the
+                        // GIL to call into the Python manager.
+                        const pybind11::gil_scoped_release releaseGil;
+                        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                    }
+                    isComplete = changeReport()["complete"].cast<bool>();
+                }
+
+                const auto report = changeReport();
+                CHECK(isComplete);
+                CHECK(report["checked"].cast<std::size_t>() == 1);
+                CHECK(pybind11::dict{report["changes"]}.empty());
+
+                AND_THEN("the re-resolved path is cached")
+                {
+                    plugin->resolveAsset("bal:///cat", resolvedPath);
+                    CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+                    CHECK(pybind11::dict{pluginStats(plugin)["pathCache"]}["misses"]
+                              .cast<std::size_t>() == 2);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Read-only mode")
+{
+    auto plugin = assetPluginInstance({
+        {"KATANAOPENASSETIO_READ_ONLY", "1"},
+        // Treat every cached path as stale, were it not for read-only
+        // mode.
+        {"KATANAOPENASSETIO_PATH_CACHE_SOFT_TTL_MS", "0"},
+    });
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto stats = [&](const char* name) { return pybind11::dict{pluginStats(plugin)[name]}; };
+
+    CHECK(stats("readOnly")["enabled"].cast<bool>());
+
+    GIVEN("a path resolved from a reference to a meta-version")
+    {
+        const std::string assetId = "bal:///cat";
+        const std::string expectedPath = "/some/permanent/storage/cat.v1.##.exr";
+        std::string resolvedPath;
+        plugin->resolveAsset(assetId, resolvedPath);
+
+        WHEN("Katana's caches are flushed and the path is resolved again")
+        {
+            plugin->reset();
+            plugin->resolveAsset(assetId, resolvedPath);
+
+            THEN("the cached path is returned without expiry or refresh")
+            {
+                CHECK(resolvedPath == expectedPath);
+
+                const auto pathCacheStats = stats("pathCache");
+                CHECK(pathCacheStats["immutableInserts"].cast<std::size_t>() == 1);
+                CHECK(pathCacheStats["mutableInserts"].cast<std::size_t>() == 0);
+                CHECK(pathCacheStats["hits"].cast<std::size_t>() == 1);
+                CHECK(pathCacheStats["staleHits"].cast<std::size_t>() == 0);
+            }
+        }
+    }
+
+    GIVEN("an entity whose display name has been retrieved")
+    {
+        const std::string assetId = "bal:///cat";
+        std::string displayName;
+        plugin->getAssetDisplayName(assetId, displayName);
+
+        WHEN("the display name is retrieved again")
+        {
+            std::string cachedDisplayName;
+            plugin->getAssetDisplayName(assetId, cachedDisplayName);
+
+            THEN("resolved traits are served from the cache")
+            {
+                CHECK(cachedDisplayName == displayName);
+
+                const auto readOnlyStats = stats("readOnly");
+                CHECK(readOnlyStats["traitsMisses"].cast<std::size_t>() == 1);
+                CHECK(readOnlyStats["traitsHits"].cast<std::size_t>() == 1);
+            }
+        }
+    }
+
+    GIVEN("an entity whose versions and attributes have been queried")
+    {
+        const std::string assetId = "bal:///cat";
+        FnKat::Asset::StringVector versions;
+        plugin->getAssetVersions(assetId, versions);
+        FnKat::Asset::StringMap attrs;
+        plugin->getAssetAttributes(assetId, "", attrs);
+        std::string versionTag;
+        plugin->resolveAssetVersion(assetId, versionTag, "1");
+
+        WHEN("they are queried again")
+        {
+            FnKat::Asset::StringVector cachedVersions;
+            plugin->getAssetVersions(assetId, cachedVersions);
+            FnKat::Asset::StringMap cachedAttrs;
+            plugin->getAssetAttributes(assetId, "", cachedAttrs);
+            std::string cachedVersionTag;
+            plugin->resolveAssetVersion(assetId, cachedVersionTag, "1");
+
+            THEN("the entity traits and version queries are served from the cache")
+            {
+                CHECK(cachedVersions == versions);
+                CHECK(cachedAttrs == attrs);
+                CHECK(cachedVersionTag == versionTag);
+
+                const auto readOnlyStats = stats("readOnly");
+                CHECK(readOnlyStats["queryMisses"].cast<std::size_t>() == 3);
+                CHECK(readOnlyStats["queryHits"].cast<std::size_t>() == 3);
+                CHECK(pybind11::dict{stats("cacheMemory")["readOnlyQueries"]}["entries"]
+                          .cast<std::size_t>() == 1);
+            }
+        }
+    }
+
+    WHEN("an asset is published")
+    {
+        const FnKat::Asset::StringMap assetFields{{"__entityReference", "bal:///cat"}};
+        std::string assetId;
+
+        THEN("the publish is rejected")
+        {
+            CHECK_THROWS_WITH(
+                plugin->createAssetAndPath(nullptr, "image", assetFields, {}, true, assetId),
+                "OpenAssetIOAsset::createAssetAndPath is not available in read-only mode");
+            CHECK_THROWS(
+                plugin->postCreateAsset(nullptr, "image", assetFields, {}, assetId));
+            CHECK(stats("readOnly")["rejectedWrites"].cast<std::size_t>() == 2);
+        }
+    }
+}
+
+SCENARIO("Resolving paths for a range of frames")
+{
+    auto plugin = assetPluginInstance();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    pybind11::list paths;
+    // NOLINTNEXTLINE(*-pro-type-reinterpret-cast)
+    const auto pathsId = std::to_string(reinterpret_cast<std::intptr_t>(paths.ptr()));
+
+    GIVEN("an asset ID of a file sequence")
+    {
+        const std::string assetId = "bal:///cat";
+
+        WHEN("paths are resolved for a range and list of frames")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(assetId,
+                                                  "resolvePathRange",
+                                                  {{"outListId", pathsId},
+                                                   {"frames", "1-3,10,20-24x2"}}));
+
+            THEN("the entity is resolved once")
+            {
+                const auto pathCacheStats = pybind11::dict{pluginStats(plugin)["pathCache"]};
+                CHECK(pathCacheStats["misses"].cast<std::size_t>() == 1);
+                CHECK(pathCacheStats["hits"].cast<std::size_t>() == 0);
+            }
+
+            THEN("paths match those resolved for each frame individually")
+            {
+                const std::vector<int> frames{1, 2, 3, 10, 20, 22, 24};
+                REQUIRE(paths.size() == frames.size());
+                for (std::size_t idx = 0; idx < frames.size(); ++idx)
+                {
+                    std::string expectedPath;
+                    plugin->resolvePath(assetId, frames[idx], expectedPath);
+                    CHECK(paths[idx].cast<std::string>() == expectedPath);
+                }
+            }
+        }
+
+        WHEN("the frame list is malformed")
+        {
+            THEN("the command fails")
+            {
+                CHECK_FALSE(plugin->runAssetPluginCommand(
+                    assetId, "resolvePathRange", {{"outListId", pathsId}, {"frames", "3-1"}}));
+                CHECK(paths.empty());
+            }
+        }
+    }
+
+    GIVEN("an asset ID of an entity that does not exist")
+    {
+        THEN("the command fails")
+        {
+            CHECK_FALSE(plugin->runAssetPluginCommand(
+                "bal:///notACat", "resolvePathRange", {{"outListId", pathsId}, {"frames", "1-3"}}));
+            CHECK(paths.empty());
+        }
+    }
+}
+
+SCENARIO("Prefetching references found in a project file")
+{
+    auto plugin = assetPluginInstance();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto prefetchStats = [&] { return pybind11::dict{pluginStats(plugin)["prefetch"]}; };
+
+    GIVEN("a project file referencing assets")
+    {
+        const auto projectPath = createTempDir() / "project.katana";
+        {
+            std::ofstream project{projectPath};
+            project << "<katana>\n"
+                       "  <param name=\"fileName\" value=\"bal:///cat\"/>\n"
+                       "  <param name=\"fileName\" value=\"bal:///cat\"/>\n"
+                       "  <param name=\"fileName\" value=\"bal:///notACat\"/>\n"
+                       "</katana>\n";
+        }
+
+        WHEN("the project file is scanned for references to prefetch")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(
+                "", "prefetchReferencesInFile", {{"path", projectPath.string()}}));
+
+            std::size_t completed = 0;
+            for (std::size_t attempt = 0; attempt < 500 && completed < 2; ++attempt)
+            {
+                {
+                    // Background threads must be able to take the GIL
+                    // to call into the Python manager.
+                    const pybind11::gil_scoped_release releaseGil;
+                    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                }
+                const auto stats = prefetchStats();
+                completed = stats["resolved"].cast<std::size_t>() +
+                            stats["failures"].cast<std::size_t>();
+            }
+
+            THEN("unique references are resolved in the background")
+            {
+                const auto stats = prefetchStats();
+                CHECK(stats["scans"].cast<std::size_t>() == 1);
+                CHECK(stats["referencesFound"].cast<std::size_t>() == 2);
+                CHECK(stats["requested"].cast<std::size_t>() == 2);
+                CHECK(stats["resolved"].cast<std::size_t>() == 1);
+                CHECK(stats["failures"].cast<std::size_t>() == 1);
+
+                AND_THEN("subsequent resolution is served from the cache")
+                {
+                    std::string resolvedPath;
+                    plugin->resolveAsset("bal:///cat", resolvedPath);
+                    CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+
+                    const auto pathCacheStats = pybind11::dict{pluginStats(plugin)["pathCache"]};
+                    CHECK(pathCacheStats["hits"].cast<std::size_t>() == 1);
+                    CHECK(pathCacheStats["misses"].cast<std::size_t>() == 0);
+                }
+            }
+        }
+    }
+
+    WHEN("no file path is given")
+    {
+        THEN("the command fails")
+        {
+            CHECK_FALSE(plugin->runAssetPluginCommand("", "prefetchReferencesInFile", {}));
+        }
+    }
+}
+
+SCENARIO("Serving resolution from an exported index")
+{
+    auto plugin = assetPluginInstance();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    GIVEN("a project file referencing assets")
+    {
+        const auto tmpDir = createTempDir();
+        const auto projectPath = tmpDir / "project.katana";
+        {
+            std::ofstream project{projectPath};
+            project << "<katana>\n"
+                       "  <param name=\"fileName\" value=\"bal:///cat\"/>\n"
+                       "  <param name=\"fileName\" value=\"bal:///notACat\"/>\n"
+                       "</katana>\n";
+        }
+        const auto indexPath = tmpDir / "project.koaindex";
+
+        WHEN("an index of the project's references is exported")
+        {
+            REQUIRE(plugin->runAssetPluginCommand(
+                "",
+                "exportResolutionIndex",
+                {{"path", indexPath.string()}, {"sourcePath", projectPath.string()}}));
+
+            AND_WHEN("a plugin instance is configured to use the index manager")
+            {
+                const auto configPath = tmpDir / "openassetio_config.toml";
+                {
+                    std::ofstream config{configPath};
+                    config << "[manager]\n"
+                              "identifier = \"com.foundry.katanaopenassetio.index\"\n"
+                              "[manager.settings]\n"
+                              "index_path = \""
+                           << indexPath.generic_string() << "\"\n";
+                }
+
+                auto indexPlugin = assetPluginInstance({
+                    {"OPENASSETIO_DEFAULT_CONFIG", configPath.string()},
+                    {"OPENASSETIO_PLUGIN_PATH", INDEX_MANAGER_PLUGIN_DIR},
+                });
+
+                THEN("references resolve as they did from the source manager")
+                {
+                    CHECK(indexPlugin->isAssetId("bal:///cat"));
+
+                    std::string resolvedPath;
+                    indexPlugin->resolveAsset("bal:///cat", resolvedPath);
+                    CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+
+                    FnKat::Asset::StringVector versions;
+                    indexPlugin->getAssetVersions("bal:///cat", versions);
+                    FnKat::Asset::StringVector sourceVersions;
+                    plugin->getAssetVersions("bal:///cat", sourceVersions);
+                    CHECK(versions == sourceVersions);
+                }
+
+                THEN("unresolvable references remain unresolvable")
+                {
+                    std::string resolvedPath;
+                    CHECK_THROWS(indexPlugin->resolveAsset("bal:///notACat", resolvedPath));
+                }
+            }
+        }
+    }
+
+    WHEN("no index path is given")
+    {
+        THEN("the command fails")
+        {
+            CHECK_FALSE(plugin->runAssetPluginCommand(
+                "", "exportResolutionIndex", {{"references", "bal:///cat"}}));
+        }
+    }
+}
 
-namespace
-{
-/*
- * Get an Asset base class instance, as well as the C suite and handle
- * that wrap it, from the KatanaOpenAssetIO plugin.
- *
- * Return a shared_ptr with a custom deleter that uses the C AssetAPI
- * function pointer suite's `destroy` function to ensure proper cleanup
- * of the instance created by the plugin system.
- */
-auto assetPluginInstanceAndSuiteAndHandle()
+SCENARIO("Adaptive relationship page size")
 {
-    auto* pluginHandle = FnKat::PluginManager::getPlugin("KatanaOpenAssetIO", "AssetPlugin", 1);
-    const auto* pluginSuite = FnKat::PluginManager::getPluginSuite(pluginHandle);
-    const auto* assetSuite = static_cast<const FnAssetPluginSuite_v1*>(pluginSuite);
+    // Start from the smallest possible page, such that every page of
+    // versions is full.
+    auto plugin = assetPluginInstance({{"KATANAOPENASSETIO_PAGE_SIZE", "1"}});
 
-    FnAssetHandle instanceHandle = assetSuite->create();
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
 
-    std::shared_ptr<FnKat::Asset> instance{
-        &instanceHandle->getAsset(),
-        [destroy = assetSuite->destroy, instanceHandle]([[maybe_unused]] FnKat::Asset*)
-        { destroy(instanceHandle); }};
+    const auto pagingStats = [&]
+    { return pybind11::dict{pluginStats(plugin)["relationshipPaging"]}; };
 
-    return std::tuple{std::move(instance), assetSuite, instanceHandle};
-}
+    CHECK(pagingStats()["pageSize"].cast<std::size_t>() == 1);
 
-/**
- * Get an Asset base class instance from the KatanaOpenAssetIO plugin.
- */
-auto assetPluginInstance()
-{
-    auto [instance, assetSuite, instanceHandle] = assetPluginInstanceAndSuiteAndHandle();
-    return instance;
-}
+    WHEN("versions are retrieved from a fast manager")
+    {
+        FnKat::Asset::StringVector versions;
+        plugin->getAssetVersions("bal:///cat", versions);
 
-/**
- * Create and return a unique temporary directory.
- */
-std::filesystem::path createTempDir()
-{
-    // Seed rand with current time, to ensure it's unique across runs.
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    // Create a random subdirectory name to avoid collisions.
-    std::string randomSubDirName = "katana_openassetio_test_";
-    randomSubDirName += std::to_string(std::rand());
-    // Generate subdir off system temp dir.
-    auto tempDir = std::filesystem::temp_directory_path();
-    tempDir /= randomSubDirName;
-    // Create the temporary directory.
-    std::filesystem::create_directories(tempDir);
-    return tempDir;
+        THEN("the page size is increased for subsequent queries")
+        {
+            const auto stats = pagingStats();
+            CHECK(stats["queries"].cast<std::size_t>() == 1);
+            CHECK(stats["pages"].cast<std::size_t>() == 2);
+            CHECK(stats["pageSizeIncreases"].cast<std::size_t>() == 1);
+            CHECK(stats["pageSizeDecreases"].cast<std::size_t>() == 0);
+            CHECK(stats["pageSize"].cast<std::size_t>() == 2);
+        }
+    }
 }
 
-/**
- * Create an empty file at the specified path.
- *
- * @param filePath The path to the file to create.
- * @throws std::runtime_error if the file could not be created.
- */
-void touchFile(const std::filesystem::path& filePath)
+SCENARIO("Resolving via a resolver server")
 {
-    // Create an empty file at the specified path.
-    if (const std::ofstream file{filePath}; !file)
+    auto server = assetPluginInstance();
+    REQUIRE(server->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    const auto socketPath = (createTempDir() / "resolver.sock").string();
+    REQUIRE(server->runAssetPluginCommand("", "serveResolver", {{"socketPath", socketPath}}));
+
+    auto client = assetPluginInstance({{"KATANAOPENASSETIO_RESOLVER_SOCKET", socketPath}});
+
+    const auto serverPathCacheStats = [&]
+    { return pybind11::dict{pluginStats(server)["pathCache"]}; };
+
+    GIVEN("a client connected to the server")
     {
-        throw std::runtime_error("Failed to create file: " + filePath.string());
+        WHEN("a path is resolved by the client")
+        {
+            std::string resolvedPath;
+            client->resolveAsset("bal:///cat", resolvedPath);
+
+            THEN("the path is resolved and cached by the server")
+            {
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+                CHECK(serverPathCacheStats()["misses"].cast<std::size_t>() == 1);
+
+                AND_WHEN("the path is resolved again")
+                {
+                    client->resolveAsset("bal:///cat", resolvedPath);
+
+                    THEN("the server's cached path is used")
+                    {
+                        CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+                        CHECK(serverPathCacheStats()["hits"].cast<std::size_t>() == 1);
+                    }
+                }
+            }
+        }
+
+        WHEN("fields are queried by the client")
+        {
+            FnKat::Asset::StringMap fields;
+            client->getAssetFields("bal:///cat", true, fields);
+
+            THEN("the server's fields are returned")
+            {
+                CHECK(fields[kFnAssetFieldName] == "😺");
+                CHECK(fields["__entityReference"] == "bal:///cat");
+            }
+        }
+
+        WHEN("a path that does not exist is resolved by the client")
+        {
+            THEN("the server's error is raised")
+            {
+                std::string resolvedPath;
+                CHECK_THROWS(client->resolveAsset("bal:///notACat", resolvedPath));
+            }
+        }
     }
-}
-}  // namespace
 
-// Disable checks triggered by Catch2 macros.
-// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity,*-container-size-empty)
+    GIVEN("a client without a manager configuration of its own")
+    {
+        const ScopedEnvVars noDefaultConfig{{{"OPENASSETIO_DEFAULT_CONFIG", std::nullopt}}};
+        auto configlessClient =
+            assetPluginInstance({{"KATANAOPENASSETIO_RESOLVER_SOCKET", socketPath}});
 
-TEST_CASE("BAL plugin is loaded")
-{
-    auto plugin = assetPluginInstance();
-    CHECK(plugin->isAssetId("bal:///"));
-    CHECK_FALSE(plugin->isAssetId("notbal:///"));
+        WHEN("the client is queried")
+        {
+            const bool isAssetId = configlessClient->isAssetId("bal:///cat");
+            const bool isNotAssetId = configlessClient->isAssetId("notbal:///cat");
+            std::string resolvedPath;
+            configlessClient->resolveAsset("bal:///cat", resolvedPath);
+
+            THEN("queries are answered by the server's manager alone")
+            {
+                CHECK(isAssetId);
+                CHECK_FALSE(isNotAssetId);
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+
+                // The server's manager advertises a prefix, so the
+                // server need not be asked whether each is a reference.
+                const auto assetIdCheckStats =
+                    pybind11::dict{pluginStats(configlessClient)["assetIdChecks"]};
+                CHECK(assetIdCheckStats["prefixChecks"].cast<std::size_t>() == 3);
+            }
+        }
+    }
+
+    GIVEN("a client of a server that is not running")
+    {
+        auto orphanedClient =
+            assetPluginInstance({{"KATANAOPENASSETIO_RESOLVER_SOCKET", socketPath + ".missing"}});
+        REQUIRE(orphanedClient->runAssetPluginCommand(
+            "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+        WHEN("a path is resolved by the client")
+        {
+            std::string resolvedPath;
+            orphanedClient->resolveAsset("bal:///cat", resolvedPath);
+
+            THEN("the path is resolved by the client's own manager")
+            {
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+            }
+        }
+    }
+
+    GIVEN("a client of a server that does not respond")
+    {
+        // Accept connections, but never read from them.
+        const auto silentSocketPath = (createTempDir() / "silent.sock").string();
+        const int silentFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        REQUIRE(silentFd >= 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        silentSocketPath.copy(address.sun_path, sizeof(address.sun_path) - 1);
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        REQUIRE(::bind(silentFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) ==
+                0);
+        REQUIRE(::listen(silentFd, 1) == 0);
+
+        auto stalledClient = assetPluginInstance({
+            {"KATANAOPENASSETIO_RESOLVER_SOCKET", silentSocketPath},
+            {"KATANAOPENASSETIO_RESOLVER_TIMEOUT_MS", "50"},
+        });
+        REQUIRE(stalledClient->runAssetPluginCommand(
+            "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+        WHEN("a path is resolved by the client")
+        {
+            std::string resolvedPath;
+            stalledClient->resolveAsset("bal:///cat", resolvedPath);
+
+            THEN("the client stops waiting, and uses its own manager")
+            {
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+            }
+        }
+        ::close(silentFd);
+    }
+
+    GIVEN("a client with an open connection to the server")
+    {
+        std::string resolvedPath;
+        client->resolveAsset("bal:///cat", resolvedPath);
+
+        WHEN("the server is restarted")
+        {
+            REQUIRE(
+                server->runAssetPluginCommand("", "serveResolver", {{"socketPath", socketPath}}));
+
+            THEN("the client is served by the new server")
+            {
+                resolvedPath.clear();
+                client->resolveAsset("bal:///cat", resolvedPath);
+                CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+            }
+        }
+    }
+
+    GIVEN("another instance")
+    {
+        auto other = assetPluginInstance();
+        REQUIRE(other->runAssetPluginCommand(
+            "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+        THEN("it cannot serve on the socket of the running server")
+        {
+            CHECK_FALSE(
+                other->runAssetPluginCommand("", "serveResolver", {{"socketPath", socketPath}}));
+
+            std::string resolvedPath;
+            client->resolveAsset("bal:///cat", resolvedPath);
+            CHECK(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+            CHECK(serverPathCacheStats()["misses"].cast<std::size_t>() == 1);
+        }
+    }
+
+    GIVEN("a resolver client")
+    {
+        THEN("it cannot also serve")
+        {
+            CHECK_FALSE(client->runAssetPluginCommand(
+                "", "serveResolver", {{"socketPath", socketPath + ".other"}}));
+        }
+    }
 }
 
-SCENARIO("getAssetFields()")
+SCENARIO("Speculative prefetch of follow-up traits")
 {
-    auto plugin = assetPluginInstance();
+    // Disable the path cache, so that every resolveAsset queries the
+    // manager.
+    const auto speculationWindow = GENERATE(as<std::string>{}, "1000", "0");
+    auto plugin = assetPluginInstance({
+        {"KATANAOPENASSETIO_PATH_CACHE_HARD_TTL_MS", "0"},
+        {"KATANAOPENASSETIO_SPECULATION_WINDOW_MS", speculationWindow},
+    });
 
     REQUIRE(plugin->runAssetPluginCommand(
         "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
 
-    GIVEN("an asset ID with no corresponding entity")
+    WHEN("a reference is repeatedly resolved followed by querying its fields")
     {
-        const std::string assetId = "bal:///notfound";
-
-        WHEN("getAssetFields is called")
+        for (std::size_t idx = 0; idx < 16; ++idx)
         {
-            FnKat::Asset::StringMap assetFields;
-            plugin->getAssetFields(assetId, true, assetFields);
+            std::string resolvedPath;
+            plugin->resolveAsset("bal:///cat", resolvedPath);
+            REQUIRE(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
 
-            THEN("asset fields are available but empty")
+            FnKat::Asset::StringMap fields;
+            plugin->getAssetFields("bal:///cat", false, fields);
+            REQUIRE(fields[kFnAssetFieldName] == "😺");
+        }
+
+        const auto stats = pybind11::dict{pluginStats(plugin)["speculation"]};
+
+        if (speculationWindow == "0")
+        {
+            THEN("nothing is speculatively fetched when disabled")
             {
-                CHECK(assetFields[kFnAssetFieldName] == "");
-                CHECK(assetFields[kFnAssetFieldVersion] == "");
+                CHECK(stats["successorsObserved"].cast<std::size_t>() == 0);
+                CHECK(stats["speculations"].cast<std::size_t>() == 0);
+                CHECK(stats["hits"].cast<std::size_t>() == 0);
+            }
+        }
+        else
+        {
+            THEN("follow-up calls are served from speculatively fetched traits")
+            {
+                CHECK(stats["successorsObserved"].cast<std::size_t>() > 0);
+                CHECK(stats["speculations"].cast<std::size_t>() > 0);
+                CHECK(stats["hits"].cast<std::size_t>() > 0);
             }
         }
     }
 }
 
-SCENARIO("getAssetDisplayName()")
+SCENARIO("Detecting manager calls that could be batched")
 {
-    auto plugin = assetPluginInstance();
+    // Disable caching and speculation, so that every resolveAsset
+    // queries the manager for the same traits.
+    auto plugin = assetPluginInstance({
+        {"KATANAOPENASSETIO_PATH_CACHE_HARD_TTL_MS", "0"},
+        {"KATANAOPENASSETIO_SPECULATION_WINDOW_MS", "0"},
+        {"KATANAOPENASSETIO_BATCHABLE_CALL_THRESHOLD", "4"},
+        {"KATANAOPENASSETIO_ROUND_TRIP_BUDGET", "2"},
+    });
 
     REQUIRE(plugin->runAssetPluginCommand(
         "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
 
-    GIVEN("a valid asset ID")
+    const auto roundTripReport = [&]
+    { return pluginCommandDict(plugin, "setRoundTripReportInPythonDict"); };
+
+    WHEN("a burst of references is resolved one at a time")
     {
-        const std::string assetId = "bal:///cat";
+        for (std::size_t idx = 0; idx < 8; ++idx)
+        {
+            std::string resolvedPath;
+            plugin->resolveAsset("bal:///cat", resolvedPath);
+            REQUIRE(resolvedPath == "/some/permanent/storage/cat.v1.##.exr");
+        }
 
-        WHEN("display name is retrieved")
+        AND_WHEN("the burst is over")
         {
-            std::string displayName;
-            plugin->getAssetDisplayName(assetId, displayName);
+            std::this_thread::sleep_for(std::chrono::milliseconds{200});
+            const auto report = roundTripReport();
 
-            THEN("display name is as the DisplayName trait's name property")
+            THEN("the operation is reported as over budget")
             {
-                CHECK(displayName == "😺");
+                const auto operations = pybind11::dict{report["operations"]};
+                REQUIRE(operations.contains("resolveAsset"));
+                const auto roundTrips = pybind11::dict{operations["resolveAsset"]};
+                CHECK(roundTrips["operations"].cast<std::size_t>() == 1);
+                CHECK(roundTrips["roundTrips"].cast<std::size_t>() == 8);
+                CHECK(roundTrips["overBudget"].cast<std::size_t>() == 1);
+            }
+
+            THEN("the resolves are reported as batchable, along with the calling method")
+            {
+                const auto batchable = pybind11::list{report["batchable"]};
+                REQUIRE(batchable.size() == 1);
+                const auto calls = pybind11::dict{batchable[0]};
+                CHECK(calls["method"].cast<std::string>() == "resolveAsset");
+                CHECK(calls["managerCall"].cast<std::string>() == "resolve");
+                CHECK_FALSE(pybind11::list{calls["traits"]}.empty());
+                CHECK(calls["maxCalls"].cast<std::size_t>() == 8);
+
+                CHECK(pybind11::dict{pluginStats(plugin)["managerCalls"]}["roundTrips"]
+                          .cast<std::size_t>() == 8);
             }
         }
     }
+}
 
-    GIVEN("an invalid asset ID")
+SCENARIO("Writing metrics to a textfile")
+{
+    const auto metricsPath = createTempDir() / "katana.prom";
+    auto plugin =
+        assetPluginInstance({{"KATANAOPENASSETIO_METRICS_TEXTFILE", metricsPath.string()}});
+
+    REQUIRE(plugin->runAssetPluginCommand(
+        "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+
+    WHEN("a reference is resolved and the plugin is destroyed")
     {
-        const std::string assetId = "notbal:///cat";
+        std::string resolvedPath;
+        plugin->resolveAsset("bal:///cat", resolvedPath);
+        // The second query is answered by the negative cache.
+        for (std::size_t idx = 0; idx < 2; ++idx)
+        {
+            FnKat::Asset::StringMap fields;
+            plugin->getAssetFields("bal:///notACat", false, fields);
+        }
+        plugin.reset();
 
-        WHEN("display name is retrieved")
+        THEN("the final metrics are written in the Prometheus text format")
         {
-            std::string displayName;
-            plugin->getAssetDisplayName(assetId, displayName);
+            std::ifstream metricsFile{metricsPath};
+            const std::string metrics{std::istreambuf_iterator<char>{metricsFile},
+                                      std::istreambuf_iterator<char>{}};
+
+            CHECK(metrics.find("# TYPE katanaopenassetio_api_call_duration_seconds histogram\n") !=
+                  std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_api_call_duration_seconds_count"
+                               "{method=\"resolveAsset\"} 1\n") != std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_manager_round_trips_total ") !=
+                  std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_manager_batch_size_count{call=\"resolve\"}") !=
+                  std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_path_cache_lookups_total{result=\"miss\"} 1\n") !=
+                  std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_negative_cache_lookups_total"
+                               "{result=\"hit\"} 1\n") != std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_negative_cache_lookups_total"
+                               "{result=\"miss\"} 2\n") != std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_asset_id_checks_total"
+                               "{result=\"first_sighting\"} 0\n") != std::string::npos);
+            CHECK(metrics.find("katanaopenassetio_cache_evictions_total{cache=\"path\"} 0\n") !=
+                  std::string::npos);
+        }
+    }
 
-            THEN("display name is the asset ID")
+    std::filesystem::remove_all(metricsPath.parent_path());
+}
+
+SCENARIO("Manager call deadlines")
+{
+    // Configure a default manager that is slower to respond than the
+    // deadline.
+    const auto tmpDir = createTempDir();
+    const auto configPath = tmpDir / "openassetio_config.toml";
+    {
+        std::ofstream config{configPath};
+        config << "[manager]\n"
+                  "identifier = \"org.openassetio.examples.manager.bal\"\n"
+                  "[manager.settings]\n"
+                  "library_path = \"" BAL_DB_DIR "/bal_db_simple_image.json\"\n"
+                  "simulated_query_latency_ms = 500\n";
+    }
+
+    auto plugin = assetPluginInstance({
+        {"OPENASSETIO_DEFAULT_CONFIG", configPath.string()},
+        {"KATANAOPENASSETIO_CALL_DEADLINES_MS", "resolveAsset=50,getAssetVersions=50"},
+    });
+
+    const auto managerCallStats = [&]
+    { return pybind11::dict{pluginStats(plugin)["managerCalls"]}; };
+
+    GIVEN("a manager that does not respond within the deadline")
+    {
+        const std::string assetId = "bal:///cat";
+        std::string resolvedPath;
+
+        WHEN("an asset is resolved")
+        {
+            THEN("the call fails once the deadline passes")
             {
-                CHECK(displayName == "notbal:///cat");
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+                CHECK(managerCallStats()["timeouts"].cast<std::size_t>() == 1);
+            }
+        }
+
+        WHEN("the versions of an asset are listed")
+        {
+            THEN("the call fails once the deadline passes")
+            {
+                std::vector<std::string> versions;
+                CHECK_THROWS(plugin->getAssetVersions(assetId, versions));
+                CHECK(managerCallStats()["timeouts"].cast<std::size_t>() == 1);
+            }
+        }
+
+        WHEN("the manager repeatedly fails to respond in time")
+        {
+            for (std::size_t attempt = 0; attempt < 3; ++attempt)
+            {
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+            }
+
+            THEN("subsequent calls fail without calling the manager")
+            {
+                CHECK_THROWS(plugin->resolveAsset(assetId, resolvedPath));
+
+                const auto stats = managerCallStats();
+                CHECK(stats["timeouts"].cast<std::size_t>() == 3);
+                CHECK(stats["rejections"].cast<std::size_t>() == 1);
             }
         }
     }
@@ -809,6 +2282,28 @@ SCENARIO("Katana scene publishing")
 
                                 CHECK(actual == expected);
                             }
+
+                            THEN("each phase of publishing was timed for the asset type")
+                            {
+                                const auto phases = pybind11::dict{pybind11::dict{
+                                    pluginStats(plugin)["publishPhases"]}["katana scene"]};
+                                const auto count = [&](const char* phase)
+                                {
+                                    return pybind11::dict{phases[phase]}["count"]
+                                        .cast<std::size_t>();
+                                };
+
+                                CHECK(count("managementPolicy") == 1);
+                                // Once each for createAssetAndPath and
+                                // postCreateAsset.
+                                CHECK(count("traitConstruction") == 2);
+                                CHECK(count("preflight") == 1);
+                                CHECK(count("versionProbe") == 1);
+                                CHECK(count("managerDrivenResolve") == 1);
+                                CHECK(count("register") == 1);
+                                // Not an image sequence.
+                                CHECK_FALSE(phases.contains("frameRangeScan"));
+                            }
                         }
                     }
                 }
@@ -1299,4 +2794,76 @@ SCENARIO("UsdLayerExport publishing")
         }
     }
 }
+
+// Hidden by default, run with e.g. `KatanaOpenAssetIOTest "[benchmark]"`.
+TEST_CASE("Miss-heavy workloads", "[.][benchmark]")
+{
+    constexpr std::size_t kNumMisses = 1000;
+
+    std::vector<std::string> missingAssetIds;
+    missingAssetIds.reserve(kNumMisses);
+    for (std::size_t idx = 0; idx < kNumMisses; ++idx)
+    {
+        missingAssetIds.push_back("bal:///missing" + std::to_string(idx));
+    }
+
+    // Every miss reaches the manager.
+    auto uncachedPlugin = assetPluginInstance({{"KATANAOPENASSETIO_NEGATIVE_CACHE_TTL_MS", "0"}});
+
+    // Misses after the first are served from the negative cache.
+    auto cachedPlugin = assetPluginInstance();
+
+    for (const auto& plugin : {uncachedPlugin, cachedPlugin})
+    {
+        REQUIRE(plugin->runAssetPluginCommand(
+            "", "initialize", {{"library_path", BAL_DB_DIR "/bal_db_simple_image.json"}}));
+    }
+
+    const auto resolveAll = [&](const std::shared_ptr<FnKat::Asset>& plugin)
+    {
+        std::size_t numErrors = 0;
+        std::string resolvedPath;
+        for (const std::string& assetId : missingAssetIds)
+        {
+            try
+            {
+                plugin->resolveAsset(assetId, resolvedPath);
+            }
+            catch (const std::exception&)
+            {
+                ++numErrors;
+            }
+        }
+        return numErrors;
+    };
+
+    const auto queryAll = [&](const std::shared_ptr<FnKat::Asset>& plugin)
+    {
+        std::size_t numFields = 0;
+        for (const std::string& assetId : missingAssetIds)
+        {
+            FnKat::Asset::StringMap fields;
+            plugin->getAssetFields(assetId, false, fields);
+            numFields += fields.size();
+        }
+        return numFields;
+    };
+
+    BENCHMARK("resolveAsset, misses reaching the manager")
+    {
+        return resolveAll(uncachedPlugin);
+    };
+    BENCHMARK("resolveAsset, negatively cached misses")
+    {
+        return resolveAll(cachedPlugin);
+    };
+    BENCHMARK("getAssetFields, misses reaching the manager")
+    {
+        return queryAll(uncachedPlugin);
+    };
+    BENCHMARK("getAssetFields, negatively cached misses")
+    {
+        return queryAll(cachedPlugin);
+    };
+}
 // NOLINTEND(*-chained-comparison,*-function-cognitive-complexity,*-container-size-empty)
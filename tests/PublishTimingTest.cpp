@@ -0,0 +1,111 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <chrono>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "PublishTiming.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+namespace
+{
+constexpr std::chrono::milliseconds kPhaseDuration{20};
+}  // namespace
+
+SCENARIO("Timing the phases of a publish")
+{
+    GIVEN("no timings in progress")
+    {
+        THEN("there are no current timings")
+        {
+            CHECK(PublishPhaseTimings::current() == nullptr);
+        }
+
+        THEN("scopes without timings time nothing")
+        {
+            const PublishPhaseScope scope{nullptr, PublishPhase::kRegister};
+            CHECK(PublishPhaseTimings::current() == nullptr);
+        }
+    }
+
+    GIVEN("timings in progress")
+    {
+        const auto start = std::chrono::steady_clock::now();
+        PublishPhaseTimings timings;
+
+        THEN("they are the current timings until destroyed")
+        {
+            CHECK(PublishPhaseTimings::current() == &timings);
+            {
+                const PublishPhaseTimings innerTimings;
+                CHECK(PublishPhaseTimings::current() == &innerTimings);
+            }
+            CHECK(PublishPhaseTimings::current() == &timings);
+        }
+
+        THEN("they are not the current timings of other threads")
+        {
+            const PublishPhaseTimings* otherThreadTimings = &timings;
+            std::thread{[&] { otherThreadTimings = PublishPhaseTimings::current(); }}.join();
+            CHECK(otherThreadTimings == nullptr);
+        }
+
+        WHEN("a phase is timed")
+        {
+            {
+                const PublishPhaseScope scope{&timings, PublishPhase::kPreflight};
+                std::this_thread::sleep_for(kPhaseDuration);
+            }
+
+            THEN("only that phase was timed")
+            {
+                CHECK(timings.wasTimed(PublishPhase::kPreflight));
+                CHECK(timings.duration(PublishPhase::kPreflight) >= kPhaseDuration);
+                CHECK_FALSE(timings.wasTimed(PublishPhase::kRegister));
+                CHECK(timings.duration(PublishPhase::kRegister).count() == 0);
+            }
+
+            AND_WHEN("the phase is timed again")
+            {
+                {
+                    const PublishPhaseScope scope{&timings, PublishPhase::kPreflight};
+                    std::this_thread::sleep_for(kPhaseDuration);
+                }
+
+                THEN("the durations are summed")
+                {
+                    CHECK(timings.duration(PublishPhase::kPreflight) >= 2 * kPhaseDuration);
+                }
+            }
+        }
+
+        WHEN("a phase is timed within another")
+        {
+            {
+                const PublishPhaseScope outerScope{&timings, PublishPhase::kTraitConstruction};
+                std::this_thread::sleep_for(kPhaseDuration);
+                {
+                    const PublishPhaseScope innerScope{PublishPhaseTimings::current(),
+                                                       PublishPhase::kFrameRangeScan};
+                    std::this_thread::sleep_for(kPhaseDuration);
+                }
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            THEN("the inner phase is deducted from the outer phase")
+            {
+                const auto outerDuration = timings.duration(PublishPhase::kTraitConstruction);
+                const auto innerDuration = timings.duration(PublishPhase::kFrameRangeScan);
+                CHECK(outerDuration >= kPhaseDuration);
+                CHECK(innerDuration >= kPhaseDuration);
+                CHECK(outerDuration + innerDuration <= elapsed);
+            }
+        }
+    }
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
@@ -0,0 +1,106 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "ResolutionIndex.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+SCENARIO("Writing and reading a resolution index")
+{
+    using openassetio::trait::TraitsData;
+
+    const auto path = std::filesystem::temp_directory_path() /
+                      ("katana_openassetio_index_test_" + std::to_string(std::rand()));
+
+    GIVEN("an index written from several entities")
+    {
+        auto catTraits = TraitsData::make();
+        catTraits->addTrait("test:Empty");
+        catTraits->setTraitProperty(
+            "test:Location", "location", openassetio::Str{"file:///cat.exr"});
+        catTraits->setTraitProperty("test:Version", "stable", openassetio::Str{"2"});
+        catTraits->setTraitProperty("test:Version", "count", openassetio::Int{-3});
+        catTraits->setTraitProperty("test:Version", "ratio", openassetio::Float{0.5});
+        catTraits->setTraitProperty("test:Version", "isLatest", openassetio::Bool{true});
+
+        auto dogTraits = TraitsData::make();
+        dogTraits->setTraitProperty(
+            "test:Location", "location", openassetio::Str{"file:///dog.exr"});
+
+        writeResolutionIndex(path.string(),
+                             {{"ref:///dog", dogTraits, {}},
+                              {"ref:///cat", catTraits, {"ref:///cat?v=1", "ref:///cat?v=2"}},
+                              {"ref:///cat", dogTraits, {}}},
+                             "ref:///");
+
+        WHEN("the index is read")
+        {
+            const ResolutionIndex index{path.string()};
+
+            THEN("entities are found by reference, de-duplicated")
+            {
+                CHECK(index.size() == 2);
+                CHECK(index.entityReferencePrefix() == "ref:///");
+                CHECK_FALSE(index.find("ref:///bird"));
+                CHECK_FALSE(index.find("ref:///ca"));
+                CHECK(index.allTraits() ==
+                      openassetio::trait::TraitSet{"test:Empty", "test:Location", "test:Version"});
+
+                const auto catId = index.find("ref:///cat");
+                REQUIRE(catId);
+                CHECK(index.traitSet(*catId) == catTraits->traitSet());
+                CHECK(*index.traitsData(*catId, catTraits->traitSet()) == *catTraits);
+                CHECK(index.versions(*catId) ==
+                      std::vector<std::string_view>{"ref:///cat?v=1", "ref:///cat?v=2"});
+
+                const auto dogId = index.find("ref:///dog");
+                REQUIRE(dogId);
+                CHECK(*index.traitsData(*dogId, {"test:Location"}) == *dogTraits);
+                CHECK(index.versions(*dogId).empty());
+            }
+
+            THEN("traits data is limited to the requested traits")
+            {
+                const auto traitsData = index.traitsData(*index.find("ref:///cat"),
+                                                         {"test:Location", "test:Missing"});
+                CHECK(traitsData->traitSet() == openassetio::trait::TraitSet{"test:Location"});
+            }
+        }
+
+        WHEN("the index is truncated and read")
+        {
+            std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+            THEN("it is rejected")
+            {
+                CHECK_THROWS_AS(ResolutionIndex{path.string()}, std::runtime_error);
+            }
+        }
+    }
+
+    GIVEN("a file that is not an index")
+    {
+        std::ofstream{path} << "not an index, but long enough to contain a header............";
+
+        THEN("it is rejected")
+        {
+            CHECK_THROWS_AS(ResolutionIndex{path.string()}, std::runtime_error);
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
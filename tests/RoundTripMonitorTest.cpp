@@ -0,0 +1,176 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "RoundTripMonitor.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+SCENARIO("Accounting for manager round trips by logical operation")
+{
+    using std::chrono::milliseconds;
+    using Clock = RoundTripMonitor::Clock;
+
+    constexpr milliseconds kGap{100};
+    constexpr std::size_t kThreshold = 3;
+    constexpr std::size_t kBudget = 4;
+    const openassetio::trait::TraitSet kTraits{"trait.b", "trait.a"};
+    const Clock::time_point start = Clock::now();
+
+    RoundTripMonitor monitor{kGap, kThreshold, kBudget};
+
+    GIVEN("a burst of single-element calls on the same traits")
+    {
+        for (int idx = 0; idx < 5; ++idx)
+        {
+            CHECK(monitor.record("resolveAsset", "resolve", 1, kTraits, start + milliseconds{idx})
+                      .empty());
+        }
+
+        THEN("all calls are counted, but nothing is reported until the operation completes")
+        {
+            CHECK(monitor.numRoundTrips() == 5);
+            CHECK(monitor.operationRoundTrips().empty());
+            CHECK(monitor.batchableCalls().empty());
+        }
+
+        WHEN("the thread makes another call within the gap")
+        {
+            const auto newlyBatchable =
+                monitor.record("getAssetFields", "resolve", 1, kTraits, start + milliseconds{90});
+
+            THEN("it is part of the same operation")
+            {
+                CHECK(newlyBatchable.empty());
+                CHECK(monitor.completeIdle(start + milliseconds{150}).empty());
+                CHECK(monitor.completeIdle(start + milliseconds{191}).size() == 1);
+
+                const std::vector<OperationRoundTrips> roundTrips = monitor.operationRoundTrips();
+                REQUIRE(roundTrips.size() == 1);
+                CHECK(roundTrips[0].method == "resolveAsset");
+                CHECK(roundTrips[0].operations == 1);
+                CHECK(roundTrips[0].roundTrips == 6);
+            }
+        }
+
+        WHEN("the thread makes another call after the gap")
+        {
+            const auto newlyBatchable =
+                monitor.record("resolveAsset", "resolve", 1, kTraits, start + milliseconds{200});
+
+            THEN("the previous operation is complete, and its calls reported as batchable")
+            {
+                REQUIRE(newlyBatchable.size() == 1);
+                CHECK(newlyBatchable[0].method == "resolveAsset");
+                CHECK(newlyBatchable[0].managerCall == "resolve");
+                CHECK(newlyBatchable[0].traitIds == std::vector<std::string>{"trait.a", "trait.b"});
+                CHECK(newlyBatchable[0].calls == 5);
+
+                const std::vector<OperationRoundTrips> roundTrips = monitor.operationRoundTrips();
+                REQUIRE(roundTrips.size() == 1);
+                CHECK(roundTrips[0].operations == 1);
+                CHECK(roundTrips[0].roundTrips == 5);
+                CHECK(roundTrips[0].maxRoundTrips == 5);
+                CHECK(roundTrips[0].overBudget == 1);
+            }
+
+            AND_WHEN("a second operation makes the same calls")
+            {
+                for (int idx = 1; idx < 4; ++idx)
+                {
+                    monitor.record(
+                        "resolveAsset", "resolve", 1, kTraits, start + milliseconds{200 + idx});
+                }
+
+                THEN("they are accumulated, but not reported as newly batchable")
+                {
+                    CHECK(monitor.completeIdle(start + milliseconds{400}).empty());
+
+                    const std::vector<BatchableCalls> batchable = monitor.batchableCalls();
+                    REQUIRE(batchable.size() == 1);
+                    CHECK(batchable[0].operations == 2);
+                    CHECK(batchable[0].calls == 9);
+                    CHECK(batchable[0].maxCalls == 5);
+
+                    const std::vector<OperationRoundTrips> roundTrips =
+                        monitor.operationRoundTrips();
+                    REQUIRE(roundTrips.size() == 1);
+                    CHECK(roundTrips[0].operations == 2);
+                    CHECK(roundTrips[0].roundTrips == 9);
+                    CHECK(roundTrips[0].overBudget == 1);
+                }
+            }
+        }
+    }
+
+    GIVEN("calls that are batched, or fewer than the threshold")
+    {
+        monitor.record("getAssetVersions", "resolve", 20, kTraits, start);
+        monitor.record("getAssetVersions", "resolve", 20, kTraits, start);
+        monitor.record("getAssetVersions", "resolve", 20, kTraits, start);
+        monitor.record("getAssetVersions", "entityTraits", 1, {}, start);
+        monitor.record("getAssetVersions", "entityTraits", 1, {}, start);
+        monitor.record("getAssetVersions", "resolve", 1, {"trait.a"}, start);
+
+        THEN("no calls are reported as batchable")
+        {
+            CHECK(monitor.completeIdle(start + milliseconds{200}).empty());
+            CHECK(monitor.batchableCalls().empty());
+            REQUIRE(monitor.operationRoundTrips().size() == 1);
+            CHECK(monitor.operationRoundTrips()[0].roundTrips == 6);
+        }
+    }
+
+    GIVEN("bursts of calls made concurrently by different threads")
+    {
+        monitor.record("resolveAsset", "resolve", 1, kTraits, start);
+        std::thread{[&]
+                    {
+                        monitor.record("createAssetAndPath", "preflight", 1, {}, start);
+                        monitor.record("createAssetAndPath", "resolve", 1, kTraits, start);
+                    }}
+            .join();
+        monitor.record("resolveAsset", "resolve", 1, kTraits, start);
+
+        THEN("each thread's calls form a separate operation")
+        {
+            monitor.completeIdle(start + milliseconds{200});
+
+            const std::vector<OperationRoundTrips> roundTrips = monitor.operationRoundTrips();
+            REQUIRE(roundTrips.size() == 2);
+            CHECK(roundTrips[0].method == "createAssetAndPath");
+            CHECK(roundTrips[0].roundTrips == 2);
+            CHECK(roundTrips[1].method == "resolveAsset");
+            CHECK(roundTrips[1].roundTrips == 2);
+        }
+    }
+
+    GIVEN("no threshold or budget")
+    {
+        RoundTripMonitor disabledMonitor{kGap, 0, 0};
+        CHECK_FALSE(disabledMonitor.isEnabled());
+
+        for (int call = 0; call < 4; ++call)
+        {
+            CHECK(disabledMonitor.record("resolveAsset", "resolve", 1, kTraits, start).empty());
+        }
+
+        THEN("round trips are counted, but not grouped into operations")
+        {
+            disabledMonitor.completeIdle(start + milliseconds{200});
+
+            CHECK(disabledMonitor.numRoundTrips() == 4);
+            CHECK(disabledMonitor.operationRoundTrips().empty());
+            CHECK(disabledMonitor.batchableCalls().empty());
+        }
+    }
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)
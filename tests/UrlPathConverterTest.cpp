@@ -0,0 +1,125 @@
+// KatanaOpenAssetIO
+// Copyright (c) 2025 The Foundry Visionmongers Ltd
+// SPDX-License-Identifier: Apache-2.0
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <openassetio/utils/path.hpp>
+
+#include "UrlPathConverter.hpp"
+
+// Disable checks triggered by Catch2 macros.
+// NOLINTBEGIN(*-chained-comparison,*-function-cognitive-complexity)
+
+SCENARIO("Converting file URLs to paths")
+{
+    using openassetio::utils::FileUrlPathConverter;
+
+    const auto fileUrlPathConverter = std::make_shared<FileUrlPathConverter>();
+    UrlPathConverter urlPathConverter{fileUrlPathConverter};
+
+#ifndef _WIN32
+    GIVEN("a URL that needs no decoding")
+    {
+        const std::string url = GENERATE(
+            "file:///a",
+            "file:///some/permanent/storage/cat.v1.0001.exr",
+            "file:///jobs/show/sequences/sq010/shots/sh0100/lighting/renders/beauty/v012/"
+            "beauty.1001.exr",
+            "file:///with/sub-delims/!$&'()*+,;=/and/@:~_");
+
+        WHEN("it is converted")
+        {
+            const std::string path = urlPathConverter.pathFromUrl(url);
+
+            THEN("the path is sliced from the URL, as the full converter would convert it")
+            {
+                CHECK(UrlPathConverter::fastPathFromUrl(url));
+                CHECK(path == fileUrlPathConverter->pathFromUrl(url));
+                CHECK(urlPathConverter.stats().fastPaths.value() == 1);
+                CHECK(urlPathConverter.stats().fullConversions.value() == 0);
+            }
+        }
+    }
+#endif
+
+    GIVEN("a URL that requires decoding or normalisation")
+    {
+        const std::string url = GENERATE("file:///some/permanent/storage/cat.v1.%23%23.exr",
+                                         "file:///with%20space",
+                                         "file:///with/%C3%A9",
+                                         "file://localhost/with/host",
+                                         "file:///with//empty/segment",
+                                         "file:///with/./dot/segment",
+                                         "file:///with/../dot/segment");
+
+        WHEN("it is converted")
+        {
+            const std::string path = urlPathConverter.pathFromUrl(url);
+
+            THEN("the full converter is used")
+            {
+                CHECK_FALSE(UrlPathConverter::fastPathFromUrl(url));
+                CHECK(path == fileUrlPathConverter->pathFromUrl(url));
+                CHECK(urlPathConverter.stats().fullConversions.value() == 1);
+
+                AND_WHEN("it is converted again")
+                {
+                    const std::string memoisedPath = urlPathConverter.pathFromUrl(url);
+
+                    THEN("the conversion is memoised")
+                    {
+                        CHECK(memoisedPath == path);
+                        CHECK(urlPathConverter.stats().fullConversions.value() == 1);
+                        CHECK(urlPathConverter.stats().memoHits.value() == 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("File URL to path conversion", "[.][benchmark]")
+{
+    using openassetio::utils::FileUrlPathConverter;
+
+    const auto fileUrlPathConverter = std::make_shared<FileUrlPathConverter>();
+    UrlPathConverter urlPathConverter{fileUrlPathConverter};
+
+    // Typical lengths: a short path, a path in a show/shot hierarchy,
+    // and a deeply nested path.
+    const std::string shortUrl = "file:///tmp/cat.exr";
+    const std::string typicalUrl =
+        "file:///jobs/show/sequences/sq010/shots/sh0100/lighting/renders/beauty/v012/"
+        "beauty.1001.exr";
+    std::string longUrl = "file:///jobs/show";
+    while (longUrl.size() < 256)
+    {
+        longUrl += "/nested_directory";
+    }
+    longUrl += "/file.exr";
+    const std::string encodedUrl =
+        "file:///jobs/show/sequences/sq010/shots/sh0100/lighting/renders/beauty/v012/"
+        "beauty.%23%23%23%23.exr";
+
+    for (const std::string* url : {&shortUrl, &typicalUrl, &longUrl, &encodedUrl})
+    {
+        const std::string suffix = " (" + std::to_string(url->size()) + " chars)";
+        BENCHMARK("FileUrlPathConverter::pathFromUrl" + suffix)
+        {
+            return fileUrlPathConverter->pathFromUrl(*url);
+        };
+        BENCHMARK("UrlPathConverter::pathFromUrl" + suffix)
+        {
+            return urlPathConverter.pathFromUrl(*url);
+        };
+    }
+}
+
+// NOLINTEND(*-chained-comparison,*-function-cognitive-complexity)